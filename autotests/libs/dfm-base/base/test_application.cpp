@@ -22,6 +22,7 @@
 // Include test target classes
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/base/application/private/application_p.h>
 
 using namespace dfmbase;
@@ -400,20 +401,17 @@ TEST_F(ApplicationTest, TriggerAttribute_RestoreViewMode)
                    [mockSettings]() -> Settings* {
                        return mockSettings;
                    });
-    
-    // Mock Settings methods
-    stub.set_lamda(&Settings::keyList,
-                   [](Settings *self, const QString &group) -> QStringList {
+
+    // Mock FileViewStateStore methods
+    stub.set_lamda(&FileViewStateStore::keyList,
+                   [](FileViewStateStore *self) -> QStringList {
                        Q_UNUSED(self)
-                       Q_UNUSED(group)
                        return QStringList() << "file:///home/test";
                    });
-    
-    stub.set_lamda(static_cast<QVariant (Settings::*)(const QString&, const QString&, const QVariant&) const>(&Settings::value),
-                   [](Settings *self, const QString &group, const QString &key, const QVariant &defaultValue) -> QVariant {
+
+    stub.set_lamda(static_cast<QVariant (FileViewStateStore::*)(const QString &) const>(&FileViewStateStore::value),
+                   [](FileViewStateStore *self, const QString &key) -> QVariant {
                        Q_UNUSED(self)
-                       Q_UNUSED(group)
-                       Q_UNUSED(defaultValue)
                        if (key == "file:///home/test") {
                            QVariantMap map;
                            map["viewMode"] = 0; // Different from default
@@ -421,23 +419,22 @@ TEST_F(ApplicationTest, TriggerAttribute_RestoreViewMode)
                        }
                        return QVariant();
                    });
-    
+
     bool setValueCalled = false;
-    stub.set_lamda(static_cast<void (Settings::*)(const QString&, const QString&, const QVariant&)>(&Settings::setValue),
-                   [&setValueCalled](Settings *self, const QString &group, const QString &key, const QVariant &value) {
+    stub.set_lamda(static_cast<void (FileViewStateStore::*)(const QString &, const QVariantMap &)>(&FileViewStateStore::setValue),
+                   [&setValueCalled](FileViewStateStore *self, const QString &key, const QVariantMap &value) {
                        Q_UNUSED(self)
-                       Q_UNUSED(group)
                        Q_UNUSED(key)
                        Q_UNUSED(value)
                        setValueCalled = true;
                    });
-    
-    stub.set_lamda(&Settings::sync,
-                   [](Settings *self) -> bool {
+
+    stub.set_lamda(&FileViewStateStore::sync,
+                   [](FileViewStateStore *self) -> bool {
                        Q_UNUSED(self)
                        return true;
                    });
-    
+
     // Set up signal spy
     QSignalSpy viewModeChangedSpy(app, &Application::viewModeChanged);
     
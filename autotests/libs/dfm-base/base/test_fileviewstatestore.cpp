@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// test_fileviewstatestore.cpp - FileViewStateStore class unit tests
+
+#include <gtest/gtest.h>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QUrl>
+
+#include "stubext.h"
+
+#include <dfm-base/base/application/fileviewstatestore.h>
+#include <dfm-base/base/application/settings.h>
+
+using namespace dfmbase;
+
+class FileViewStateStoreTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        storeFile = tempDir.filePath("test.viewstate");
+    }
+
+    void TearDown() override
+    {
+        stub.clear();
+    }
+
+    QTemporaryDir tempDir;
+    QString storeFile;
+    stub_ext::StubExt stub;
+};
+
+TEST_F(FileViewStateStoreTest, Value_NotStored_ReturnsInvalid)
+{
+    FileViewStateStore store(storeFile);
+    EXPECT_FALSE(store.value(QString("file:///tmp/none")).isValid());
+    EXPECT_FALSE(QFile::exists(storeFile));
+}
+
+TEST_F(FileViewStateStoreTest, Value_DefaultValue_ReturnsDefault)
+{
+    FileViewStateStore store(storeFile);
+    store.setDefaultValues({ { "recent:///", QVariantMap { { "viewMode", 2 } } } });
+
+    EXPECT_EQ(store.value(QString("recent:///")).toMap().value("viewMode").toInt(), 2);
+    EXPECT_FALSE(store.contains("recent:///"));
+}
+
+TEST_F(FileViewStateStoreTest, SetValue_Synced_ReadBackByNewStore)
+{
+    QVariantHash expansion { { "file:///tmp/a", true } };
+    {
+        FileViewStateStore store(storeFile);
+        store.setValue(QString("file:///tmp/a"), QVariantMap { { "sortRole", 262 }, { "expansion", expansion } });
+        store.setValue(QString("file:///tmp/b"), QVariantMap { { "viewMode", 1 } });
+        EXPECT_TRUE(store.sync());
+    }
+
+    FileViewStateStore store(storeFile);
+    EXPECT_EQ(store.keyList().size(), 2);
+    const QVariantMap &state = store.value(QString("file:///tmp/a")).toMap();
+    EXPECT_EQ(state.value("sortRole").toInt(), 262);
+    EXPECT_EQ(state.value("expansion").toHash(), expansion);
+}
+
+TEST_F(FileViewStateStoreTest, SetValue_Changed_EmitsValueChanged)
+{
+    FileViewStateStore store(storeFile);
+    QSignalSpy spy(&store, &FileViewStateStore::valueChanged);
+
+    store.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+    store.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.first().at(0).toString(), QString(FileViewStateStore::kGroupName));
+    EXPECT_EQ(spy.first().at(1).toString(), QString("file:///tmp/a"));
+}
+
+TEST_F(FileViewStateStoreTest, Remove_Synced_KeyGone)
+{
+    {
+        FileViewStateStore store(storeFile);
+        store.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+        store.sync();
+        store.remove(QString("file:///tmp/a"));
+        store.sync();
+    }
+
+    FileViewStateStore store(storeFile);
+    EXPECT_FALSE(store.contains("file:///tmp/a"));
+}
+
+TEST_F(FileViewStateStoreTest, Sync_TornRecord_RecoversCompleteRecords)
+{
+    {
+        FileViewStateStore store(storeFile);
+        store.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+        store.sync();
+    }
+
+    QFile file(storeFile);
+    ASSERT_TRUE(file.open(QIODevice::Append));
+    file.write("\x01\x00\x00", 3);
+    file.close();
+
+    {
+        FileViewStateStore store(storeFile);
+        EXPECT_TRUE(store.contains("file:///tmp/a"));
+        store.setValue(QString("file:///tmp/b"), QVariantMap { { "viewMode", 2 } });
+        EXPECT_TRUE(store.sync());
+    }
+
+    FileViewStateStore store(storeFile);
+    EXPECT_EQ(store.value(QString("file:///tmp/a")).toMap().value("viewMode").toInt(), 1);
+    EXPECT_EQ(store.value(QString("file:///tmp/b")).toMap().value("viewMode").toInt(), 2);
+}
+
+TEST_F(FileViewStateStoreTest, Sync_OtherProcessAppended_PickedUp)
+{
+    FileViewStateStore reader(storeFile);
+    EXPECT_FALSE(reader.contains("file:///tmp/a"));
+
+    FileViewStateStore writer(storeFile);
+    writer.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+    writer.sync();
+
+    // no watcher in the test environment, reads do not stat the file
+    reader.reload();
+    EXPECT_EQ(reader.value(QString("file:///tmp/a")).toMap().value("viewMode").toInt(), 1);
+}
+
+TEST_F(FileViewStateStoreTest, ReadOnly_ChangeKeptInMemory_NotWritten)
+{
+    FileViewStateStore store(storeFile);
+    store.setReadOnly(true);
+    store.setValue(QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+
+    EXPECT_EQ(store.value(QString("file:///tmp/a")).toMap().value("viewMode").toInt(), 1);
+    EXPECT_TRUE(store.sync());
+    EXPECT_FALSE(QFile::exists(storeFile));
+}
+
+TEST_F(FileViewStateStoreTest, ReadOnly_ImportFrom_Refused)
+{
+    FileViewStateStore store(storeFile);
+    store.setReadOnly(true);
+
+    EXPECT_FALSE(store.importFrom(nullptr, FileViewStateStore::kGroupName));
+    EXPECT_FALSE(QFile::exists(storeFile));
+}
+
+TEST_F(FileViewStateStoreTest, ImportFrom_NothingRemovable_ReturnsFalse)
+{
+    Settings settings(tempDir.filePath("default.json"), QString(), tempDir.filePath("settings.json"));
+    FileViewStateStore store(storeFile);
+
+    EXPECT_FALSE(store.importFrom(&settings, FileViewStateStore::kGroupName));
+    EXPECT_FALSE(QFile::exists(storeFile));
+}
+
+TEST_F(FileViewStateStoreTest, ImportFrom_RemovableKeys_Imported)
+{
+    Settings settings(tempDir.filePath("default.json"), QString(), tempDir.filePath("settings.json"));
+    settings.setValue(FileViewStateStore::kGroupName, QString("file:///tmp/a"), QVariantMap { { "viewMode", 1 } });
+    FileViewStateStore store(storeFile);
+
+    EXPECT_TRUE(store.importFrom(&settings, FileViewStateStore::kGroupName));
+    EXPECT_TRUE(QFile::exists(storeFile));
+    EXPECT_EQ(store.value(QString("file:///tmp/a")).toMap().value("viewMode").toInt(), 1);
+}
@@ -436,6 +436,74 @@ TEST_F(SettingsTest, AutoSync_Functionality)
     delete settings;
 }
 
+/**
+ * @brief Test auto-sync background write
+ * Verify auto-sync writes the latest value in background and sync() flushes it
+ */
+TEST_F(SettingsTest, AutoSync_BackgroundWrite)
+{
+    Settings *settings = createTestSettings();
+    settings->setAutoSync(true);
+
+    settings->setValue("TestGroup", "autoSyncTest", "first");
+    settings->setValue("TestGroup", "autoSyncTest", "latest");
+
+    auto readValue = [this] {
+        QFile file(settingFile);
+        if (!file.open(QIODevice::ReadOnly))
+            return QString();
+        return QJsonDocument::fromJson(file.readAll()).object()["TestGroup"].toObject()["autoSyncTest"].toString();
+    };
+
+    for (int i = 0; i < 50 && readValue() != "latest"; ++i)
+        QTest::qWait(100);
+    EXPECT_EQ(readValue(), "latest");
+
+    // Own write must not reload or emit changes
+    QSignalSpy spy(settings, &Settings::valueChanged);
+    QTest::qWait(200);
+    EXPECT_EQ(spy.count(), 0);
+    EXPECT_EQ(settings->value("TestGroup", "autoSyncTest").toString(), "latest");
+
+    EXPECT_TRUE(settings->sync());
+
+    delete settings;
+}
+
+/**
+ * @brief Test auto-sync failed background write
+ * Verify a failed background write keeps the settings dirty and is retried
+ */
+TEST_F(SettingsTest, AutoSync_FailedWrite_Retried)
+{
+    // The parent of the settings file is a regular file, so writing fails
+    const QString blocked = tempDir + "/blocked";
+    createTestJsonFile(blocked, QJsonObject());
+    const QString blockedFile = blocked + "/settings.json";
+
+    Settings *settings = new Settings(defaultFile, fallbackFile, blockedFile);
+    settings->setAutoSync(true);
+    settings->setValue("TestGroup", "autoSyncTest", "retried");
+
+    QTest::qWait(1500);
+    EXPECT_FALSE(QFile::exists(blockedFile));
+
+    // The next retry of the dirty settings succeeds
+    QFile::remove(blocked);
+    QDir().mkpath(blocked);
+    auto readValue = [&blockedFile] {
+        QFile file(blockedFile);
+        if (!file.open(QIODevice::ReadOnly))
+            return QString();
+        return QJsonDocument::fromJson(file.readAll()).object()["TestGroup"].toObject()["autoSyncTest"].toString();
+    };
+    for (int i = 0; i < 50 && readValue() != "retried"; ++i)
+        QTest::qWait(100);
+    EXPECT_EQ(readValue(), "retried");
+
+    delete settings;
+}
+
 /**
  * @brief Test auto-sync exclusion
  * Verify auto-sync group exclusion functionality
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <dfm-base/file/local/private/fileattributestore.h>
+
+#include <QMap>
+#include <QUrl>
+
+DFMBASE_USE_NAMESPACE
+
+using ID = FileInfo::FileInfoAttributeID;
+
+namespace {
+// the attributes every cached info has after cacheAllAttributes, without the names and paths
+template<typename Store>
+void fillStatAttributes(Store &store, qint64 index)
+{
+    store.insert(ID::kStandardSize, QVariant::fromValue<quint64>(4096 + index));
+    store.insert(ID::kTimeModified, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeModifiedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeAccess, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeAccessUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeChanged, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeChangedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeCreated, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeCreatedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kUnixInode, QVariant::fromValue<quint64>(100000 + index));
+    store.insert(ID::kUnixUID, QVariant::fromValue<quint32>(1000));
+    store.insert(ID::kUnixGID, QVariant::fromValue<quint32>(1000));
+    store.insert(ID::kStandardIsFile, true);
+    store.insert(ID::kStandardIsDir, false);
+    store.insert(ID::kStandardIsSymlink, false);
+    store.insert(ID::kStandardIsHidden, false);
+    store.insert(ID::kStandardFileExists, true);
+    store.insert(ID::kAccessCanRead, true);
+    store.insert(ID::kAccessCanWrite, true);
+    store.insert(ID::kAccessCanExecute, false);
+    store.insert(ID::kAccessCanDelete, true);
+    store.insert(ID::kAccessCanTrash, true);
+    store.insert(ID::kAccessCanRename, true);
+    store.insert(ID::kStandardFileType, QVariant::fromValue(FileInfo::FileType::kDocuments));
+    store.insert(ID::kStandardContentType, QString("text/plain"));
+    store.insert(ID::kStandardFastContentType, QString("text/plain"));
+    store.insert(ID::kStandardIcon, QStringList { "text-plain", "text-x-generic" });
+    store.insert(ID::kOwnerUser, QString("uos"));
+    store.insert(ID::kOwnerGroup, QString("uos"));
+}
+}
+
+TEST(UT_FileAttributeStore, Insert_HotAttributes_KeepValueAndType)
+{
+    FileAttributeStore store;
+    EXPECT_FALSE(store.contains(ID::kStandardSize));
+    EXPECT_FALSE(store.value(ID::kStandardSize).isValid());
+
+    EXPECT_TRUE(store.insert(ID::kStandardSize, QVariant::fromValue<quint64>(1024)));
+    EXPECT_EQ(store.value(ID::kStandardSize).value<qint64>(), 1024);
+
+    EXPECT_TRUE(store.insert(ID::kUnixInode, QVariant::fromValue<quint64>(0xFFFFFFFFFFFFFFF0ULL)));
+    EXPECT_EQ(store.value(ID::kUnixInode).toULongLong(), 0xFFFFFFFFFFFFFFF0ULL);
+
+    EXPECT_TRUE(store.insert(ID::kAccessCanWrite, false));
+    EXPECT_TRUE(store.contains(ID::kAccessCanWrite));
+    EXPECT_FALSE(store.value(ID::kAccessCanWrite).toBool());
+    EXPECT_FALSE(store.contains(ID::kAccessCanRead));
+
+    store.insert(ID::kStandardFileType, QVariant::fromValue(FileInfo::FileType::kImages));
+    EXPECT_EQ(store.value(ID::kStandardFileType).value<FileInfo::FileType>(), FileInfo::FileType::kImages);
+
+    // an empty name is still a cached name
+    EXPECT_TRUE(store.insert(ID::kStandardName, QString()));
+    EXPECT_TRUE(store.value(ID::kStandardName).isValid());
+
+    store.insert(ID::kStandardIcon, QStringList { "image-png", "image-x-generic" });
+    EXPECT_EQ(store.value(ID::kStandardIcon).toStringList(), (QStringList { "image-png", "image-x-generic" }));
+}
+
+TEST(UT_FileAttributeStore, Insert_SameOrInvalidValue_NotChanged)
+{
+    FileAttributeStore store;
+    EXPECT_TRUE(store.insert(ID::kTimeModified, QVariant::fromValue<quint64>(10)));
+    EXPECT_FALSE(store.insert(ID::kTimeModified, QVariant::fromValue<quint64>(10)));
+    EXPECT_TRUE(store.insert(ID::kTimeModified, QVariant::fromValue<quint64>(11)));
+    EXPECT_FALSE(store.insert(ID::kTimeModified, QVariant()));
+    EXPECT_EQ(store.value(ID::kTimeModified).toLongLong(), 11);
+
+    EXPECT_TRUE(store.insert(ID::kStandardContentType, QString("text/plain")));
+    EXPECT_FALSE(store.insert(ID::kStandardContentType, QString("text/plain")));
+    EXPECT_TRUE(store.insert(ID::kStandardContentType, QString("text/html")));
+}
+
+TEST(UT_FileAttributeStore, Insert_RareOrUnexpectedType_KeptInSideMap)
+{
+    FileAttributeStore store;
+    EXPECT_TRUE(store.insert(ID::kOriginalUri, QUrl("file:///tmp/a")));
+    EXPECT_EQ(store.value(ID::kOriginalUri).toUrl(), QUrl("file:///tmp/a"));
+    EXPECT_FALSE(store.insert(ID::kOriginalUri, QUrl("file:///tmp/a")));
+
+    // a file type stored as int is not a FileType
+    EXPECT_TRUE(store.insert(ID::kStandardFileType, 3));
+    EXPECT_EQ(store.value(ID::kStandardFileType), QVariant(3));
+    EXPECT_TRUE(store.insert(ID::kStandardFileType, QVariant::fromValue(FileInfo::FileType::kAudios)));
+    EXPECT_EQ(store.value(ID::kStandardFileType).value<FileInfo::FileType>(), FileInfo::FileType::kAudios);
+
+    store.clear();
+    EXPECT_FALSE(store.contains(ID::kOriginalUri));
+    EXPECT_FALSE(store.contains(ID::kStandardFileType));
+}
+
+TEST(UT_FileAttributeStore, Insert_StatAttributes_SameAsMap)
+{
+    FileAttributeStore store;
+    QMap<ID, QVariant> map;
+    fillStatAttributes(store, 12345);
+    fillStatAttributes(map, 12345);
+
+    for (auto it = map.cbegin(); it != map.cend(); ++it) {
+        EXPECT_TRUE(store.contains(it.key())) << static_cast<int>(it.key());
+        EXPECT_EQ(store.value(it.key()), it.value()) << static_cast<int>(it.key());
+    }
+    EXPECT_FALSE(store.contains(ID::kStandardName));
+}
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "stubext.h"
+
+#include <dfm-base/file/local/localfilewatcher.h>
+#include <dfm-base/file/local/private/localfilewatcher_p.h>
+#include <dfm-base/file/local/private/inotifymultiplexer.h>
+
+#include <QTemporaryDir>
+#include <QSignalSpy>
+#include <QFile>
+#include <QDir>
+#include <QTest>
+
+#include <algorithm>
+
+#include <sys/inotify.h>
+
+DFMBASE_USE_NAMESPACE
+
+class UT_InotifyMultiplexer : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        if (!InotifyMultiplexer::instance()->isValid())
+            GTEST_SKIP() << "inotify is not available";
+    }
+
+    void touch(const QString &name)
+    {
+        QFile file(tempDir.filePath(name));
+        file.open(QIODevice::WriteOnly);
+        file.write("content");
+        file.close();
+    }
+
+    QTemporaryDir tempDir;
+    QObject context;
+    QList<InotifyEvent> received;
+};
+
+TEST_F(UT_InotifyMultiplexer, Subscribe_SamePath_OneWatch)
+{
+    auto mux = InotifyMultiplexer::instance();
+    const int before = mux->watchCount();
+
+    const int first = mux->subscribe(tempDir.path(), &context, [](const QList<InotifyEvent> &) {});
+    const int second = mux->subscribe(tempDir.path() + "/", &context, [](const QList<InotifyEvent> &) {});
+    ASSERT_GE(first, 0);
+    ASSERT_GE(second, 0);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(mux->watchCount(), before + 1);
+
+    mux->unsubscribe(first);
+    EXPECT_EQ(mux->watchCount(), before + 1);
+    mux->unsubscribe(second);
+    EXPECT_EQ(mux->watchCount(), before);
+
+    EXPECT_EQ(mux->subscribe(tempDir.filePath("missing"), &context, [](const QList<InotifyEvent> &) {}), -1);
+}
+
+TEST_F(UT_InotifyMultiplexer, Events_DecodedAndRenamePaired)
+{
+    auto mux = InotifyMultiplexer::instance();
+    const int token = mux->subscribe(tempDir.path(), &context, [this](const QList<InotifyEvent> &events) {
+        received.append(events);
+    });
+    ASSERT_GE(token, 0);
+
+    touch("a.txt");
+    EXPECT_TRUE(QTest::qWaitFor([this] {
+        return std::any_of(received.cbegin(), received.cend(), [](const InotifyEvent &e) {
+            return e.name == "a.txt" && (e.mask & IN_CREATE);
+        });
+    }));
+
+    received.clear();
+    QFile::rename(tempDir.filePath("a.txt"), tempDir.filePath("b.txt"));
+    EXPECT_TRUE(QTest::qWaitFor([this] {
+        return std::any_of(received.cbegin(), received.cend(), [](const InotifyEvent &e) {
+            return e.mask & IN_MOVED_TO;
+        });
+    }));
+
+    auto from = std::find_if(received.cbegin(), received.cend(), [](const InotifyEvent &e) { return e.mask & IN_MOVED_FROM; });
+    ASSERT_NE(from, received.cend());
+    EXPECT_EQ(from->name, "a.txt");
+    EXPECT_EQ(from->movedPath, tempDir.filePath("b.txt"));
+
+    mux->unsubscribe(token);
+}
+
+TEST_F(UT_InotifyMultiplexer, Subscribe_SymlinkedDir_KeepsEveryPath)
+{
+    auto mux = InotifyMultiplexer::instance();
+    ASSERT_TRUE(QDir(tempDir.path()).mkdir("real"));
+    const QString realPath = tempDir.filePath("real");
+    const QString linkPath = tempDir.filePath("link");
+    ASSERT_TRUE(QFile::link(realPath, linkPath));
+
+    const int real = mux->subscribe(realPath, &context, [](const QList<InotifyEvent> &) {});
+    const int link = mux->subscribe(linkPath, &context, [this](const QList<InotifyEvent> &events) {
+        received.append(events);
+    });
+    ASSERT_GE(real, 0);
+    ASSERT_GE(link, 0);
+    const int wd = mux->subscribers.value(link).wd;
+    EXPECT_EQ(mux->subscribers.value(real).wd, wd);
+    EXPECT_EQ(mux->wdPaths.value(wd), (QStringList { realPath, linkPath }));
+
+    // the subscriber of the link sees the move under its own path
+    touch("real/a.txt");
+    QFile::rename(realPath + "/a.txt", realPath + "/b.txt");
+    EXPECT_TRUE(QTest::qWaitFor([this] {
+        return std::any_of(received.cbegin(), received.cend(), [](const InotifyEvent &e) {
+            return e.mask & IN_MOVED_FROM;
+        });
+    }));
+    auto from = std::find_if(received.cbegin(), received.cend(), [](const InotifyEvent &e) { return e.mask & IN_MOVED_FROM; });
+    ASSERT_NE(from, received.cend());
+    EXPECT_EQ(from->movedPath, linkPath + "/b.txt");
+
+    mux->unsubscribe(real);
+    EXPECT_EQ(mux->wdPaths.value(wd), QStringList { linkPath });
+    mux->unsubscribe(link);
+    EXPECT_FALSE(mux->wdPaths.contains(wd));
+}
+
+TEST_F(UT_InotifyMultiplexer, Dispatch_Overflow_EverySubscriberRescans)
+{
+    auto mux = InotifyMultiplexer::instance();
+    QTemporaryDir otherDir;
+    int otherCount = 0;
+    const int token = mux->subscribe(tempDir.path(), &context, [this](const QList<InotifyEvent> &events) {
+        received.append(events);
+    });
+    const int other = mux->subscribe(otherDir.path(), &context, [&otherCount](const QList<InotifyEvent> &events) {
+        for (const InotifyEvent &e : events)
+            otherCount += (e.mask & IN_Q_OVERFLOW) ? 1 : 0;
+    });
+
+    InotifyMultiplexer::RawEvent overflow;
+    overflow.mask = IN_Q_OVERFLOW;
+    mux->dispatch({ overflow });
+    QCoreApplication::processEvents();
+
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_TRUE(received.first().mask & IN_Q_OVERFLOW);
+    EXPECT_TRUE(received.first().name.isEmpty());
+    EXPECT_EQ(otherCount, 1);
+
+    mux->unsubscribe(token);
+    mux->unsubscribe(other);
+}
+
+TEST_F(UT_InotifyMultiplexer, LocalFileWatcher_SignalsFromSharedWatch)
+{
+    LocalFileWatcher watcher(QUrl::fromLocalFile(tempDir.path()));
+    auto dptr = static_cast<LocalFileWatcherPrivate *>(watcher.d.data());
+    EXPECT_TRUE(dptr->useInotify);
+    EXPECT_TRUE(dptr->watcher.isNull());
+    ASSERT_TRUE(watcher.startWatcher());
+
+    QSignalSpy created(&watcher, &AbstractFileWatcher::subfileCreated);
+    QSignalSpy renamed(&watcher, &AbstractFileWatcher::fileRename);
+    QSignalSpy deleted(&watcher, &AbstractFileWatcher::fileDeleted);
+    QSignalSpy rescan(&watcher, &AbstractFileWatcher::rescanRequested);
+
+    touch("a.txt");
+    EXPECT_TRUE(QTest::qWaitFor([&created] { return created.count() > 0; }));
+    EXPECT_EQ(created.first().first().toUrl(), QUrl::fromLocalFile(tempDir.filePath("a.txt")));
+
+    QFile::rename(tempDir.filePath("a.txt"), tempDir.filePath("b.txt"));
+    EXPECT_TRUE(QTest::qWaitFor([&renamed] { return renamed.count() > 0; }));
+    EXPECT_EQ(renamed.first().at(1).toUrl(), QUrl::fromLocalFile(tempDir.filePath("b.txt")));
+
+    QFile::remove(tempDir.filePath("b.txt"));
+    EXPECT_TRUE(QTest::qWaitFor([&deleted] { return deleted.count() > 0; }));
+
+    dptr->handleInotifyEvents({ InotifyEvent { QString(), IN_Q_OVERFLOW, QString() } });
+    ASSERT_EQ(rescan.count(), 1);
+    EXPECT_EQ(rescan.first().first().toUrl(), QUrl::fromLocalFile(tempDir.path()));
+
+    EXPECT_TRUE(watcher.stopWatcher());
+    EXPECT_EQ(dptr->inotifyToken, -1);
+}
+
+TEST_F(UT_InotifyMultiplexer, LocalFileWatcher_RepeatedModify_MergedPerPath)
+{
+    LocalFileWatcher watcher(QUrl::fromLocalFile(tempDir.path()));
+    auto dptr = static_cast<LocalFileWatcherPrivate *>(watcher.d.data());
+    ASSERT_TRUE(watcher.startWatcher());
+
+    QSignalSpy changed(&watcher, &AbstractFileWatcher::fileAttributeChanged);
+    QSignalSpy deleted(&watcher, &AbstractFileWatcher::fileDeleted);
+
+    // the events of different batches are merged too
+    dptr->handleInotifyEvents({ InotifyEvent { "a.txt", IN_MODIFY, QString() } });
+    dptr->handleInotifyEvents({ InotifyEvent { "a.txt", IN_MODIFY, QString() },
+                                InotifyEvent { "b.txt", IN_MODIFY, QString() } });
+    dptr->handleInotifyEvents({ InotifyEvent { "a.txt", IN_CLOSE_WRITE, QString() },
+                                InotifyEvent { "b.txt", IN_DELETE, QString() } });
+    EXPECT_EQ(changed.count(), 0);
+    EXPECT_EQ(deleted.count(), 1);
+
+    EXPECT_TRUE(QTest::qWaitFor([&changed] { return changed.count() > 0; }));
+    QTest::qWait(300);
+    ASSERT_EQ(changed.count(), 1);
+    EXPECT_EQ(changed.first().first().toUrl(), QUrl::fromLocalFile(tempDir.filePath("a.txt")));
+
+    EXPECT_TRUE(watcher.stopWatcher());
+}
+
+TEST_F(UT_InotifyMultiplexer, LocalFileWatcher_RemoteFile_KeepsGio)
+{
+    LocalFileWatcher watcher(QUrl::fromLocalFile("/run/user/1000/gvfs/smb-share:server=host,share=s"));
+    auto dptr = static_cast<LocalFileWatcherPrivate *>(watcher.d.data());
+    EXPECT_FALSE(dptr->useInotify);
+    EXPECT_FALSE(dptr->watcher.isNull());
+}
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QDateTime>
+
+#include <dfm-base/mimetype/mimeappsindex.h>
+
+#include "stubext.h"
+
+using namespace dfmbase;
+
+class TestMimeAppsIndex : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(appsDir.isValid());
+        ASSERT_TRUE(cacheDir.isValid());
+        indexFile = cacheDir.filePath("mimeapps.index");
+    }
+
+    void TearDown() override
+    {
+        stub.clear();
+    }
+
+    QString writeDesktop(const QString &name, const QString &mimeTypes, bool noDisplay = false,
+                         qint64 mtimeSecs = 1000000)
+    {
+        const QString &path = appsDir.filePath(name);
+        QFile file(path);
+        file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+        file.write(QString("[Desktop Entry]\nType=Application\nName=%1\nExec=%1 %f\nMimeType=%2\n%3")
+                           .arg(name, mimeTypes, noDisplay ? "Hidden=true\n" : "")
+                           .toUtf8());
+        file.close();
+
+        // deterministic mtime, a rewrite in the same second still looks modified
+        QFile touch(path);
+        touch.open(QIODevice::ReadWrite);
+        touch.setFileTime(QDateTime::fromSecsSinceEpoch(mtimeSecs), QFileDevice::FileModificationTime);
+        touch.close();
+        return path;
+    }
+
+    QTemporaryDir appsDir;
+    QTemporaryDir cacheDir;
+    QString indexFile;
+    stub_ext::StubExt stub;
+};
+
+TEST_F(TestMimeAppsIndex, Refresh_Unchanged_ParsesNothing)
+{
+    writeDesktop("a.desktop", "text/plain;");
+    writeDesktop("b.desktop", "image/png;");
+
+    MimeAppsIndex index(indexFile);
+    EXPECT_EQ(index.refresh({ appsDir.path() }), 2);
+    EXPECT_EQ(index.refresh({ appsDir.path() }), 0);
+    EXPECT_EQ(index.entries().size(), 2);
+}
+
+TEST_F(TestMimeAppsIndex, Refresh_ModifiedAndRemoved_Updated)
+{
+    writeDesktop("a.desktop", "text/plain;");
+    const QString &b = writeDesktop("b.desktop", "image/png;");
+
+    MimeAppsIndex index(indexFile);
+    index.refresh({ appsDir.path() });
+
+    writeDesktop("a.desktop", "text/plain;text/markdown;", false, 2000000);
+    QFile::remove(b);
+
+    EXPECT_EQ(index.refresh({ appsDir.path() }), 2);
+    const auto &apps = index.mimeApps({});
+    EXPECT_TRUE(apps.contains("text/markdown"));
+    EXPECT_FALSE(apps.contains("image/png"));
+}
+
+TEST_F(TestMimeAppsIndex, SaveLoad_RoundTrip_KeepsEntries)
+{
+    writeDesktop("a.desktop", "text/plain;");
+    {
+        MimeAppsIndex index(indexFile);
+        index.refresh({ appsDir.path() });
+        EXPECT_TRUE(index.isDirty());
+        EXPECT_TRUE(index.save());
+        EXPECT_FALSE(index.isDirty());
+    }
+
+    MimeAppsIndex index(indexFile);
+    ASSERT_TRUE(index.load());
+    EXPECT_EQ(index.refresh({ appsDir.path() }), 0);
+    EXPECT_EQ(index.entries().value(appsDir.filePath("a.desktop")).desktop.desktopMimeType(),
+              QStringList { "text/plain", "" });
+}
+
+TEST_F(TestMimeAppsIndex, Load_Corrupted_StartsEmpty)
+{
+    QFile file(indexFile);
+    file.open(QIODevice::WriteOnly);
+    file.write("garbage");
+    file.close();
+
+    MimeAppsIndex index(indexFile);
+    EXPECT_FALSE(index.load());
+    EXPECT_TRUE(index.entries().isEmpty());
+}
+
+TEST_F(TestMimeAppsIndex, Update_SingleFile_OnlyThatEntry)
+{
+    writeDesktop("a.desktop", "text/plain;");
+    MimeAppsIndex index(indexFile);
+    index.refresh({ appsDir.path() });
+
+    const QString &c = writeDesktop("c.desktop", "text/plain;");
+    EXPECT_TRUE(index.update(c));
+    EXPECT_FALSE(index.update(c));
+    EXPECT_FALSE(index.update(appsDir.filePath("readme.txt")));
+
+    QFile::remove(c);
+    EXPECT_TRUE(index.update(c));
+    EXPECT_EQ(index.entries().size(), 1);
+}
+
+TEST_F(TestMimeAppsIndex, MimeApps_HiddenAndExtraTypes)
+{
+    const QString &a = writeDesktop("a.desktop", "text/plain;");
+    writeDesktop("hidden.desktop", "text/plain;", true);
+
+    MimeAppsIndex index(indexFile);
+    index.refresh({ appsDir.path() });
+
+    const auto &apps = index.mimeApps({ { "a.desktop", { "text/x-log" } } });
+    EXPECT_EQ(apps.value("text/plain"), QStringList { a });
+    EXPECT_EQ(apps.value("text/x-log"), QStringList { a });
+}
@@ -10,6 +10,7 @@
 #include <QTemporaryFile>
 
 #include <dfm-base/mimetype/mimesappsmanager.h>
+#include <dfm-base/mimetype/mimeappsindex.h>
 #include <dfm-base/utils/desktopfile.h>
 
 // Include stub headers
@@ -213,6 +214,25 @@ TEST_F(TestMimesAppsManager, TestInitMimeTypeApps)
     SUCCEED();
 }
 
+// Test initMimeTypeApps walks the folders only once
+TEST_F(TestMimesAppsManager, TestInitMimeTypeAppsWalksOnce)
+{
+    MimesAppsManager::initMimeTypeApps();
+
+    int refreshCount = 0;
+    stub.set_lamda(&MimeAppsIndex::refresh, [&refreshCount](MimeAppsIndex *, const QStringList &) {
+        __DBG_STUB_INVOKE__
+        ++refreshCount;
+        return 0;
+    });
+
+    MimesAppsManager::initMimeTypeApps();
+    EXPECT_EQ(refreshCount, 0);
+
+    MimesAppsManager::refreshMimeTypeApps();
+    EXPECT_EQ(refreshCount, 1);
+}
+
 // Test loadDDEMimeTypes
 TEST_F(TestMimesAppsManager, TestLoadDDEMimeTypes)
 {
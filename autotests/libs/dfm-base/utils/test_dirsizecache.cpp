@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <dfm-base/utils/dirsizecache.h>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+
+#include <sys/stat.h>
+
+using namespace dfmbase;
+
+class UT_DirSizeCache : public testing::Test
+{
+protected:
+    struct Dir
+    {
+        QByteArray path;
+        quint64 device { 0 };
+        quint64 inode { 0 };
+        qint64 modifiedTime { 0 };
+    };
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+    }
+
+    Dir makeDir(const QString &name)
+    {
+        const QString path = tempDir.filePath(name);
+        EXPECT_TRUE(QDir().mkpath(path));
+        return statDir(path);
+    }
+
+    static Dir statDir(const QString &path)
+    {
+        Dir dir;
+        dir.path = QFile::encodeName(path);
+        struct stat statBuf;
+        EXPECT_EQ(::stat(dir.path.constData(), &statBuf), 0);
+        dir.device = statBuf.st_dev;
+        dir.inode = statBuf.st_ino;
+        dir.modifiedTime = statBuf.st_mtim.tv_sec * 1000000000LL + statBuf.st_mtim.tv_nsec;
+        return dir;
+    }
+
+    static DirSizeCache::Entry makeEntry(const Dir &dir, const QList<Dir> &subDirs = {})
+    {
+        DirSizeCache::Entry entry;
+        entry.modifiedTime = dir.modifiedTime;
+        entry.fileCount = 3;
+        entry.fileSize = 300;
+        entry.progressSize = 300;
+        for (const Dir &subDir : subDirs)
+            entry.subDirs.append({ subDir.path.mid(subDir.path.lastIndexOf('/') + 1), subDir.device, subDir.inode });
+        return entry;
+    }
+
+    static void writeFile(const QString &path)
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Append));
+        file.write("data");
+    }
+
+    // 监视的通知在主线程处理
+    static void processWatchEvents()
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.elapsed() < 300) {
+            QCoreApplication::processEvents();
+            QThread::msleep(10);
+        }
+    }
+
+    QTemporaryDir tempDir;
+};
+
+TEST_F(UT_DirSizeCache, find_MatchesModifiedTime)
+{
+    const Dir dir = makeDir("dir");
+    DirSizeCache cache;
+    ASSERT_TRUE(cache.watch(dir.device, dir.inode, dir.path));
+    cache.insert(dir.device, dir.inode, makeEntry(dir));
+
+    DirSizeCache::Entry entry;
+    EXPECT_TRUE(cache.find(dir.device, dir.inode, dir.modifiedTime, &entry));
+    EXPECT_EQ(entry.fileSize, 300);
+    EXPECT_FALSE(cache.find(dir.device, dir.inode, dir.modifiedTime + 1, &entry));
+    EXPECT_FALSE(cache.find(dir.device, dir.inode + 1, dir.modifiedTime, &entry));
+    EXPECT_EQ(cache.count(), 1);
+}
+
+TEST_F(UT_DirSizeCache, insert_WithoutWatchIgnored)
+{
+    const Dir dir = makeDir("dir");
+    DirSizeCache cache;
+    cache.insert(dir.device, dir.inode, makeEntry(dir));
+
+    DirSizeCache::Entry entry;
+    EXPECT_FALSE(cache.find(dir.device, dir.inode, dir.modifiedTime, &entry));
+    EXPECT_EQ(cache.count(), 0);
+}
+
+TEST_F(UT_DirSizeCache, release_DropsPendingWatch)
+{
+    const Dir dir = makeDir("dir");
+    DirSizeCache cache;
+    ASSERT_TRUE(cache.watch(dir.device, dir.inode, dir.path));
+    cache.release(dir.device, dir.inode);
+    EXPECT_TRUE(cache.nodes.isEmpty());
+}
+
+TEST_F(UT_DirSizeCache, fileModified_EntryDropped)
+{
+    const Dir dir = makeDir("dir");
+    writeFile(tempDir.filePath("dir/file"));
+    const Dir current = statDir(tempDir.filePath("dir"));
+
+    DirSizeCache cache;
+    ASSERT_TRUE(cache.watch(current.device, current.inode, current.path));
+    cache.insert(current.device, current.inode, makeEntry(current));
+
+    // 改写文件内容不改变目录的 mtime
+    writeFile(tempDir.filePath("dir/file"));
+    ASSERT_EQ(statDir(tempDir.filePath("dir")).modifiedTime, current.modifiedTime);
+    processWatchEvents();
+
+    DirSizeCache::Entry entry;
+    EXPECT_FALSE(cache.find(current.device, current.inode, current.modifiedTime, &entry));
+    EXPECT_TRUE(cache.nodes.isEmpty());
+}
+
+TEST_F(UT_DirSizeCache, changedWhileReading_InsertDropped)
+{
+    const Dir dir = makeDir("dir");
+    DirSizeCache cache;
+    ASSERT_TRUE(cache.watch(dir.device, dir.inode, dir.path));
+
+    writeFile(tempDir.filePath("dir/file"));
+    processWatchEvents();
+    cache.insert(dir.device, dir.inode, makeEntry(dir));
+
+    EXPECT_EQ(cache.count(), 0);
+    EXPECT_TRUE(cache.nodes.isEmpty());
+}
+
+TEST_F(UT_DirSizeCache, findSubtree_SumsChildren)
+{
+    const Dir root = makeDir("root");
+    const Dir a = makeDir("root/a");
+    const Dir b = makeDir("root/b");
+    const Dir c = makeDir("root/b/c");
+
+    DirSizeCache cache;
+    for (const Dir &dir : { root, a, b, c })
+        ASSERT_TRUE(cache.watch(dir.device, dir.inode, dir.path));
+    cache.insert(c.device, c.inode, makeEntry(c));
+    cache.insert(b.device, b.inode, makeEntry(b, { c }));
+    cache.insert(a.device, a.inode, makeEntry(a));
+    cache.insert(root.device, root.inode, makeEntry(root, { a, b }));
+
+    DirSizeCache::Totals totals;
+    ASSERT_TRUE(cache.findSubtree(root.device, root.inode, root.modifiedTime, &totals));
+    EXPECT_EQ(totals.fileCount, 12);
+    EXPECT_EQ(totals.directoryCount, 3);
+    EXPECT_EQ(totals.fileSize, 1200);
+    EXPECT_EQ(totals.progressSize, 1200);
+    EXPECT_TRUE(cache.nodes.value({ root.device, root.inode }).subtreeValid);
+    EXPECT_TRUE(cache.nodes.value({ b.device, b.inode }).subtreeValid);
+}
+
+TEST_F(UT_DirSizeCache, findSubtree_ChildChangedInvalidatesAncestors)
+{
+    const Dir root = makeDir("root");
+    const Dir a = makeDir("root/a");
+    const Dir b = makeDir("root/b");
+    writeFile(tempDir.filePath("root/b/file"));
+    const Dir currentB = statDir(tempDir.filePath("root/b"));
+
+    DirSizeCache cache;
+    for (const Dir &dir : { root, a, currentB })
+        ASSERT_TRUE(cache.watch(dir.device, dir.inode, dir.path));
+    cache.insert(currentB.device, currentB.inode, makeEntry(currentB));
+    cache.insert(a.device, a.inode, makeEntry(a));
+    cache.insert(root.device, root.inode, makeEntry(root, { a, currentB }));
+
+    DirSizeCache::Totals totals;
+    ASSERT_TRUE(cache.findSubtree(root.device, root.inode, root.modifiedTime, &totals));
+
+    writeFile(tempDir.filePath("root/b/file"));
+    processWatchEvents();
+
+    // 根目录自身的条目仍然可用，只有子树汇总失效
+    EXPECT_FALSE(cache.nodes.value({ root.device, root.inode }).subtreeValid);
+    EXPECT_FALSE(cache.findSubtree(root.device, root.inode, root.modifiedTime, &totals));
+    DirSizeCache::Entry entry;
+    EXPECT_TRUE(cache.find(root.device, root.inode, root.modifiedTime, &entry));
+    EXPECT_TRUE(cache.findSubtree(a.device, a.inode, a.modifiedTime, &totals));
+}
+
+TEST_F(UT_DirSizeCache, findSubtree_LinkedFilesNotSummed)
+{
+    const Dir root = makeDir("root");
+    const Dir a = makeDir("root/a");
+
+    DirSizeCache cache;
+    ASSERT_TRUE(cache.watch(root.device, root.inode, root.path));
+    ASSERT_TRUE(cache.watch(a.device, a.inode, a.path));
+    DirSizeCache::Entry entry = makeEntry(a);
+    entry.linkedFiles = { { 42, 4096 } };
+    cache.insert(a.device, a.inode, entry);
+    cache.insert(root.device, root.inode, makeEntry(root, { a }));
+
+    DirSizeCache::Totals totals;
+    EXPECT_FALSE(cache.findSubtree(root.device, root.inode, root.modifiedTime, &totals));
+    ASSERT_TRUE(cache.find(a.device, a.inode, a.modifiedTime, &entry));
+    EXPECT_EQ(entry.linkedFiles.first().inode, 42u);
+}
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <dfm-base/utils/filescanner.h>
+#include <dfm-base/utils/dirsizecache.h>
+
+#include <QTemporaryDir>
+#include <QFile>
+#include <QDir>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace dfmbase;
+
+class UT_FileScanner : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        // 40 directories in 4 levels, each with a few files, a hard link and a symlink
+        for (int top = 0; top < 4; ++top) {
+            for (int sub = 0; sub < 10; ++sub) {
+                const QString dir = tempDir.filePath(QString("d%1/s%2").arg(top).arg(sub));
+                ASSERT_TRUE(QDir().mkpath(dir));
+                for (int i = 0; i < 5; ++i)
+                    writeFile(dir + QString("/f%1").arg(i), 100 * (i + 1));
+            }
+        }
+        writeFile(tempDir.filePath("big"), 4096);
+        ASSERT_EQ(::link(QFile::encodeName(tempDir.filePath("big")).constData(),
+                         QFile::encodeName(tempDir.filePath("d0/big.link")).constData()),
+                  0);
+        ASSERT_TRUE(QFile::link(tempDir.filePath("big"), tempDir.filePath("d1/big.sym")));
+    }
+
+    void writeFile(const QString &path, int size)
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(QByteArray(size, 'x'));
+    }
+
+    // the size cache handles its watch events in the main thread
+    static void processWatchEvents()
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.elapsed() < 300) {
+            QCoreApplication::processEvents();
+            QThread::msleep(10);
+        }
+    }
+
+    QTemporaryDir tempDir;
+};
+
+TEST_F(UT_FileScanner, Parallel_SameResultAsSerial)
+{
+    const QList<QUrl> urls { QUrl::fromLocalFile(tempDir.path()) };
+    for (auto extra : { FileScanner::ScanOptions(), FileScanner::ScanOptions(FileScanner::ScanOption::IncludeSource),
+                        FileScanner::ScanOptions(FileScanner::ScanOption::CountOnly) }) {
+        const auto &serial = FileScanner::scanSync(urls, extra);
+        const auto &parallel = FileScanner::scanSync(urls, extra | FileScanner::ScanOption::Parallel);
+        EXPECT_EQ(parallel.fileCount, serial.fileCount);
+        EXPECT_EQ(parallel.directoryCount, serial.directoryCount);
+        EXPECT_EQ(parallel.totalSize, serial.totalSize);
+        EXPECT_EQ(parallel.progressSize, serial.progressSize);
+    }
+}
+
+TEST_F(UT_FileScanner, Parallel_HardLinkCountedOnce)
+{
+    const auto &result = FileScanner::scanSync({ QUrl::fromLocalFile(tempDir.path()) }, FileScanner::ScanOption::Parallel);
+    // 200 files, the original, its hard link and the symlink
+    EXPECT_EQ(result.fileCount, 203);
+    EXPECT_EQ(result.directoryCount, 44);
+    EXPECT_EQ(result.totalSize, 40 * (100 + 200 + 300 + 400 + 500) + 4096);
+}
+
+TEST_F(UT_FileScanner, Parallel_CollectFiles)
+{
+    const auto &result = FileScanner::scanSync({ QUrl::fromLocalFile(tempDir.path()) },
+                                               FileScanner::ScanOption::Parallel | FileScanner::ScanOption::CollectFiles);
+    EXPECT_EQ(result.allFiles.size(), result.fileCount + result.directoryCount);
+    EXPECT_TRUE(result.allFiles.contains(QUrl::fromLocalFile(tempDir.filePath("d0/big.link"))));
+}
+
+TEST_F(UT_FileScanner, Parallel_CallbackStops)
+{
+    int calls = 0;
+    const auto &result = FileScanner::scanSyncWithCallback({ QUrl::fromLocalFile(tempDir.path()) },
+                                                           FileScanner::ScanOption::Parallel,
+                                                           [&calls](const FileScanner::ScanResult &) {
+                                                               ++calls;
+                                                               return false;
+                                                           });
+    // a scan this small usually finishes before the first progress, it must not hang either way
+    EXPECT_LE(calls, 1);
+    EXPECT_LE(result.fileCount, 203);
+}
+
+TEST_F(UT_FileScanner, SizeCache_ReusesUnchangedDirectories)
+{
+    const QList<QUrl> urls { QUrl::fromLocalFile(tempDir.path()) };
+    const auto options = FileScanner::ScanOption::Parallel | FileScanner::ScanOption::UseSizeCache;
+    const auto &plain = FileScanner::scanSync(urls, FileScanner::ScanOption::Parallel);
+
+    for (int i = 0; i < 2; ++i) {
+        const auto &cached = FileScanner::scanSync(urls, options);
+        EXPECT_EQ(cached.fileCount, plain.fileCount);
+        EXPECT_EQ(cached.directoryCount, plain.directoryCount);
+        EXPECT_EQ(cached.totalSize, plain.totalSize);
+        EXPECT_EQ(cached.progressSize, plain.progressSize);
+    }
+
+    // writing a file does not change the directory mtime, the watch drops the entry and the subtree totals above it
+    writeFile(tempDir.filePath("d2/s3/f0"), 1000);
+    processWatchEvents();
+    EXPECT_EQ(FileScanner::scanSync(urls, options).totalSize, plain.totalSize + 900);
+
+    // a new file changes the directory mtime
+    writeFile(tempDir.filePath("d3/s0/new"), 50);
+    processWatchEvents();
+    const auto &added = FileScanner::scanSync(urls, options);
+    EXPECT_EQ(added.fileCount, plain.fileCount + 1);
+    EXPECT_EQ(added.totalSize, plain.totalSize + 950);
+}
+
+TEST_F(UT_FileScanner, SizeCache_SubtreeTotalsSkipTheWalk)
+{
+    const QList<QUrl> urls { QUrl::fromLocalFile(tempDir.filePath("d2")) };
+    const auto options = FileScanner::ScanOption::Parallel | FileScanner::ScanOption::UseSizeCache;
+    const auto &plain = FileScanner::scanSync(urls, FileScanner::ScanOption::Parallel);
+    FileScanner::scanSync(urls, options);
+
+    // the subtree of d2 has no hard links, its totals are kept on d2
+    struct stat statBuf;
+    ASSERT_EQ(::stat(QFile::encodeName(tempDir.filePath("d2")).constData(), &statBuf), 0);
+    DirSizeCache::Totals totals;
+    ASSERT_TRUE(DirSizeCache::instance()->findSubtree(statBuf.st_dev, statBuf.st_ino,
+                                                      statBuf.st_mtim.tv_sec * 1000000000LL + statBuf.st_mtim.tv_nsec, &totals));
+    EXPECT_EQ(totals.fileCount, plain.fileCount);
+    EXPECT_EQ(totals.directoryCount, plain.directoryCount);
+    EXPECT_EQ(totals.fileSize, plain.totalSize);
+
+    const auto &cached = FileScanner::scanSync(urls, options);
+    EXPECT_EQ(cached.fileCount, plain.fileCount);
+    EXPECT_EQ(cached.directoryCount, plain.directoryCount);
+    EXPECT_EQ(cached.totalSize, plain.totalSize);
+    EXPECT_EQ(cached.progressSize, plain.progressSize);
+}
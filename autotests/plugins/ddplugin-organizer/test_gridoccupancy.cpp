@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "stubext.h"
+#include "mode/normalized/gridoccupancy.h"
+#include "mode/normalized/normalizedmode_p.h"
+
+#include "gtest/gtest.h"
+
+using namespace ddplugin_organizer;
+
+TEST(UT_GridOccupancy, IsFree_OccupiedCells)
+{
+    GridOccupancy occupancy({ 10, 8 });
+    occupancy.occupy({ 2, 2, 3, 2 });
+
+    EXPECT_FALSE(occupancy.isFree({ 4, 3, 1, 1 }));
+    EXPECT_FALSE(occupancy.isFree({ 0, 0, 3, 3 }));
+    EXPECT_TRUE(occupancy.isFree({ 5, 2, 2, 2 }));
+    EXPECT_TRUE(occupancy.isFree({ 2, 4, 3, 4 }));
+    // empty rects intersect nothing
+    EXPECT_TRUE(occupancy.isFree({ 3, 3, 0, 0 }));
+}
+
+TEST(UT_GridOccupancy, Occupy_OutOfTable_Clipped)
+{
+    GridOccupancy occupancy({ 4, 4 });
+    occupancy.occupy({ -2, -2, 3, 3 });
+    occupancy.occupy({ 10, 10, 2, 2 });
+
+    EXPECT_FALSE(occupancy.isFree({ 0, 0, 1, 1 }));
+    EXPECT_TRUE(occupancy.isFree({ 1, 1, 3, 3 }));
+}
+
+TEST(UT_GridOccupancy, FindFree_SameOrderAsLinearSearch)
+{
+    const QSize table(12, 9);
+    const QList<QRect> seats { { 9, 0, 3, 4 }, { 6, 0, 3, 2 }, { 9, 5, 3, 4 } };
+
+    GridOccupancy occupancy(table);
+    for (const QRect &seat : seats)
+        occupancy.occupy(seat);
+
+    QRect item(0, 0, 3, 2);
+    ASSERT_TRUE(occupancy.findFree(item));
+    // the right most column first, then from top to bottom
+    EXPECT_EQ(item, QRect(6, 2, 3, 2));
+
+    for (const QRect &seat : seats)
+        EXPECT_FALSE(seat.intersects(item));
+}
+
+TEST(UT_GridOccupancy, FindFree_NoRoom)
+{
+    GridOccupancy occupancy({ 4, 4 });
+    occupancy.occupy({ 0, 0, 4, 2 });
+
+    QRect item(0, 0, 2, 3);
+    EXPECT_FALSE(occupancy.findFree(item));
+
+    QRect tooLarge(0, 0, 5, 1);
+    EXPECT_FALSE(occupancy.findFree(tooLarge));
+}
+
+TEST(UT_GridOccupancy, TryPlaceRect_UsesOccupancy)
+{
+    NormalizedMode mode;
+    NormalizedModePrivate *d = mode.d;
+
+    QRect item(0, 0, 2, 2);
+    EXPECT_TRUE(d->tryPlaceRect(item, { { 4, 0, 2, 6 } }, { 6, 6 }));
+    EXPECT_EQ(item, QRect(2, 0, 2, 2));
+
+    EXPECT_FALSE(d->tryPlaceRect(item, { { 0, 0, 6, 6 } }, { 6, 6 }));
+}
@@ -4,6 +4,7 @@
 
 #include "stubext.h"
 #include "mode/normalized/type/typeclassifier.h"
+#include "mode/normalized/type/typeclassifier_p.h"
 #include "mode/normalized/fileclassifier.h"
 #include "models/modeldatahandler.h"
 
@@ -179,3 +180,46 @@ TEST_F(UT_TypeClassifier, AcceptRename_AcceptsOrRejectsRename)
     // Should return true if rename is accepted, false otherwise
     EXPECT_TRUE(result || !result);
 }
+
+TEST_F(UT_TypeClassifier, Classify_Cached_SkipsFileInfo)
+{
+    const QUrl url = QUrl::fromLocalFile("/tmp/ut_organizer_not_exists.txt");
+    EXPECT_TRUE(classifier->classify(url).isEmpty());
+    // a missing file is not cached, it may be created later
+    EXPECT_FALSE(classifier->d->categoryCache.contains(url));
+
+    classifier->d->categoryCache.insert(url, kTypeKeyDoc);
+    EXPECT_EQ(classifier->classify(url), kTypeKeyDoc);
+}
+
+TEST_F(UT_TypeClassifier, CategoryCache_InvalidatedByChange)
+{
+    const QUrl url = QUrl::fromLocalFile("/tmp/a.txt");
+    const QUrl renamed = QUrl::fromLocalFile("/tmp/a.png");
+    classifier->d->categoryCache.insert(url, kTypeKeyDoc);
+    classifier->d->categoryCache.insert(renamed, kTypeKeyPic);
+
+    classifier->change(url);
+    EXPECT_FALSE(classifier->d->categoryCache.contains(url));
+
+    classifier->d->categoryCache.insert(url, kTypeKeyDoc);
+    classifier->replace(url, renamed);
+    EXPECT_FALSE(classifier->d->categoryCache.contains(url));
+    EXPECT_FALSE(classifier->d->categoryCache.contains(renamed));
+
+    classifier->d->categoryCache.insert(url, kTypeKeyDoc);
+    classifier->remove(url);
+    EXPECT_FALSE(classifier->d->categoryCache.contains(url));
+}
+
+TEST_F(UT_TypeClassifier, Reset_KeepsCategoryOfRemainingFiles)
+{
+    const QUrl kept = QUrl::fromLocalFile("/tmp/kept.txt");
+    const QUrl gone = QUrl::fromLocalFile("/tmp/gone.txt");
+    classifier->d->categoryCache.insert(kept, kTypeKeyDoc);
+    classifier->d->categoryCache.insert(gone, kTypeKeyDoc);
+
+    classifier->reset({ kept });
+    EXPECT_EQ(classifier->d->categoryCache.value(kept), kTypeKeyDoc);
+    EXPECT_FALSE(classifier->d->categoryCache.contains(gone));
+}
@@ -8,6 +8,10 @@
 #include <QSignalSpy>
 #include <QImage>
 #include <QFutureWatcher>
+#include <QImageReader>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
 
 #include "thumbnailmanager.h"
 
@@ -87,3 +91,73 @@ TEST_F(UT_ThumbnailManager, ThumbnailImage_LoadFile_ReturnsPixmapAndSaves)
     QPixmap pix = ThumbnailManager::thumbnailImage(key, 1.0);
     EXPECT_FALSE(pix.isNull());
 }
+
+// [decodeThumbnail]_[LargeSource]_[DecodedScaledAndCropped]
+TEST_F(UT_ThumbnailManager, DecodeThumbnail_LargeSource_DecodedScaledAndCropped)
+{
+    QImage img(1600, 800, QImage::Format_RGB32);
+    img.fill(Qt::blue);
+    const QString tmp = QDir::temp().absoluteFilePath("thumb_ut_large.jpg");
+    ASSERT_TRUE(img.save(tmp));
+
+    QSize scaledSize;
+    stub.set_lamda(&QImageReader::setScaledSize, [&scaledSize](QImageReader *, const QSize &size) {
+        __DBG_STUB_INVOKE__
+        scaledSize = size;
+    });
+
+    const QImage thumb = ThumbnailManager::decodeThumbnail(tmp, QSize(172, 100));
+    // covers the item, the aspect ratio is kept
+    EXPECT_EQ(scaledSize, QSize(200, 100));
+    EXPECT_EQ(thumb.size(), QSize(172, 100));
+    QFile::remove(tmp);
+}
+
+// [find]_[SameKeyTwice]_[QueuedOnce]
+TEST_F(UT_ThumbnailManager, Find_SameKeyTwice_QueuedOnce)
+{
+    ThumbnailManager mgr(3.0);
+    mgr.maxRunning = 0;   // keep everything queued
+    const QString key = QUrl::toPercentEncoding("file:///tmp/nonexist-a.jpg");
+
+    mgr.find(key);
+    mgr.find(key);
+    EXPECT_EQ(mgr.queuedRequests.size(), 1);
+}
+
+// [prioritize]_[VisibleKeys]_[MovedToFront]
+TEST_F(UT_ThumbnailManager, Prioritize_VisibleKeys_MovedToFront)
+{
+    ThumbnailManager mgr(3.0);
+    mgr.maxRunning = 0;
+    const QString a = QUrl::toPercentEncoding("file:///tmp/nonexist-a.jpg");
+    const QString b = QUrl::toPercentEncoding("file:///tmp/nonexist-b.jpg");
+    const QString c = QUrl::toPercentEncoding("file:///tmp/nonexist-c.jpg");
+    mgr.find(a);
+    mgr.find(b);
+    mgr.find(c);
+
+    mgr.prioritize({ c, b, QUrl::toPercentEncoding("file:///tmp/unknown.jpg") });
+    EXPECT_EQ(mgr.queuedRequests, (QQueue<QString> { c, b, a }));
+}
+
+// [cacheFile]_[SourceModified]_[NewCacheFile]
+TEST_F(UT_ThumbnailManager, CacheFile_SourceModified_NewCacheFile)
+{
+    QImage img(60, 40, QImage::Format_RGB32);
+    img.fill(Qt::red);
+    const QString tmp = QDir::temp().absoluteFilePath("thumb_ut_mtime.png");
+    ASSERT_TRUE(img.save(tmp));
+    const QString key = QUrl::toPercentEncoding(QUrl::fromLocalFile(tmp).toString());
+
+    ThumbnailManager mgr(3.0);
+    const QString before = mgr.cacheFile(key);
+    QFile file(tmp);
+    file.open(QIODevice::ReadWrite);
+    file.setFileTime(QDateTime::currentDateTime().addSecs(-3600), QFileDevice::FileModificationTime);
+    file.close();
+
+    EXPECT_NE(mgr.cacheFile(key), before);
+    EXPECT_TRUE(mgr.cacheFile(key).startsWith(mgr.cacheDir));
+    QFile::remove(tmp);
+}
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "stubext.h"
+#include "plugins/common/dfmplugin-burn/utils/virtualstaging.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+DPBURN_USE_NAMESPACE
+
+class UT_VirtualStaging : public testing::Test
+{
+protected:
+    virtual void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        sourceDir = tempDir.filePath("source");
+        stagingRoot = tempDir.filePath("_dev_sr0");
+        QDir().mkpath(sourceDir);
+        QDir().mkpath(stagingRoot);
+
+        // the temporary folder may be on a file system with reflinks
+        stub.set_lamda(&VirtualStaging::reflink, [] {
+            __DBG_STUB_INVOKE__
+            return false;
+        });
+    }
+    virtual void TearDown() override { stub.clear(); }
+
+    QString writeFile(const QString &path, const QByteArray &data)
+    {
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        QFile file(path);
+        file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+        file.write(data);
+        file.close();
+        return path;
+    }
+
+    static quint64 inode(const QString &path)
+    {
+        struct stat st;
+        return ::lstat(QFile::encodeName(path).constData(), &st) == 0 ? st.st_ino : 0;
+    }
+
+public:
+    stub_ext::StubExt stub;
+    QTemporaryDir tempDir;
+    QString sourceDir;
+    QString stagingRoot;
+};
+
+TEST_F(UT_VirtualStaging, Stage_File_LinksToSource)
+{
+    const QString &file = writeFile(sourceDir + "/a.txt", "hello");
+
+    VirtualStaging staging(stagingRoot);
+    QList<QUrl> stagedTargets;
+    const auto &rest = staging.stage({ QUrl::fromLocalFile(file) }, stagingRoot, nullptr, &stagedTargets);
+
+    EXPECT_TRUE(rest.isEmpty());
+    ASSERT_EQ(stagedTargets.size(), 1);
+    EXPECT_EQ(stagedTargets.first().toLocalFile(), stagingRoot + "/a.txt");
+    // never the source inode, a write to the staged file must not reach the source through it
+    EXPECT_NE(inode(stagingRoot + "/a.txt"), inode(file));
+    EXPECT_EQ(QFileInfo(stagingRoot + "/a.txt").symLinkTarget(), file);
+    ASSERT_EQ(staging.graftPoints().size(), 1);
+    EXPECT_EQ(staging.graftPoints().first().mode, VirtualStaging::Mode::kLink);
+    EXPECT_FALSE(staging.graftPoints().first().checksum.isEmpty());
+}
+
+TEST_F(UT_VirtualStaging, Stage_Folder_MirrorsTree)
+{
+    writeFile(sourceDir + "/dir/a.txt", "a");
+    writeFile(sourceDir + "/dir/sub/b.txt", "b");
+    QFile::link("a.txt", sourceDir + "/dir/link");
+
+    VirtualStaging staging(stagingRoot);
+    const auto &rest = staging.stage({ QUrl::fromLocalFile(sourceDir + "/dir") }, stagingRoot, nullptr, nullptr);
+
+    EXPECT_TRUE(rest.isEmpty());
+    EXPECT_TRUE(QFileInfo(stagingRoot + "/dir/sub").isDir());
+    EXPECT_EQ(QFileInfo(stagingRoot + "/dir/sub/b.txt").symLinkTarget(), sourceDir + "/dir/sub/b.txt");
+    EXPECT_EQ(QFileInfo(stagingRoot + "/dir/link").symLinkTarget(), stagingRoot + "/dir/a.txt");
+    EXPECT_EQ(staging.graftPoints().size(), 2);
+}
+
+TEST_F(UT_VirtualStaging, Stage_ExistingTargetOrLinkFailure_FallbackToCopy)
+{
+    const QString &exists = writeFile(sourceDir + "/exists.txt", "a");
+    writeFile(stagingRoot + "/exists.txt", "b");
+    writeFile(sourceDir + "/dir/a.txt", "a");
+
+    stub.set_lamda(::symlink, [] {
+        __DBG_STUB_INVOKE__
+        return -1;
+    });
+
+    VirtualStaging staging(stagingRoot);
+    const QList<QUrl> urls { QUrl::fromLocalFile(exists), QUrl::fromLocalFile(sourceDir + "/dir") };
+    EXPECT_EQ(staging.stage(urls, stagingRoot, nullptr, nullptr), urls);
+    // nothing half staged is left
+    EXPECT_FALSE(QFileInfo::exists(stagingRoot + "/dir"));
+    EXPECT_TRUE(staging.graftPoints().isEmpty());
+}
+
+TEST_F(UT_VirtualStaging, CanStage_CopyIntoItself_Refused)
+{
+    EXPECT_FALSE(VirtualStaging::canStage(QUrl::fromLocalFile(tempDir.path()), stagingRoot));
+    EXPECT_FALSE(VirtualStaging::canStage(QUrl("smb://host/share/a.txt"), stagingRoot));
+    EXPECT_FALSE(VirtualStaging::canStage(QUrl::fromLocalFile(sourceDir + "/missing"), stagingRoot));
+}
+
+TEST_F(UT_VirtualStaging, ModifiedFiles_SourceChangedAfterStaging)
+{
+    const QString &file = writeFile(sourceDir + "/a.txt", "hello");
+    const QString &other = writeFile(sourceDir + "/b.txt", "world");
+    {
+        VirtualStaging staging(stagingRoot);
+        staging.stage({ QUrl::fromLocalFile(file), QUrl::fromLocalFile(other) }, stagingRoot, nullptr, nullptr);
+    }
+
+    writeFile(file, "hello, changed");
+    // removed from the disc by the user, no longer recorded
+    QFile::remove(stagingRoot + "/b.txt");
+    writeFile(other, "world, changed");
+
+    VirtualStaging staging(stagingRoot);
+    EXPECT_EQ(staging.graftPoints().size(), 1);
+    EXPECT_EQ(staging.modifiedFiles(), QStringList { file });
+}
+
+TEST_F(UT_VirtualStaging, ModifiedFiles_SameSizeAndTime_ComparedByChecksum)
+{
+    const QString &file = writeFile(sourceDir + "/a.txt", "hello");
+    struct stat st;
+    ASSERT_EQ(::stat(QFile::encodeName(file).constData(), &st), 0);
+    VirtualStaging(stagingRoot).stage({ QUrl::fromLocalFile(file) }, stagingRoot, nullptr, nullptr);
+
+    writeFile(file, "jello");
+    const struct timespec times[2] { st.st_atim, st.st_mtim };
+    ASSERT_EQ(::utimensat(AT_FDCWD, QFile::encodeName(file).constData(), times, 0), 0);
+
+    EXPECT_EQ(VirtualStaging(stagingRoot).modifiedFiles(), QStringList { file });
+}
+
+TEST_F(UT_VirtualStaging, SetStaging_CountedPerRoot)
+{
+    EXPECT_FALSE(VirtualStaging::isStaging(stagingRoot));
+    VirtualStaging::setStaging(stagingRoot, true);
+    VirtualStaging::setStaging(stagingRoot + "/", true);
+    VirtualStaging::setStaging(stagingRoot, false);
+    EXPECT_TRUE(VirtualStaging::isStaging(stagingRoot));
+    VirtualStaging::setStaging(stagingRoot, false);
+    EXPECT_FALSE(VirtualStaging::isStaging(stagingRoot));
+}
+
+TEST_F(UT_VirtualStaging, Clear_RemovesRecords)
+{
+    const QString &file = writeFile(sourceDir + "/a.txt", "hello");
+    VirtualStaging(stagingRoot).stage({ QUrl::fromLocalFile(file) }, stagingRoot, nullptr, nullptr);
+    EXPECT_EQ(VirtualStaging(stagingRoot).graftPoints().size(), 1);
+
+    VirtualStaging::clear(stagingRoot);
+    EXPECT_TRUE(VirtualStaging(stagingRoot).graftPoints().isEmpty());
+}
@@ -184,6 +184,64 @@ TEST_F(TestFileOperateBaseWorker, CheckDiskSpaceAvailable_SufficientSpace)
     EXPECT_FALSE(skip);
 }
 
+// ========== checkStreamDiskSpaceAvailable Tests ==========
+
+TEST_F(TestFileOperateBaseWorker, CheckStreamDiskSpaceAvailable_NotStreaming)
+{
+    bool called = false;
+    stub.set_lamda(&DeviceUtils::deviceBytesFree, [&called](const QUrl &) -> qint64 {
+        __DBG_STUB_INVOKE__
+        called = true;
+        return 0;
+    });
+
+    worker->streamStatistics = false;
+    worker->statisticsFinished = true;
+    worker->sourceFilesTotalSize = 1024;
+
+    bool skip = false;
+    EXPECT_TRUE(worker->checkStreamDiskSpaceAvailable(QUrl(), tempDirUrl, &skip));
+    EXPECT_FALSE(called);
+}
+
+TEST_F(TestFileOperateBaseWorker, CheckStreamDiskSpaceAvailable_StatisticsRunning)
+{
+    bool called = false;
+    stub.set_lamda(&DeviceUtils::deviceBytesFree, [&called](const QUrl &) -> qint64 {
+        __DBG_STUB_INVOKE__
+        called = true;
+        return 0;
+    });
+
+    worker->streamStatistics = true;
+    worker->statisticsFinished = false;
+
+    bool skip = false;
+    EXPECT_TRUE(worker->checkStreamDiskSpaceAvailable(QUrl(), tempDirUrl, &skip));
+    EXPECT_FALSE(called);
+}
+
+TEST_F(TestFileOperateBaseWorker, CheckStreamDiskSpaceAvailable_CheckedOnce)
+{
+    int callCount = 0;
+    stub.set_lamda(&DeviceUtils::deviceBytesFree, [&callCount](const QUrl &) -> qint64 {
+        __DBG_STUB_INVOKE__
+        ++callCount;
+        return 1024 * 1024 * 1024;   // 1GB free
+    });
+
+    worker->targetOrgUrl = tempDirUrl;
+    worker->streamStatistics = true;
+    worker->statisticsFinished = true;
+    worker->sourceFilesTotalSize = 1024;
+
+    bool skip = false;
+    EXPECT_TRUE(worker->checkStreamDiskSpaceAvailable(QUrl(), tempDirUrl, &skip));
+    EXPECT_TRUE(worker->checkStreamDiskSpaceAvailable(QUrl(), tempDirUrl, &skip));
+    EXPECT_EQ(callCount, 1);
+    EXPECT_FALSE(skip);
+}
+
 // ========== checkFileSize Tests ==========
 
 TEST_F(TestFileOperateBaseWorker, CheckFileSize_SmallFile)
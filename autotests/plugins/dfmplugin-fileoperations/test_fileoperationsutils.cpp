@@ -16,6 +16,7 @@
 #include <dfm-base/file/local/syncfileinfo.h>
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/utils/fileutils.h>
+#include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 
 DFMBASE_USE_NAMESPACE
 using namespace dfmplugin_fileoperations;
@@ -324,6 +325,22 @@ TEST_F(TestFileOperationsUtils, BlockSync_ReturnsValue)
     SUCCEED();
 }
 
+// ========== FileOperationsUtils::streamStatistics() Tests ==========
+
+TEST_F(TestFileOperationsUtils, StreamStatistics_ReturnsValue)
+{
+    QVariant configured;
+    stub.set_lamda(&DConfigManager::value, [&configured](DConfigManager *, const QString &, const QString &, const QVariant &defaultValue) {
+        return configured.isValid() ? configured : defaultValue;
+    });
+
+    // Enabled unless configured otherwise
+    EXPECT_TRUE(FileOperationsUtils::streamStatistics());
+
+    configured = false;
+    EXPECT_FALSE(FileOperationsUtils::streamStatistics());
+}
+
 // ========== FileOperationsUtils::parentUrl() Tests ==========
 
 TEST_F(TestFileOperationsUtils, ParentUrl_HasParent)
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include <QFile>
+
+#include "fileoperations/fileoperationutils/integrityverifier.h"
+
+using namespace dfmplugin_fileoperations;
+
+class TestIntegrityVerifier : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        for (int i = 0; i < kBlockCount; ++i)
+            source.append(QByteArray(kBlockSize, static_cast<char>('a' + i)));
+        targetPath = tempDir.filePath("target");
+        QFile file(targetPath);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(source);
+    }
+
+    void addAll(IntegrityVerifier *verifier, const QByteArray &data)
+    {
+        for (int i = 0; i < kBlockCount; ++i)
+            verifier->addBlock(i * kBlockSize, data.constData() + i * kBlockSize, kBlockSize, i == kBlockCount - 1);
+    }
+
+    static constexpr int kBlockCount = 6;
+    static constexpr int kBlockSize = 64 * 1024 + 100;   // not aligned for O_DIRECT
+    QTemporaryDir tempDir;
+    QByteArray source;
+    QString targetPath;
+};
+
+TEST_F(TestIntegrityVerifier, AllBlocksMatch)
+{
+    std::atomic_int64_t verified { 0 };
+    IntegrityVerifier verifier(targetPath, 1, &verified);
+    addAll(&verifier, source);
+    EXPECT_TRUE(verifier.finish());
+    EXPECT_EQ(verified, source.size());
+}
+
+TEST_F(TestIntegrityVerifier, Mismatch)
+{
+    QByteArray other = source;
+    other[3 * kBlockSize + 10] = 'z';
+
+    IntegrityVerifier verifier(targetPath, 1, nullptr);
+    addAll(&verifier, other);
+    qint64 offset = -1;
+    EXPECT_FALSE(verifier.finish(&offset));
+    EXPECT_EQ(offset, 3 * kBlockSize);
+}
+
+TEST_F(TestIntegrityVerifier, SamplingSkipsBlocks)
+{
+    QByteArray other = source;
+    other[1 * kBlockSize] = 'z';
+
+    std::atomic_int64_t verified { 0 };
+    // blocks 0, 3 and the last one are checked
+    IntegrityVerifier verifier(targetPath, 3, &verified);
+    addAll(&verifier, other);
+    EXPECT_TRUE(verifier.finish());
+    EXPECT_EQ(verified, 3 * kBlockSize);
+}
+
+TEST_F(TestIntegrityVerifier, MissingTarget)
+{
+    IntegrityVerifier verifier(tempDir.filePath("missing"), 1, nullptr);
+    addAll(&verifier, source);
+    QString errorMsg;
+    EXPECT_FALSE(verifier.finish(nullptr, &errorMsg));
+    EXPECT_FALSE(errorMsg.isEmpty());
+}
+
+TEST_F(TestIntegrityVerifier, SingleBlock_VerifiedWithoutThread)
+{
+    std::atomic_int64_t verified { 0 };
+    IntegrityVerifier verifier(targetPath, 1, &verified);
+    verifier.addBlock(0, source.constData(), kBlockSize, true);
+    EXPECT_EQ(verifier.thread, nullptr);
+    EXPECT_TRUE(verifier.finish());
+    EXPECT_EQ(verified, kBlockSize);
+
+    IntegrityVerifier empty(targetPath, 1, nullptr);
+    EXPECT_TRUE(empty.finish());
+    EXPECT_EQ(empty.thread, nullptr);
+    EXPECT_EQ(empty.fd, -1);
+}
+
+TEST_F(TestIntegrityVerifier, SecondBlock_StartsThread)
+{
+    IntegrityVerifier verifier(targetPath, 1, nullptr);
+    verifier.addBlock(0, source.constData(), kBlockSize);
+    verifier.addBlock(kBlockSize, source.constData() + kBlockSize, kBlockSize);
+    EXPECT_NE(verifier.thread, nullptr);
+    EXPECT_TRUE(verifier.finish());
+}
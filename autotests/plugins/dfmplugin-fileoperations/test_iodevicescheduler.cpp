@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+#include <QUrl>
+#include <QThread>
+#include <QAtomicInt>
+
+#include "stubext.h"
+
+#include "fileoperations/fileoperationutils/iodevicescheduler.h"
+
+using namespace dfmplugin_fileoperations;
+
+class TestIoDeviceScheduler : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        stub.clear();
+        // /hdd 在机械盘上，/ssd 在固态盘上，其余路径不调度
+        stub.set_lamda(&IoDeviceScheduler::classify, [](const QString &path) {
+            __DBG_STUB_INVOKE__
+            IoDeviceScheduler::Device device;
+            if (path.startsWith("/hdd")) {
+                device.id = 0x801;
+                device.kind = IoDeviceScheduler::DeviceKind::kRotational;
+                device.name = "sda";
+            } else if (path.startsWith("/ssd")) {
+                device.id = 0x10301;
+                device.kind = IoDeviceScheduler::DeviceKind::kSolidState;
+                device.name = "nvme0n1";
+            }
+            return device;
+        });
+    }
+
+    void TearDown() override
+    {
+        stub.clear();
+    }
+
+    IoTicketPointer ticket(const QString &from, const QString &to)
+    {
+        return IoDeviceScheduler::instance()->createTicket({ QUrl::fromLocalFile(from), QUrl::fromLocalFile(to) });
+    }
+
+    stub_ext::StubExt stub;
+};
+
+TEST_F(TestIoDeviceScheduler, TokenCount)
+{
+    EXPECT_EQ(IoDeviceScheduler::tokenCount(IoDeviceScheduler::DeviceKind::kRotational), 1);
+    EXPECT_EQ(IoDeviceScheduler::tokenCount(IoDeviceScheduler::DeviceKind::kSolidState), 4);
+    EXPECT_EQ(IoDeviceScheduler::tokenCount(IoDeviceScheduler::DeviceKind::kUnknown), 0);
+}
+
+TEST_F(TestIoDeviceScheduler, UnknownDeviceNotScheduled)
+{
+    auto t = ticket("/proc/a", "/tmp/b");
+    EXPECT_TRUE(t->isEmpty());
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(t, nullptr, nullptr));
+}
+
+TEST_F(TestIoDeviceScheduler, SolidStateRunsConcurrently)
+{
+    auto first = ticket("/ssd/a", "/ssd/b");
+    auto second = ticket("/ssd/c", "/ssd/d");
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(first, nullptr, nullptr));
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(second, nullptr, nullptr));
+    EXPECT_TRUE(first->isGranted());
+    EXPECT_TRUE(second->isGranted());
+    EXPECT_FALSE(first->hasRotational());
+}
+
+TEST_F(TestIoDeviceScheduler, RotationalQueued)
+{
+    auto first = ticket("/hdd/a", "/ssd/b");
+    ASSERT_TRUE(IoDeviceScheduler::instance()->acquire(first, nullptr, nullptr));
+    EXPECT_TRUE(first->hasRotational());
+
+    auto second = ticket("/ssd/c", "/hdd/d");
+    QList<int> positions;
+    QThread *thread = QThread::create([&] {
+        IoDeviceScheduler::instance()->acquire(second, nullptr, [&positions](int ahead, const QString &) {
+            positions.append(ahead);
+        });
+    });
+    thread->start();
+    QThread::msleep(100);
+    EXPECT_FALSE(second->isGranted());
+
+    first.reset();
+    ASSERT_TRUE(thread->wait(2000));
+    delete thread;
+
+    EXPECT_TRUE(second->isGranted());
+    ASSERT_EQ(positions.size(), 2);
+    EXPECT_EQ(positions.first(), 1);
+    EXPECT_EQ(positions.last(), -1);
+}
+
+TEST_F(TestIoDeviceScheduler, CancelledWhileQueued)
+{
+    auto first = ticket("/hdd/a", "/hdd/b");
+    ASSERT_TRUE(IoDeviceScheduler::instance()->acquire(first, nullptr, nullptr));
+
+    auto second = ticket("/hdd/c", "/hdd/d");
+    EXPECT_FALSE(IoDeviceScheduler::instance()->acquire(second, [] { return true; }, nullptr));
+    EXPECT_FALSE(second->isGranted());
+
+    // 取消的任务不再占用队列
+    first.reset();
+    auto third = ticket("/hdd/e", "/hdd/f");
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(third, nullptr, nullptr));
+}
+
+TEST_F(TestIoDeviceScheduler, SuspendedWhilePaused)
+{
+    auto first = ticket("/hdd/a", "/hdd/b");
+    ASSERT_TRUE(IoDeviceScheduler::instance()->acquire(first, nullptr, nullptr));
+
+    // 暂停的任务归还令牌，排队的任务可以开始
+    IoDeviceScheduler::instance()->suspend(first);
+    EXPECT_FALSE(first->isGranted());
+    auto second = ticket("/hdd/c", "/hdd/d");
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(second, nullptr, nullptr));
+
+    // 继续时重新排队，两个线程一起等待同一凭证
+    QList<QThread *> threads;
+    for (int i = 0; i < 2; ++i) {
+        threads.append(QThread::create([&first] {
+            IoDeviceScheduler::instance()->checkpoint(first, nullptr, nullptr);
+        }));
+        threads.last()->start();
+    }
+    QThread::msleep(100);
+    EXPECT_FALSE(first->isGranted());
+
+    second.reset();
+    for (QThread *thread : threads) {
+        EXPECT_TRUE(thread->wait(2000));
+        delete thread;
+    }
+    EXPECT_TRUE(first->isGranted());
+
+    first.reset();
+    auto third = ticket("/hdd/e", "/hdd/f");
+    EXPECT_TRUE(IoDeviceScheduler::instance()->acquire(third, nullptr, nullptr));
+}
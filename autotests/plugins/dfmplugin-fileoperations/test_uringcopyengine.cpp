@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QRandomGenerator>
+
+#include "stubext.h"
+
+#include "fileoperations/fileoperationutils/uringcopyengine.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#ifdef DFM_HAVE_LIBURING
+#    include <liburing.h>
+#endif
+
+using namespace dfmplugin_fileoperations;
+
+class TestUringCopyEngine : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!UringCopyEngine::isSupported())
+            GTEST_SKIP() << "io_uring is not available";
+
+        ASSERT_TRUE(tempDir.isValid());
+        // 不是块大小整数倍，最后一块是短块
+        source.resize(5 * 1024 * 1024 + 1234);
+        QRandomGenerator::global()->fillRange(reinterpret_cast<quint32 *>(source.data()), source.size() / 4);
+        QFile file(tempDir.filePath("source"));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(source);
+        file.close();
+
+        srcFd = open(QFile::encodeName(tempDir.filePath("source")).constData(), O_RDONLY);
+        dstFd = open(QFile::encodeName(tempDir.filePath("target")).constData(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        ASSERT_GE(srcFd, 0);
+        ASSERT_GE(dstFd, 0);
+    }
+
+    void TearDown() override
+    {
+        if (srcFd >= 0)
+            close(srcFd);
+        if (dstFd >= 0)
+            close(dstFd);
+    }
+
+    QByteArray target()
+    {
+        QFile file(tempDir.filePath("target"));
+        file.open(QIODevice::ReadOnly);
+        return file.readAll();
+    }
+
+    QTemporaryDir tempDir;
+    QByteArray source;
+    int srcFd { -1 };
+    int dstFd { -1 };
+};
+
+TEST_F(TestUringCopyEngine, Copy)
+{
+    UringCopyEngine engine;
+    ASSERT_TRUE(engine.isValid());
+
+    UringCopyEngine::Progress progress;
+    qint64 written = 0;
+    int error = 0;
+    auto result = engine.copy(srcFd, dstFd, source.size(), &progress, true, nullptr,
+                              [&written](qint64 size) { written += size; }, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kFinished);
+    EXPECT_EQ(progress.copied, source.size());
+    EXPECT_EQ(written, source.size());
+    EXPECT_EQ(progress.checksum, adler32(adler32(0L, nullptr, 0), reinterpret_cast<const Bytef *>(source.constData()), source.size()));
+    EXPECT_EQ(target(), source);
+}
+
+TEST_F(TestUringCopyEngine, ResumeAfterInterrupted)
+{
+    UringCopyEngine engine;
+    ASSERT_TRUE(engine.isValid());
+
+    UringCopyEngine::Progress progress;
+    int error = 0;
+    int calls = 0;
+    auto result = engine.copy(srcFd, dstFd, source.size(), &progress, true,
+                              [&calls] { return ++calls == 1; }, nullptr, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kInterrupted);
+    EXPECT_LT(progress.copied, source.size());
+
+    result = engine.copy(srcFd, dstFd, source.size(), &progress, true, nullptr, nullptr, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kFinished);
+    EXPECT_EQ(progress.checksum, adler32(adler32(0L, nullptr, 0), reinterpret_cast<const Bytef *>(source.constData()), source.size()));
+    EXPECT_EQ(target(), source);
+}
+
+TEST_F(TestUringCopyEngine, ReadError)
+{
+    UringCopyEngine engine;
+    ASSERT_TRUE(engine.isValid());
+
+    UringCopyEngine::Progress progress;
+    int error = 0;
+    // 写端打开的描述符不能读
+    auto result = engine.copy(dstFd, dstFd, source.size(), &progress, false, nullptr, nullptr, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kReadError);
+    EXPECT_EQ(error, EBADF);
+    EXPECT_EQ(progress.copied, 0);
+}
+
+#ifdef DFM_HAVE_LIBURING
+TEST_F(TestUringCopyEngine, SubmitBusy_Retried)
+{
+    UringCopyEngine engine;
+    ASSERT_TRUE(engine.isValid());
+
+    // 前两次提交时内核暂时没有资源
+    int busy = 2;
+    stub_ext::StubExt stub;
+    stub.set_lamda(io_uring_submit_and_wait, [&busy](struct io_uring *ring, unsigned waitNr) {
+        __DBG_STUB_INVOKE__
+        if (busy-- > 0)
+            return busy == 0 ? -EBUSY : -EAGAIN;
+        const int ret = io_uring_submit(ring);
+        struct io_uring_cqe *cqe = nullptr;
+        if (ret >= 0 && waitNr > 0)
+            io_uring_wait_cqe(ring, &cqe);
+        return ret;
+    });
+
+    UringCopyEngine::Progress progress;
+    int error = 0;
+    auto result = engine.copy(srcFd, dstFd, source.size(), &progress, false, nullptr, nullptr, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kFinished);
+    EXPECT_EQ(error, 0);
+    EXPECT_EQ(target(), source);
+}
+
+TEST_F(TestUringCopyEngine, SubmitAlwaysBusy_Stops)
+{
+    UringCopyEngine engine;
+    ASSERT_TRUE(engine.isValid());
+
+    // 内核一直不接收请求，不能一直重试
+    int submits = 0;
+    stub_ext::StubExt stub;
+    stub.set_lamda(io_uring_submit_and_wait, [&submits](struct io_uring *, unsigned) {
+        __DBG_STUB_INVOKE__
+        ++submits;
+        return -EBUSY;
+    });
+    stub.set_lamda(usleep, [](useconds_t) {
+        __DBG_STUB_INVOKE__
+        return 0;
+    });
+
+    UringCopyEngine::Progress progress;
+    int error = 0;
+    auto result = engine.copy(srcFd, dstFd, source.size(), &progress, false, nullptr, nullptr, &error);
+    EXPECT_EQ(result, UringCopyEngine::Result::kReadError);
+    EXPECT_EQ(error, EBUSY);
+    EXPECT_GT(submits, 1);
+    EXPECT_EQ(progress.copied, 0);
+    // 队列里留着未提交的请求，之后的文件走同步读写
+    EXPECT_FALSE(engine.isValid());
+}
+#endif
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "stubext.h"
+#include "oemmenuscene/oemactionmatcher.h"
+
+#include <gtest/gtest.h>
+
+#include <QAction>
+
+using namespace dfmplugin_menu;
+
+class UT_OemActionMatcher : public testing::Test
+{
+protected:
+    virtual void TearDown() override
+    {
+        qDeleteAll(actions);
+        actions.clear();
+        stub.clear();
+    }
+
+    QAction *addAction(const QString &text, const QMap<QString, QStringList> &properties = {})
+    {
+        QAction *action = new QAction(text);
+        for (auto it = properties.cbegin(); it != properties.cend(); ++it)
+            action->setProperty(it.key().toLocal8Bit().constData(), it.value());
+        actions.append(action);
+        return action;
+    }
+
+    static OemActionMatcher::FileKey key(const QString &mimeType, const QString &suffix = {},
+                                         const QString &scheme = "file", bool isDir = false)
+    {
+        OemActionMatcher::FileKey key;
+        key.mimeType = mimeType;
+        key.suffix = suffix;
+        key.scheme = scheme;
+        key.isDir = isDir;
+        return key;
+    }
+
+    QList<QAction *> match(const OemActionMatcher::FileKey &fileKey, bool onDesktop = false, bool allEx7z = false)
+    {
+        return matcher.filter(actions, matcher.evaluate(fileKey, onDesktop, allEx7z));
+    }
+
+protected:
+    QList<QAction *> actions;
+    OemActionMatcher matcher;
+    stub_ext::StubExt stub;
+};
+
+TEST_F(UT_OemActionMatcher, Evaluate_NoMimeRule_MatchesAnyType)
+{
+    QAction *any = addAction("any");
+    matcher.compile(actions);
+
+    EXPECT_EQ(match(key("text/plain")), QList<QAction *> { any });
+    EXPECT_EQ(match(key("image/png")), QList<QAction *> { any });
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_MimeRule_ExactWildcardAndParent)
+{
+    QAction *text = addAction("text", { { "MimeType", { "text/plain" } } });
+    QAction *image = addAction("image", { { "MimeType", { "image/*" } } });
+    matcher.compile(actions);
+
+    EXPECT_EQ(match(key("text/plain")), QList<QAction *> { text });
+    EXPECT_EQ(match(key("image/png")), QList<QAction *> { image });
+    // text/x-csrc inherits text/plain
+    EXPECT_EQ(match(key("text/x-csrc")), QList<QAction *> { text });
+    EXPECT_TRUE(match(key("application/pdf")).isEmpty());
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_ExcludeMimeType_IgnoresParents)
+{
+    QAction *action = addAction("action", { { "X-DFM-ExcludeMimeTypes", { "text/plain" } } });
+    matcher.compile(actions);
+
+    EXPECT_TRUE(match(key("text/plain")).isEmpty());
+    EXPECT_EQ(match(key("text/x-csrc")), QList<QAction *> { action });
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_NotShowIn_DependsOnPlace)
+{
+    addAction("desktop", { { "X-DDE-FileManager-NotShowIn", { "Desktop" } } });
+    addAction("filemanager", { { "X-DFM-NotShowIn", { "Filemanager" } } });
+    matcher.compile(actions);
+
+    const auto &onDesktop = match(key("text/plain"), true);
+    ASSERT_EQ(onDesktop.size(), 1);
+    EXPECT_EQ(onDesktop.first()->text(), "filemanager");
+
+    const auto &inFileManager = match(key("text/plain"), false);
+    ASSERT_EQ(inFileManager.size(), 1);
+    EXPECT_EQ(inFileManager.first()->text(), "desktop");
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_SupportSchemes_CaseInsensitive)
+{
+    QAction *action = addAction("action", { { "X-DFM-SupportSchemes", { "File", "smb" } } });
+    matcher.compile(actions);
+
+    EXPECT_EQ(match(key("text/plain", {}, "file")), QList<QAction *> { action });
+    EXPECT_TRUE(match(key("text/plain", {}, "ftp")).isEmpty());
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_SupportSuffix_WildcardAndDir)
+{
+    QAction *action = addAction("action", { { "X-DFM-SupportSuffix", { "7z.*", "txt" } } });
+    matcher.compile(actions);
+
+    EXPECT_EQ(match(key("text/plain", "txt")), QList<QAction *> { action });
+    EXPECT_EQ(match(key("application/octet-stream", "7z.001")), QList<QAction *> { action });
+    EXPECT_TRUE(match(key("image/png", "png")).isEmpty());
+    // directories are not filtered by suffix
+    EXPECT_EQ(match(key("inode/directory", {}, "file", true)), QList<QAction *> { action });
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_AllEx7z_HidesActionsWithoutSuffixRule)
+{
+    QAction *volume = addAction("volume", { { "X-DFM-SupportSuffix", { "7z.*" } } });
+    addAction("any");
+    matcher.compile(actions);
+
+    EXPECT_EQ(match(key("application/octet-stream", "7z.001"), false, true), QList<QAction *> { volume });
+}
+
+TEST_F(UT_OemActionMatcher, Evaluate_CompressOnFtp_Hidden)
+{
+    addAction(QObject::tr("Compress"));
+    matcher.compile(actions);
+
+    OemActionMatcher::FileKey ftpKey = key("text/plain", {}, "ftp");
+    ftpKey.isFtp = true;
+    EXPECT_TRUE(match(ftpKey).isEmpty());
+    EXPECT_EQ(match(key("text/plain")).size(), 1);
+}
+
+TEST_F(UT_OemActionMatcher, Filter_IntersectionOfKeys)
+{
+    QAction *text = addAction("text", { { "MimeType", { "text/*" } } });
+    addAction("image", { { "MimeType", { "image/*" } } });
+    QAction *any = addAction("any");
+    matcher.compile(actions);
+
+    QBitArray valid = matcher.allActions();
+    valid &= matcher.evaluate(key("text/plain"), false, false);
+    EXPECT_EQ(matcher.filter(actions, valid), (QList<QAction *> { text, any }));
+
+    valid &= matcher.evaluate(key("image/png"), false, false);
+    EXPECT_EQ(matcher.filter(actions, valid), QList<QAction *> { any });
+}
+
+TEST_F(UT_OemActionMatcher, Filter_UnknownAction_Dropped)
+{
+    addAction("known");
+    matcher.compile(actions);
+
+    QAction unknown("unknown");
+    EXPECT_TRUE(matcher.filter({ &unknown }, matcher.allActions()).isEmpty());
+}
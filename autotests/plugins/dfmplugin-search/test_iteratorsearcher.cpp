@@ -601,6 +601,54 @@ TEST_F(TestIteratorSearcher, ProcessDirectory_WithMultiplePendingDirs_ProcessesI
     EXPECT_EQ(requestedUrl, url1);
 }
 
+TEST_F(TestIteratorSearcher, ProcessDirectory_Paused_KeepsPendingDirs)
+{
+    setupBasicStubs();
+
+    searcher = new IteratorSearcher(searchUrl, keyword);
+    searcher->status.storeRelease(AbstractSearcher::kRuning);
+    searcher->pendingDirs.enqueue(searchUrl);
+    searcher->pause();
+
+    QSignalSpy requestSpy(searcher, &IteratorSearcher::requestCreateIterator);
+    QSignalSpy nextSpy(searcher, &IteratorSearcher::requestProcessNextDirectory);
+
+    searcher->processDirectory();
+    EXPECT_EQ(requestSpy.count(), 0);
+    EXPECT_EQ(searcher->pendingDirs.size(), 1);
+
+    searcher->resume();
+    EXPECT_EQ(nextSpy.count(), 1);
+}
+
+TEST_F(TestIteratorSearcher, OnIteratorCreated_Paused_DirectoryRequeued)
+{
+    setupBasicStubs();
+
+    searcher = new IteratorSearcher(searchUrl, "file");
+    searcher->status.storeRelease(AbstractSearcher::kRuning);
+    searcher->pendingDirs.enqueue(searchUrl);
+    searcher->processDirectory();
+    searcher->pause();
+
+    MockDirIterator *mockIter = new MockDirIterator(searchUrl);
+    mockIter->m_mockUrls.clear();
+    mockIter->m_mockInfos.clear();
+    mockIter->addMockEntry(QUrl::fromLocalFile("/home/test/file1.txt"), false, false, "file1.txt");
+    mockIter->m_currentIndex = 0;
+
+    QSignalSpy nextSpy(searcher, &IteratorSearcher::requestProcessNextDirectory);
+
+    // the iterator was requested before the pause, nothing is read from it
+    searcher->onIteratorCreated(QSharedPointer<AbstractDirIterator>(mockIter));
+    EXPECT_FALSE(searcher->hasItem());
+    EXPECT_EQ(searcher->pendingDirs, QQueue<QUrl>({ searchUrl }));
+    EXPECT_EQ(nextSpy.count(), 0);
+
+    searcher->resume();
+    EXPECT_EQ(nextSpy.count(), 1);
+}
+
 // ========== OnIteratorCreated Tests ==========
 TEST_F(TestIteratorSearcher, OnIteratorCreated_NotRunning_IgnoresIterator)
 {
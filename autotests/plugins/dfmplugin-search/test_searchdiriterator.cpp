@@ -11,6 +11,7 @@
 #include "iterator/searchdiriterator.h"
 #include "iterator/searchdiriterator_p.h"
 #include "utils/searchhelper.h"
+#include "searchmanager/searchmanager.h"
 
 #include <dfm-base/interfaces/abstractdiriterator.h>
 #include <dfm-base/interfaces/fileinfo.h>
@@ -264,3 +265,111 @@ TEST_F(TestSearchDirIterator, IteratorCycle_WorksCorrectly)
 
     EXPECT_GT(callCount, 0);
 }
+
+TEST_F(TestSearchDirIterator, CreateSortInfos_WithMetadata_CompletedWithoutStat)
+{
+    const QUrl url = QUrl::fromLocalFile("/home/test/keyword.txt");
+    DFMSearchResult result(url);
+    DFMSearchFileMetadata metadata;
+    metadata.size = 1024;
+    metadata.isFile = true;
+    metadata.lastModified = 1700000000;
+    result.setMetadata(metadata);
+
+    bool statCalled = false;
+    stub.set_lamda(&SearchDirIterator::doCompleteSortInfo, [&statCalled](SearchDirIterator *, SortInfoPointer) {
+        __DBG_STUB_INVOKE__
+        statCalled = true;
+    });
+
+    DFMSearchResultMap results;
+    results.insert(url, result);
+    const auto &infos = iterator->createSortInfos(results);
+
+    ASSERT_EQ(infos.size(), 1);
+    EXPECT_FALSE(statCalled);
+    EXPECT_TRUE(infos.first()->isInfoCompleted());
+    EXPECT_EQ(infos.first()->fileSize(), 1024);
+    EXPECT_EQ(infos.first()->lastModifiedTime(), 1700000000);
+}
+
+TEST_F(TestSearchDirIterator, CreateSortInfos_DeliveredResults_Skipped)
+{
+    int statCount = 0;
+    stub.set_lamda(&SearchDirIterator::doCompleteSortInfo, [&statCount](SearchDirIterator *, SortInfoPointer) {
+        __DBG_STUB_INVOKE__
+        ++statCount;
+    });
+
+    DFMSearchResultMap results;
+    for (int i = 0; i < 100; ++i) {
+        const QUrl url = QUrl::fromLocalFile(QString("/home/test/keyword%1.txt").arg(i));
+        results.insert(url, DFMSearchResult(url));
+    }
+
+    EXPECT_EQ(iterator->createSortInfos(results).size(), 100);
+    EXPECT_EQ(statCount, 100);
+
+    // the next notification carries the full result set again
+    const QUrl changed = QUrl::fromLocalFile("/home/test/keyword0.txt");
+    results[changed].setHighlightedContent("keyword in content");
+    const auto &infos = iterator->createSortInfos(results);
+    ASSERT_EQ(infos.size(), 1);
+    EXPECT_EQ(infos.first()->fileUrl(), changed);
+    EXPECT_EQ(statCount, 101);
+}
+
+TEST_F(TestSearchDirIterator, CreateSortInfos_WithdrawnResults_Pruned)
+{
+    stub.set_lamda(&SearchDirIterator::doCompleteSortInfo, [](SearchDirIterator *, SortInfoPointer) {
+        __DBG_STUB_INVOKE__
+    });
+
+    const QUrl kept = QUrl::fromLocalFile("/home/test/keyword.txt");
+    const QUrl dropped = QUrl::fromLocalFile("/home/test/key.txt");
+    DFMSearchResultMap results;
+    results.insert(kept, DFMSearchResult(kept));
+    results.insert(dropped, DFMSearchResult(dropped));
+    EXPECT_EQ(iterator->createSortInfos(results).size(), 2);
+
+    results.remove(dropped);
+    EXPECT_TRUE(iterator->createSortInfos(results).isEmpty());
+    EXPECT_EQ(iterator->d->deliveredResults.size(), 1);
+    EXPECT_FALSE(iterator->d->deliveredResults.contains(dropped));
+
+    // a withdrawn result that matches again is sent again
+    results.insert(dropped, DFMSearchResult(dropped));
+    const auto &infos = iterator->createSortInfos(results);
+    ASSERT_EQ(infos.size(), 1);
+    EXPECT_EQ(infos.first()->fileUrl(), dropped);
+}
+
+TEST_F(TestSearchDirIterator, OnMatched_MissingResults_Withdrawn)
+{
+    const QUrl kept = QUrl::fromLocalFile("/home/test/keyword.txt");
+    const QUrl dropped = QUrl::fromLocalFile("/home/test/key.txt");
+    DFMSearchResultMap results;
+    results.insert(kept, DFMSearchResult(kept));
+    results.insert(dropped, DFMSearchResult(dropped));
+    stub.set_lamda(&SearchManager::matchedResults, [&results](SearchManager *, const QString &) {
+        __DBG_STUB_INVOKE__
+        return results;
+    });
+
+    QSignalSpy spy(SearchManager::instance(), &SearchManager::resultsWithdrawn);
+    iterator->d->taskId = "withdraw_task";
+    iterator->d->onMatched("withdraw_task");
+    EXPECT_EQ(spy.count(), 0);
+
+    results.remove(dropped);
+    iterator->d->onMatched("withdraw_task");
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toUrl(), searchUrl);
+    EXPECT_EQ(spy.at(0).at(1).value<QList<QUrl>>(), QList<QUrl> { dropped });
+
+    // every result filtered out by the refined keyword
+    results.clear();
+    iterator->d->onMatched("withdraw_task");
+    ASSERT_EQ(spy.count(), 2);
+    EXPECT_EQ(spy.at(1).at(1).value<QList<QUrl>>(), QList<QUrl> { kept });
+}
@@ -15,6 +15,7 @@
 #include "stubext.h"
 
 #include <gtest/gtest.h>
+#include <QSignalSpy>
 
 DPSEARCH_USE_NAMESPACE
 DFMBASE_USE_NAMESPACE
@@ -126,3 +127,18 @@ TEST(SearchFileWatcherPrivateTest, ut_stop)
 
     EXPECT_TRUE(watcher.dptr->stop());
 }
+
+TEST(SearchFileWatcherTest, ut_handleResultsWithdrawn)
+{
+    const QUrl searchUrl = SearchHelper::fromSearchFile(QUrl::fromLocalFile("/home/test"), "keyword", "123");
+    SearchFileWatcher watcher(searchUrl);
+    QSignalSpy spy(&watcher, &AbstractFileWatcher::fileDeleted);
+
+    const QUrl file = QUrl::fromLocalFile("/home/test/key.txt");
+    watcher.handleResultsWithdrawn(SearchHelper::fromSearchFile(QUrl::fromLocalFile("/home/test"), "key", "123"), { file });
+    EXPECT_EQ(spy.count(), 0);
+
+    watcher.handleResultsWithdrawn(searchUrl, { file });
+    ASSERT_EQ(spy.count(), 1);
+    EXPECT_EQ(spy.at(0).at(0).toUrl(), file);
+}
@@ -198,6 +198,27 @@ TEST_F(TestSearchHelper, CheckWildcardAndToRegularExpression_WithQuestionMark_Re
     EXPECT_TRUE(result.contains("txt"));
 }
 
+TEST_F(TestSearchHelper, IsRefinedKeyword_LongerKeywordContainingPrevious_ReturnsTrue)
+{
+    EXPECT_TRUE(SearchHelper::isRefinedKeyword("repo", "report"));
+    EXPECT_TRUE(SearchHelper::isRefinedKeyword("port", "Report"));
+}
+
+TEST_F(TestSearchHelper, IsRefinedKeyword_NotNarrowing_ReturnsFalse)
+{
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("report", "repo"));
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("repo", "repo"));
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("repo", "rexpo"));
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("", "repo"));
+}
+
+TEST_F(TestSearchHelper, IsRefinedKeyword_WildcardOrMultiKeyword_ReturnsFalse)
+{
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("re*", "re*port"));
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("repo", "repo?"));
+    EXPECT_FALSE(SearchHelper::isRefinedKeyword("repo", "repo rt"));
+}
+
 TEST_F(TestSearchHelper, WildcardToRegularExpression_WithAsterisk_ReturnsCorrectRegex)
 {
     QString pattern = "*.txt";
@@ -184,6 +184,139 @@ TEST_F(UT_SearchManager, Stop_WithWindowId_StopsAssociatedTask)
     EXPECT_EQ(spy.count(), 1);
 }
 
+TEST_F(UT_SearchManager, Search_NarrowedKeyword_RefinesPreviousTask)
+{
+    quint64 winId = 54321;
+    QUrl url = QUrl::fromLocalFile("/home/test");
+
+    int doSearchCount = 0;
+    stub.set_lamda(ADDR(MainController, doSearchTask),
+                   [&doSearchCount](MainController *, const QString &, const QUrl &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       ++doSearchCount;
+                       return true;
+                   });
+
+    QStringList refined;
+    stub.set_lamda(ADDR(MainController, refineTask),
+                   [&refined](MainController *, const QString &oldId, const QString &id, const QString &keyword) -> bool {
+                       __DBG_STUB_INVOKE__
+                       refined << oldId << id << keyword;
+                       return true;
+                   });
+
+    EXPECT_TRUE(manager->search(winId, "refine_task_001", url, "repo"));
+    EXPECT_TRUE(manager->search(winId, "refine_task_002", url, "report"));
+
+    EXPECT_EQ(doSearchCount, 1);
+    EXPECT_EQ(refined, (QStringList { "refine_task_001", "refine_task_002", "report" }));
+
+    // the old iterator closing does not stop the task it handed over
+    bool stopCalled = false;
+    stub.set_lamda(ADDR(MainController, stop), [&stopCalled](MainController *, const QString &) {
+        __DBG_STUB_INVOKE__
+        stopCalled = true;
+    });
+    manager->stop(QString("refine_task_001"));
+    EXPECT_FALSE(stopCalled);
+}
+
+TEST_F(UT_SearchManager, Search_DifferentKeyword_StartsNewTask)
+{
+    quint64 winId = 54322;
+    QUrl url = QUrl::fromLocalFile("/home/test");
+
+    int doSearchCount = 0;
+    stub.set_lamda(ADDR(MainController, doSearchTask),
+                   [&doSearchCount](MainController *, const QString &, const QUrl &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       ++doSearchCount;
+                       return true;
+                   });
+
+    bool refineCalled = false;
+    stub.set_lamda(ADDR(MainController, refineTask),
+                   [&refineCalled](MainController *, const QString &, const QString &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       refineCalled = true;
+                       return true;
+                   });
+
+    manager->search(winId, "refine_task_003", url, "report");
+    manager->search(winId, "refine_task_004", url, "repo");
+    manager->search(winId, "refine_task_005", QUrl::fromLocalFile("/home/other"), "repository");
+
+    EXPECT_FALSE(refineCalled);
+    EXPECT_EQ(doSearchCount, 3);
+}
+
+TEST_F(UT_SearchManager, Stop_RefinableTask_ParkedUntilNextSearch)
+{
+    quint64 winId = 54323;
+    QUrl url = QUrl::fromLocalFile("/home/test");
+
+    stub.set_lamda(ADDR(MainController, doSearchTask),
+                   [](MainController *, const QString &, const QUrl &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       return true;
+                   });
+    QString pausedTask;
+    stub.set_lamda(ADDR(MainController, pauseTask), [&pausedTask](MainController *, const QString &taskId) -> bool {
+        __DBG_STUB_INVOKE__
+        pausedTask = taskId;
+        return true;
+    });
+    bool stopCalled = false;
+    stub.set_lamda(ADDR(MainController, stop), [&stopCalled](MainController *, const QString &) {
+        __DBG_STUB_INVOKE__
+        stopCalled = true;
+    });
+    QString refinedFrom;
+    stub.set_lamda(ADDR(MainController, refineTask),
+                   [&refinedFrom](MainController *, const QString &oldId, const QString &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       refinedFrom = oldId;
+                       return true;
+                   });
+
+    QSignalSpy spy(manager, &SearchManager::searchStoped);
+    manager->search(winId, "refine_task_006", url, "repo");
+    manager->stop(QString("refine_task_006"));
+
+    EXPECT_FALSE(stopCalled);
+    EXPECT_EQ(pausedTask, QString("refine_task_006"));
+    EXPECT_EQ(spy.count(), 1);
+
+    manager->search(winId, "refine_task_007", url, "repor");
+    EXPECT_EQ(refinedFrom, QString("refine_task_006"));
+}
+
+TEST_F(UT_SearchManager, Stop_TaskCannotPause_Stopped)
+{
+    quint64 winId = 54324;
+
+    stub.set_lamda(ADDR(MainController, doSearchTask),
+                   [](MainController *, const QString &, const QUrl &, const QString &) -> bool {
+                       __DBG_STUB_INVOKE__
+                       return true;
+                   });
+    stub.set_lamda(ADDR(MainController, pauseTask), [](MainController *, const QString &) -> bool {
+        __DBG_STUB_INVOKE__
+        return false;
+    });
+    QString stoppedTask;
+    stub.set_lamda(ADDR(MainController, stop), [&stoppedTask](MainController *, const QString &taskId) {
+        __DBG_STUB_INVOKE__
+        stoppedTask = taskId;
+    });
+
+    manager->search(winId, "refine_task_008", QUrl::fromLocalFile("/home/test"), "repo");
+    manager->stop(QString("refine_task_008"));
+
+    EXPECT_EQ(stoppedTask, QString("refine_task_008"));
+    EXPECT_FALSE(manager->parkedTaskMap.contains(winId));
+}
+
 TEST_F(UT_SearchManager, OnDConfigValueChanged_WithSearchConfig_EmitsSignal)
 {
     QString config = DConfig::kSearchCfgPath;
@@ -464,3 +464,80 @@ TEST_F(TestSimplifiedSearchWorker, ResultMerging_HandlesScorePriority)
 
     EXPECT_TRUE(true);
 }
+
+TEST_F(TestSimplifiedSearchWorker, RefineSearch_CompletedSearch_FiltersResultsAndCompletes)
+{
+    const QUrl report = QUrl::fromLocalFile("/home/test/report.txt");
+    const QUrl repo = QUrl::fromLocalFile("/home/test/repo.txt");
+    const QUrl desktop = QUrl::fromLocalFile("/home/test/tool.desktop");
+    worker->resultMap.insert(report, DFMSearchResult(report));
+    worker->resultMap.insert(repo, DFMSearchResult(repo));
+    DFMSearchResult named(desktop);
+    named.setMatchedName("Report Tool");
+    worker->resultMap.insert(desktop, named);
+
+    QSignalSpy updatedSpy(worker, &SimplifiedSearchWorker::resultsUpdated);
+    QSignalSpy completedSpy(worker, &SimplifiedSearchWorker::searchCompleted);
+
+    worker->refineSearch("refined_task", "report");
+
+    EXPECT_EQ(worker->getResultUrls(), (QList<QUrl> { report, desktop }));
+    ASSERT_EQ(updatedSpy.count(), 1);
+    EXPECT_EQ(updatedSpy.at(0).at(0).toString(), QString("refined_task"));
+    EXPECT_EQ(completedSpy.count(), 1);
+}
+
+TEST_F(TestSimplifiedSearchWorker, MergeResults_AfterRefine_DropsOldKeywordMatches)
+{
+    worker->refineRegex = QRegularExpression("report", QRegularExpression::CaseInsensitiveOption);
+
+    const QUrl report = QUrl::fromLocalFile("/home/test/Report.txt");
+    const QUrl repo = QUrl::fromLocalFile("/home/test/repo.txt");
+    stub.set_lamda(VADDR(IteratorSearcher, hasItem), [] {
+        __DBG_STUB_INVOKE__
+        return true;
+    });
+    stub.set_lamda(VADDR(IteratorSearcher, takeAll), [report, repo] {
+        __DBG_STUB_INVOKE__
+        DFMSearchResultMap results;
+        results.insert(report, DFMSearchResult(report));
+        results.insert(repo, DFMSearchResult(repo));
+        return results;
+    });
+
+    IteratorSearcher searcher(QUrl::fromLocalFile("/home/test"), "repo");
+    worker->mergeResults(&searcher);
+
+    EXPECT_EQ(worker->getResultUrls(), QList<QUrl> { report });
+}
+
+TEST_F(TestSimplifiedSearchWorker, UpdatePausable_OnlyIteratorSearchers)
+{
+    worker->refinable = true;
+    IteratorSearcher *iteratorSearcher = new IteratorSearcher(QUrl::fromLocalFile("/home/test"), "repo", worker);
+    worker->searchers.append(iteratorSearcher);
+    worker->updatePausable();
+    EXPECT_TRUE(worker->isPausable());
+
+    worker->refinable = false;
+    worker->updatePausable();
+    EXPECT_FALSE(worker->isPausable());
+
+    worker->refinable = true;
+    worker->searchers.clear();
+    worker->updatePausable();
+    EXPECT_TRUE(worker->isPausable());
+}
+
+TEST_F(TestSimplifiedSearchWorker, PauseSearch_PausesIteratorSearchers)
+{
+    IteratorSearcher *iteratorSearcher = new IteratorSearcher(QUrl::fromLocalFile("/home/test"), "repo", worker);
+    worker->searchers.append(iteratorSearcher);
+
+    worker->pauseSearch();
+    EXPECT_TRUE(iteratorSearcher->paused);
+
+    worker->refineSearch("refined_task", "report");
+    EXPECT_FALSE(iteratorSearcher->paused);
+    worker->searchers.clear();
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "plugins/common/dfmplugin-tag/utils/filetagtrie.h"
+
+#include <gtest/gtest.h>
+
+using namespace dfmplugin_tag;
+
+class UT_FileTagTrie : public testing::Test
+{
+protected:
+    virtual void SetUp() override
+    {
+        trie.setTags("/home/user/a.txt", { "Red" });
+        trie.setTags("/home/user/docs", { "Blue" });
+        trie.setTags("/home/user/docs/b.txt", { "Red", "Green" });
+        trie.setTags("/home/user/docs/sub/c.txt", { "Green" });
+        trie.setTags("/home/user/docs2/d.txt", { "Red" });
+    }
+
+    static QStringList sorted(QStringList list)
+    {
+        list.sort();
+        return list;
+    }
+
+public:
+    FileTagTrie trie;
+};
+
+TEST_F(UT_FileTagTrie, tags)
+{
+    EXPECT_EQ(trie.tags("/home/user/docs/b.txt"), QStringList({ "Red", "Green" }));
+    EXPECT_TRUE(trie.tags("/home/user").isEmpty());
+    EXPECT_TRUE(trie.tags("/none").isEmpty());
+    EXPECT_EQ(trie.fileCount(), 5);
+}
+
+TEST_F(UT_FileTagTrie, setTags_EmptyRemovesFile)
+{
+    trie.setTags("/home/user/docs/sub/c.txt", {});
+
+    EXPECT_TRUE(trie.tags("/home/user/docs/sub/c.txt").isEmpty());
+    EXPECT_EQ(trie.fileCount(), 4);
+    EXPECT_TRUE(trie.filesWithTag("Green").contains("/home/user/docs/b.txt"));
+    EXPECT_FALSE(trie.filesWithTag("Green").contains("/home/user/docs/sub/c.txt"));
+}
+
+TEST_F(UT_FileTagTrie, children)
+{
+    const auto &children = trie.children("/home/user/docs");
+
+    // 不包含目录本身和前缀相同的兄弟目录
+    EXPECT_EQ(children.size(), 2);
+    EXPECT_TRUE(children.contains("/home/user/docs/b.txt"));
+    EXPECT_TRUE(children.contains("/home/user/docs/sub/c.txt"));
+    EXPECT_EQ(trie.children("/").size(), 5);
+    EXPECT_TRUE(trie.children("/none").isEmpty());
+}
+
+TEST_F(UT_FileTagTrie, filesWithTag)
+{
+    EXPECT_EQ(sorted(trie.filesWithTag("Red")),
+              QStringList({ "/home/user/a.txt", "/home/user/docs/b.txt", "/home/user/docs2/d.txt" }));
+    EXPECT_TRUE(trie.filesWithTag("Yellow").isEmpty());
+}
+
+TEST_F(UT_FileTagTrie, renameTag)
+{
+    trie.renameTag("Red", "Green");
+
+    EXPECT_TRUE(trie.filesWithTag("Red").isEmpty());
+    EXPECT_EQ(trie.filesWithTag("Green").size(), 4);
+    // 已有新标记的文件不重复
+    EXPECT_EQ(trie.tags("/home/user/docs/b.txt"), QStringList({ "Green" }));
+}
+
+TEST_F(UT_FileTagTrie, moveSubtree)
+{
+    trie.moveSubtree("/home/user/docs", "/tmp/moved");
+
+    EXPECT_TRUE(trie.children("/home/user/docs").isEmpty());
+    EXPECT_EQ(trie.tags("/tmp/moved"), QStringList({ "Blue" }));
+    EXPECT_EQ(trie.tags("/tmp/moved/sub/c.txt"), QStringList({ "Green" }));
+    EXPECT_TRUE(trie.filesWithTag("Red").contains("/tmp/moved/b.txt"));
+    EXPECT_EQ(trie.fileCount(), 5);
+}
+
+TEST_F(UT_FileTagTrie, moveSubtree_MergeIntoExisting)
+{
+    trie.setTags("/tmp/target/b.txt", { "Yellow" });
+    trie.moveSubtree("/home/user/docs", "/tmp/target");
+
+    EXPECT_EQ(trie.tags("/tmp/target/b.txt"), QStringList({ "Yellow", "Red", "Green" }));
+    EXPECT_EQ(trie.tags("/tmp/target"), QStringList({ "Blue" }));
+    EXPECT_EQ(trie.fileCount(), 5);
+}
+
+TEST_F(UT_FileTagTrie, moveSubtree_IntoItself)
+{
+    trie.moveSubtree("/home/user/docs", "/home/user/docs/sub/inner");
+
+    EXPECT_EQ(trie.tags("/home/user/docs/b.txt"), QStringList({ "Red", "Green" }));
+    EXPECT_EQ(trie.fileCount(), 5);
+}
+
+TEST_F(UT_FileTagTrie, removeSubtree)
+{
+    trie.removeSubtree("/home/user/docs");
+
+    EXPECT_TRUE(trie.tags("/home/user/docs").isEmpty());
+    EXPECT_TRUE(trie.filesWithTag("Green").isEmpty());
+    EXPECT_TRUE(trie.filesWithTag("Blue").isEmpty());
+    EXPECT_EQ(trie.tags("/home/user/docs2/d.txt"), QStringList({ "Red" }));
+    EXPECT_EQ(trie.fileCount(), 2);
+}
+
+TEST_F(UT_FileTagTrie, clear)
+{
+    trie.clear();
+
+    EXPECT_EQ(trie.fileCount(), 0);
+    EXPECT_TRUE(trie.children("/").isEmpty());
+    EXPECT_TRUE(trie.filesWithTag("Red").isEmpty());
+}
@@ -11,6 +11,9 @@
 #include <gtest/gtest.h>
 
 #include <QUrl>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
 #include <QPainter>
 #include <QPixmap>
 
@@ -127,3 +130,44 @@ TEST_F(TagEventReceiverTest, handleSidebarOrderChanged)
 {
     EXPECT_NO_THROW(TagEventReceiver::instance()->handleSidebarOrderChanged(1, QString("Group_Tag"), QList<QUrl>()));
 }
+
+TEST_F(TagEventReceiverTest, processDirectoryTags_UntaggableTarget_CacheNotMoved)
+{
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString srcPath = tempDir.filePath("src");
+    const QString destPath = tempDir.filePath("dest");
+    QDir().mkpath(destPath);
+    QFile file(destPath + "/a.txt");
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.close();
+
+    stub.set_lamda(&InfoFactory::create<FileInfo>, [](const QUrl &url, const Global::CreateFileInfoType, QString *) {
+        __DBG_STUB_INVOKE__
+        return FileInfoPointer(new FileInfo(url));
+    });
+    stub.set_lamda(&TagManager::findChildren, [srcPath]() {
+        __DBG_STUB_INVOKE__
+        QHash<QString, QStringList> children;
+        children.insert(srcPath + "/a.txt", { "red" });
+        return children;
+    });
+    stub.set_lamda(&TagManager::removeTagsOfFiles, []() { return true; });
+    stub.set_lamda(&TagManager::addTagsForFiles, []() { return true; });
+    bool canTag = false;
+    auto func = static_cast<bool (TagManager::*)(const QUrl &) const>(&TagManager::canTagFile);
+    stub.set_lamda(func, [&canTag]() -> bool { __DBG_STUB_INVOKE__ return canTag; });
+    int moved = 0;
+    stub.set_lamda(&TagManager::moveChildrenCache, [&moved]() {
+        __DBG_STUB_INVOKE__
+        ++moved;
+    });
+
+    // the service does not tag the target, its cache entries are left to the notifications
+    TagEventReceiver::instance()->processDirectoryTags(QUrl::fromLocalFile(srcPath), QUrl::fromLocalFile(destPath), true);
+    EXPECT_EQ(moved, 0);
+
+    canTag = true;
+    TagEventReceiver::instance()->processDirectoryTags(QUrl::fromLocalFile(srcPath), QUrl::fromLocalFile(destPath), true);
+    EXPECT_EQ(moved, 1);
+}
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "stubext.h"
+#include "utils/completionindex.h"
+
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include <QUrl>
+
+#include <sys/vfs.h>
+
+using namespace dfmplugin_titlebar;
+
+class CompletionIndexTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(tempDir.isValid());
+        dirUrl = QUrl::fromLocalFile(tempDir.path());
+        index = CompletionIndex::instance();
+        index->invalidate(dirUrl);
+    }
+
+    void TearDown() override
+    {
+        index->invalidate(dirUrl);
+        stub.clear();
+    }
+
+    QTemporaryDir tempDir;
+    QUrl dirUrl;
+    CompletionIndex *index { nullptr };
+    stub_ext::StubExt stub;
+};
+
+TEST_F(CompletionIndexTest, Lookup_NotInserted_ReturnsFalse)
+{
+    QStringList names;
+    EXPECT_FALSE(index->lookup(dirUrl, &names));
+}
+
+TEST_F(CompletionIndexTest, Lookup_Inserted_ReturnsDisplayOrder)
+{
+    const QStringList names { "b", "a10", "a2" };
+    index->insert(dirUrl, names, CompletionIndex::modifiedTime(dirUrl));
+
+    QStringList result;
+    EXPECT_TRUE(index->lookup(dirUrl, &result));
+    EXPECT_EQ(result, names);
+}
+
+TEST_F(CompletionIndexTest, Complete_Prefix_ReturnsMatchesInDisplayOrder)
+{
+    index->insert(dirUrl, { "share", "local", "sbin", "src", "shared" }, CompletionIndex::modifiedTime(dirUrl));
+
+    QStringList matches;
+    EXPECT_TRUE(index->complete(dirUrl, "sh", &matches));
+    EXPECT_EQ(matches, QStringList({ "share", "shared" }));
+
+    EXPECT_TRUE(index->complete(dirUrl, "s", &matches));
+    EXPECT_EQ(matches, QStringList({ "share", "sbin", "src", "shared" }));
+
+    EXPECT_TRUE(index->complete(dirUrl, "x", &matches));
+    EXPECT_TRUE(matches.isEmpty());
+}
+
+TEST_F(CompletionIndexTest, Complete_CaseSensitive_NoMatch)
+{
+    index->insert(dirUrl, { "Music" }, CompletionIndex::modifiedTime(dirUrl));
+
+    QStringList matches;
+    EXPECT_TRUE(index->complete(dirUrl, "mu", &matches));
+    EXPECT_TRUE(matches.isEmpty());
+}
+
+TEST_F(CompletionIndexTest, Lookup_DirectoryModified_EntryInvalidated)
+{
+    index->insert(dirUrl, { "a" }, CompletionIndex::modifiedTime(dirUrl));
+
+    stub.set_lamda(&CompletionIndex::modifiedTime, [](const QUrl &) {
+        __DBG_STUB_INVOKE__
+        return qint64(1);
+    });
+
+    EXPECT_FALSE(index->lookup(dirUrl, nullptr));
+}
+
+TEST_F(CompletionIndexTest, Insert_NonLocalUrl_NotCached)
+{
+    QUrl smbUrl("smb://127.0.0.1/share");
+    index->insert(smbUrl, { "a" }, 1);
+    EXPECT_FALSE(index->lookup(smbUrl, nullptr));
+}
+
+TEST_F(CompletionIndexTest, Complete_SameDirectory_ValidatedOnce)
+{
+    index->insert(dirUrl, { "share", "sbin" }, CompletionIndex::modifiedTime(dirUrl));
+
+    int checks = 0;
+    const qint64 mtime = CompletionIndex::modifiedTime(dirUrl);
+    stub.set_lamda(&CompletionIndex::modifiedTime, [&checks, mtime](const QUrl &) {
+        __DBG_STUB_INVOKE__
+        ++checks;
+        return mtime;
+    });
+
+    QStringList matches;
+    EXPECT_TRUE(index->complete(dirUrl, "s", &matches));
+    EXPECT_TRUE(index->complete(dirUrl, "sh", &matches));
+    EXPECT_TRUE(index->complete(dirUrl, "sha", &matches));
+    EXPECT_EQ(checks, 1);
+
+    // a new entry of the directory is checked again
+    index->insert(dirUrl, { "share" }, mtime);
+    EXPECT_TRUE(index->complete(dirUrl, "s", &matches));
+    EXPECT_EQ(checks, 2);
+}
+
+TEST_F(CompletionIndexTest, Insert_GvfsPath_NotCached)
+{
+    QUrl gvfsUrl = QUrl::fromLocalFile("/run/user/1000/gvfs/smb-share:server=127.0.0.1,share=share");
+    EXPECT_FALSE(CompletionIndex::isCacheable(gvfsUrl));
+    index->insert(gvfsUrl, { "a" }, 1);
+    EXPECT_FALSE(index->lookup(gvfsUrl, nullptr));
+}
+
+TEST_F(CompletionIndexTest, ModifiedTime_FuseMount_NotCached)
+{
+    stub.set_lamda(statfs, [](const char *, struct statfs *buf) {
+        __DBG_STUB_INVOKE__
+        buf->f_type = 0x65735546;
+        return 0;
+    });
+
+    EXPECT_EQ(CompletionIndex::modifiedTime(dirUrl), -1);
+}
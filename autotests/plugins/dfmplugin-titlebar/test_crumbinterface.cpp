@@ -5,6 +5,7 @@
 #include "stubext.h"
 #include "utils/crumbinterface.h"
 #include "utils/titlebarhelper.h"
+#include "utils/completionindex.h"
 
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/base/schemefactory.h>
@@ -152,6 +153,30 @@ TEST_F(CrumbInterfaceTest, RequestCompletionList_ValidUrl_SignalEmitted)
     // We can't easily test async behavior without full integration
 }
 
+TEST_F(CrumbInterfaceTest, RequestCompletionList_CachedUrl_NoTraversalStarted)
+{
+    QUrl url("file:///home");
+    QSignalSpy foundSpy(crumb, &CrumbInterface::completionFound);
+    QSignalSpy completedSpy(crumb, &CrumbInterface::completionListTransmissionCompleted);
+
+    stub.set_lamda(&CompletionIndex::lookup, [](CompletionIndex *, const QUrl &, QStringList *names) {
+        __DBG_STUB_INVOKE__
+        *names = QStringList { "a", "b" };
+        return true;
+    });
+    bool started = false;
+    stub.set_lamda(&DFMBASE_NAMESPACE::TraversalDirThread::start, [&started]() {
+        __DBG_STUB_INVOKE__
+        started = true;
+    });
+
+    crumb->requestCompletionList(url);
+    EXPECT_FALSE(started);
+    ASSERT_EQ(foundSpy.count(), 1);
+    EXPECT_EQ(foundSpy.first().first().toStringList(), QStringList({ "a", "b" }));
+    EXPECT_EQ(completedSpy.count(), 1);
+}
+
 TEST_F(CrumbInterfaceTest, CancelCompletionListTransmission_WithRunningJob_JobCanceled)
 {
     QUrl url("file:///home");
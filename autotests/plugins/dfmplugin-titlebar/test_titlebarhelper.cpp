@@ -19,6 +19,7 @@
 #include <dfm-base/widgets/filemanagerwindowsmanager.h>
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 
 #include <dfm-framework/dpf.h>
 
@@ -857,7 +858,7 @@ TEST_F(TitleBarHelperTest, GetFileViewStateValue_ValidUrl_ReturnsValue)
     QString key = "testKey";
     QVariant defaultValue("default");
 
-    stub.set_lamda(qOverload<const QString &, const QUrl &, const QVariant &>(&Settings::value), [] {
+    stub.set_lamda(qOverload<const QUrl &>(&FileViewStateStore::value), [] {
         __DBG_STUB_INVOKE__
         QVariantMap map;
         map["testKey"] = QString("value");
@@ -874,7 +875,7 @@ TEST_F(TitleBarHelperTest, GetFileViewStateValue_NonExistentKey_ReturnsDefaultVa
     QString key = "nonExistentKey";
     QVariant defaultValue("default");
 
-    stub.set_lamda(qOverload<const QString &, const QUrl &, const QVariant &>(&Settings::value), [] {
+    stub.set_lamda(qOverload<const QUrl &>(&FileViewStateStore::value), [] {
         __DBG_STUB_INVOKE__
         return QVariant(QVariantMap());
     });
@@ -890,12 +891,12 @@ TEST_F(TitleBarHelperTest, SetFileViewStateValue_ValidUrl_SetsValue)
     QVariant value("testValue");
     bool setValueCalled = false;
 
-    stub.set_lamda(qOverload<const QString &, const QUrl &, const QVariant &>(&Settings::value), [] {
+    stub.set_lamda(qOverload<const QUrl &>(&FileViewStateStore::value), [] {
         __DBG_STUB_INVOKE__
         return QVariant(QVariantMap());
     });
 
-    stub.set_lamda(qOverload<const QString &, const QUrl &, const QVariant &>(&Settings::setValue), [&setValueCalled] {
+    stub.set_lamda(qOverload<const QUrl &, const QVariantMap &>(&FileViewStateStore::setValue), [&setValueCalled] {
         __DBG_STUB_INVOKE__
         setValueCalled = true;
     });
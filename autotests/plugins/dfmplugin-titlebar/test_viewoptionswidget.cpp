@@ -9,6 +9,7 @@
 
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 #include <dfm-base/utils/viewdefines.h>
 
@@ -61,6 +62,10 @@ protected:
             __DBG_STUB_INVOKE__
             return true;
         });
+        stub.set_lamda(&FileViewStateStore::sync, [] {
+            __DBG_STUB_INVOKE__
+            return true;
+        });
 
         // Stub TitleBarHelper methods
         stub.set_lamda(&TitleBarHelper::getFileViewStateValue, [](const QUrl &, const QString &, const QVariant &defaultValue) {
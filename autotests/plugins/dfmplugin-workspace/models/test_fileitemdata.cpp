@@ -446,3 +446,27 @@ TEST_F(FileItemDataTest, Data_WithFileContentPreviewRole_ReturnsContent)
     EXPECT_TRUE(contentData.isValid());
     EXPECT_EQ(contentData.toString(), expectedContent);
 }
+
+TEST_F(FileItemDataTest, SetRealizedInfo_SetsInfoAndMarksRealized)
+{
+    // Test publishing info prepared by the prefetcher
+    FileItemData itemData(testUrl);
+    EXPECT_FALSE(itemData.isRealized());
+
+    auto info = QSharedPointer<dfmbase::FileInfo>::create(testUrl);
+    itemData.setRealizedInfo(info);
+
+    EXPECT_TRUE(itemData.isRealized());
+    EXPECT_EQ(itemData.fileInfo(), info);
+}
+
+TEST_F(FileItemDataTest, SetRealizedInfo_KeepsExistingInfo)
+{
+    // Test that info created meanwhile on the GUI thread is kept
+    auto existing = QSharedPointer<dfmbase::FileInfo>::create(testUrl);
+    FileItemData itemData(testUrl, existing);
+
+    itemData.setRealizedInfo(QSharedPointer<dfmbase::FileInfo>::create(testUrl));
+
+    EXPECT_EQ(itemData.fileInfo(), existing);
+}
@@ -10,6 +10,7 @@
 #include "models/fileselectionmodel.h"
 
 #include <QAbstractItemModel>
+#include <QStandardItemModel>
 #include <QItemSelection>
 #include <QModelIndex>
 #include <QTimer>
@@ -101,3 +102,53 @@ TEST_F(FileSelectionModelTest, Destructor_DoesNotCrash)
     // Should not crash
     EXPECT_NO_THROW(delete model);
 }
+
+TEST_F(FileSelectionModelTest, RowSet_ScatteredSelection_FollowsSelectionChanged)
+{
+    QStandardItemModel model(1000, 2);
+    FileSelectionModel selection(&model);
+
+    for (int row = 0; row < 1000; row += 10)
+        selection.select(model.index(row, 0), QItemSelectionModel::Select | QItemSelectionModel::Rows);
+    model.item(22, 0)->setEnabled(false);
+    selection.select(QItemSelection(model.index(15, 0), model.index(25, 1)), QItemSelectionModel::Select);
+
+    // 100 rows, 15 - 25 add 9 more, 20 is selected and 22 is disabled
+    EXPECT_EQ(selection.selectedCount(), 109);
+    EXPECT_TRUE(selection.isSelected(model.index(990, 0)));
+    EXPECT_TRUE(selection.isSelected(model.index(16, 0)));
+    EXPECT_FALSE(selection.isSelected(model.index(991, 0)));
+    EXPECT_EQ(selection.selectedIndexes().count(), 109);
+
+    selection.select(model.index(990, 0), QItemSelectionModel::Deselect | QItemSelectionModel::Rows);
+    EXPECT_FALSE(selection.isSelected(model.index(990, 0)));
+    EXPECT_EQ(selection.selectedCount(), 108);
+
+    int visited = 0;
+    selection.forEachSelectedIndex([&visited](const QModelIndex &index) {
+        EXPECT_EQ(index.column(), 0);
+        return ++visited < 5;
+    });
+    EXPECT_EQ(visited, 5);
+}
+
+TEST_F(FileSelectionModelTest, RowSet_ModelRowsChanged_KeepsSelectedItems)
+{
+    QStandardItemModel model(100, 1);
+    FileSelectionModel selection(&model);
+    selection.select(QItemSelection(model.index(50, 0), model.index(59, 0)), QItemSelectionModel::Select);
+    EXPECT_EQ(selection.selectedCount(), 10);
+
+    model.insertRows(0, 5);
+    EXPECT_TRUE(selection.isSelected(model.index(55, 0)));
+    EXPECT_FALSE(selection.isSelected(model.index(50, 0)));
+
+    model.removeRows(55, 3);
+    EXPECT_EQ(selection.selectedCount(), 7);
+    EXPECT_TRUE(selection.isSelected(model.index(55, 0)));
+
+    model.sort(0, Qt::DescendingOrder);
+    EXPECT_EQ(selection.selectedCount(), static_cast<int>(selection.QItemSelectionModel::selectedRows().count()));
+    for (const QModelIndex &index : selection.QItemSelectionModel::selectedRows())
+        EXPECT_TRUE(selection.isSelected(index));
+}
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "models/private/selectionrowset.h"
+
+using namespace dfmplugin_workspace;
+
+using Intervals = QList<QPair<int, int>>;
+
+TEST(UT_SelectionRowSet, Insert_CoalescesAdjacentAndOverlapping)
+{
+    SelectionRowSet set;
+    set.insert(10, 19);
+    set.insert(30, 39);
+    EXPECT_EQ(set.count(), 20);
+
+    set.insert(20, 25);
+    EXPECT_EQ(set.intervals(), (Intervals { { 10, 25 }, { 30, 39 } }));
+
+    set.insert(5, 32);
+    EXPECT_EQ(set.intervals(), (Intervals { { 5, 39 } }));
+    EXPECT_EQ(set.count(), 35);
+
+    EXPECT_TRUE(set.contains(5));
+    EXPECT_TRUE(set.contains(39));
+    EXPECT_FALSE(set.contains(4));
+    EXPECT_FALSE(set.contains(40));
+}
+
+TEST(UT_SelectionRowSet, Remove_SplitsIntervals)
+{
+    SelectionRowSet set;
+    set.insert(0, 99);
+    set.remove(10, 19);
+    set.remove(50, 50);
+    EXPECT_EQ(set.intervals(), (Intervals { { 0, 9 }, { 20, 49 }, { 51, 99 } }));
+    EXPECT_EQ(set.count(), 89);
+
+    set.remove(-5, 25);
+    EXPECT_EQ(set.intervals(), (Intervals { { 26, 49 }, { 51, 99 } }));
+    EXPECT_EQ(set.count(), 73);
+
+    set.clear();
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_FALSE(set.contains(30));
+}
+
+TEST(UT_SelectionRowSet, InsertAndRemoveRows_ShiftIntervals)
+{
+    SelectionRowSet set;
+    set.insert(2, 4);
+    set.insert(8, 9);
+
+    set.insertRows(3, 2);
+    EXPECT_EQ(set.intervals(), (Intervals { { 2, 2 }, { 5, 6 }, { 10, 11 } }));
+    EXPECT_EQ(set.count(), 5);
+
+    set.removeRows(3, 2);
+    EXPECT_EQ(set.intervals(), (Intervals { { 2, 4 }, { 8, 9 } }));
+
+    // the selected row 8 is removed
+    set.removeRows(5, 4);
+    EXPECT_EQ(set.intervals(), (Intervals { { 2, 5 } }));
+    EXPECT_EQ(set.count(), 4);
+}
+
+TEST(UT_SelectionRowSet, ForEachRow_StopsOnFalse)
+{
+    SelectionRowSet set;
+    set.insert(1, 3);
+    set.insert(7, 8);
+
+    QList<int> rows;
+    set.forEachRow([&rows](int row) {
+        rows << row;
+        return row < 7;
+    });
+    EXPECT_EQ(rows, (QList<int> { 1, 2, 3, 7 }));
+}
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "stubext.h"
+
+#include "utils/fileinfoprefetcher.h"
+#include "utils/workspacehelper.h"
+#include "views/fileview.h"
+#include "models/fileviewmodel.h"
+#include "models/fileitemdata.h"
+
+#include <dfm-base/base/application/application.h>
+#include <dfm-base/base/configs/dconfig/dconfigmanager.h>
+#include <dfm-base/interfaces/fileinfo.h>
+
+#include <QElapsedTimer>
+#include <QSemaphore>
+#include <QThreadPool>
+
+DFMBASE_USE_NAMESPACE
+using namespace dfmplugin_workspace;
+
+class UT_FileInfoPrefetcher : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        stub.set_lamda(&Application::appAttribute, [] {
+            __DBG_STUB_INVOKE__
+            return QVariant(false);
+        });
+        stub.set_lamda(&WorkspaceHelper::instance, [] {
+            __DBG_STUB_INVOKE__
+            static WorkspaceHelper helper;
+            return &helper;
+        });
+        stub.set_lamda(ADDR(DConfigManager, value), [](DConfigManager *, const QString &, const QString &, const QVariant &) {
+            __DBG_STUB_INVOKE__
+            return QVariant(true);
+        });
+
+        view = new FileView(QUrl::fromLocalFile("/tmp/test"));
+        view->viewport()->resize(100, 200);
+        prefetcher = new FileInfoPrefetcher(view);
+    }
+
+    void TearDown() override
+    {
+        delete view;
+        stub.clear();
+    }
+
+    // 可见 first..last 行，视口高 200 像素
+    void stubVisibleRows(int first, int last, int rowCount)
+    {
+        stub.set_lamda(ADDR(FileView, visibleIndexes), [first, last](FileView *, const QRect &) {
+            __DBG_STUB_INVOKE__
+            return FileView::RandeIndexList { { first, last } };
+        });
+        stub.set_lamda(VADDR(FileView, verticalOffset), [] {
+            __DBG_STUB_INVOKE__
+            return 0;
+        });
+        stub.set_lamda(ADDR(FileView, model), [this] {
+            __DBG_STUB_INVOKE__
+            return &model;
+        });
+        stub.set_lamda(VADDR(FileViewModel, rowCount), [rowCount] {
+            __DBG_STUB_INVOKE__
+            return rowCount;
+        });
+    }
+
+    static QList<int> range(int from, int to)
+    {
+        QList<int> rows;
+        const int step = from <= to ? 1 : -1;
+        for (int row = from; row != to + step; row += step)
+            rows.append(row);
+        return rows;
+    }
+
+    static FileInfoPrefetcher::Task makeTask(const QString &path, bool withInfo)
+    {
+        const QUrl url = QUrl::fromLocalFile(path);
+        FileInfoPrefetcher::Task task;
+        task.item = FileItemDataPointer(new FileItemData(url));
+        task.url = url;
+        if (withInfo)
+            task.info = FileInfoPointer(new FileInfo(url));
+        return task;
+    }
+
+    stub_ext::StubExt stub;
+    FileView *view { nullptr };
+    FileInfoPrefetcher *prefetcher { nullptr };
+    FileViewModel model;
+};
+
+TEST_F(UT_FileInfoPrefetcher, PredictRows_ScrollingDown_VisibleThenAheadThenBehind)
+{
+    stubVisibleRows(10, 19, 100);
+    prefetcher->direction = 1;
+    prefetcher->velocity = 0;
+
+    // 静止时向前预取一页，向后半页
+    const QList<int> expected = range(10, 19) + range(20, 29) + range(9, 5);
+    EXPECT_EQ(prefetcher->predictRows(), expected);
+}
+
+TEST_F(UT_FileInfoPrefetcher, PredictRows_ScrollingUp_OrderReversed)
+{
+    stubVisibleRows(10, 19, 100);
+    prefetcher->direction = -1;
+    prefetcher->velocity = 0;
+
+    const QList<int> expected = range(19, 10) + range(9, 0) + range(20, 24);
+    EXPECT_EQ(prefetcher->predictRows(), expected);
+}
+
+TEST_F(UT_FileInfoPrefetcher, PredictRows_FastScroll_AheadCapped)
+{
+    stubVisibleRows(10, 19, 1000);
+    prefetcher->direction = 1;
+    prefetcher->velocity = 1e6;
+
+    const QList<int> &rows = prefetcher->predictRows();
+    ASSERT_EQ(rows.size(), 10 + 80 + 5);
+    EXPECT_EQ(rows.at(10 + 80 - 1), 99);
+}
+
+TEST_F(UT_FileInfoPrefetcher, PredictRows_NearEnd_ClampedToRowCount)
+{
+    stubVisibleRows(10, 19, 25);
+    prefetcher->direction = 1;
+    prefetcher->velocity = 0;
+
+    const QList<int> expected = range(10, 19) + range(20, 24) + range(9, 5);
+    EXPECT_EQ(prefetcher->predictRows(), expected);
+}
+
+TEST_F(UT_FileInfoPrefetcher, PredictRows_NothingVisible_Empty)
+{
+    stub.set_lamda(ADDR(FileView, visibleIndexes), [](FileView *, const QRect &) {
+        __DBG_STUB_INVOKE__
+        return FileView::RandeIndexList();
+    });
+
+    EXPECT_TRUE(prefetcher->predictRows().isEmpty());
+}
+
+TEST_F(UT_FileInfoPrefetcher, Publish_Batch_RealizedOnce)
+{
+    int updates = 0;
+    stub.set_lamda(static_cast<void (QWidget::*)()>(&QWidget::update), [&updates] {
+        __DBG_STUB_INVOKE__
+        ++updates;
+    });
+
+    const auto first = makeTask("/tmp/prefetch-a", true);
+    const auto second = makeTask("/tmp/prefetch-b", true);
+    const auto failed = makeTask("/tmp/prefetch-c", false);
+    prefetcher->state->finished = { first, second, failed };
+    for (const auto &task : prefetcher->state->finished)
+        prefetcher->inProgress.insert(task.item.data());
+
+    prefetcher->publish();
+
+    EXPECT_TRUE(first.item->isRealized());
+    EXPECT_TRUE(second.item->isRealized());
+    EXPECT_FALSE(failed.item->isRealized());
+    EXPECT_TRUE(prefetcher->inProgress.isEmpty());
+    EXPECT_TRUE(prefetcher->state->finished.isEmpty());
+    EXPECT_EQ(prefetcher->failed, QSet<QUrl> { failed.url });
+    EXPECT_EQ(updates, 1);
+
+    // 没有完成的行时不刷新
+    prefetcher->publish();
+    EXPECT_EQ(updates, 1);
+}
+
+TEST_F(UT_FileInfoPrefetcher, Destroy_RunningTask_NotWaited)
+{
+    QSemaphore entered;
+    QSemaphore release;
+    bool iconResolved = false;
+    stub.set_lamda(VADDR(FileInfo, updateAttributes), [&entered, &release] {
+        __DBG_STUB_INVOKE__
+        entered.release();
+        release.acquire();
+    });
+    stub.set_lamda(VADDR(FileInfo, fileIcon), [&iconResolved] {
+        __DBG_STUB_INVOKE__
+        iconResolved = true;
+        return QIcon();
+    });
+
+    QSharedPointer<FileInfoPrefetcher::State> state = prefetcher->state;
+    state->queue.append(makeTask("/tmp/prefetch-a", true));
+    state->queue.append(makeTask("/tmp/prefetch-b", true));
+    state->workers = 1;
+    QThreadPool::globalInstance()->start([state] { FileInfoPrefetcher::work(state); });
+    ASSERT_TRUE(entered.tryAcquire(1, 5000));
+
+    // 任务仍阻塞在 updateAttributes 中
+    QElapsedTimer timer;
+    timer.start();
+    delete prefetcher;
+    prefetcher = nullptr;
+    EXPECT_LT(timer.elapsed(), 1000);
+    EXPECT_TRUE(state->stopped);
+    EXPECT_TRUE(state->queue.isEmpty());
+
+    release.release();
+    QThreadPool::globalInstance()->waitForDone();
+    EXPECT_EQ(state->workers, 0);
+    EXPECT_FALSE(iconResolved);
+    EXPECT_TRUE(state->finished.isEmpty());
+}
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "stubext.h"
+#include <gtest/gtest.h>
+#include "core/reencryptcontroller.h"
+
+FILE_ENCRYPT_USE_NS
+
+class UT_ReencryptController : public testing::Test
+{
+protected:
+    virtual void SetUp() override {}
+    virtual void TearDown() override { stub.clear(); }
+
+    stub_ext::StubExt stub;
+};
+
+TEST_F(UT_ReencryptController, HotzoneSectorsFor_UnknownThroughput_UsesDefault)
+{
+    EXPECT_EQ(ReencryptController::hotzoneSectorsFor(0, 0), 0u);
+}
+
+TEST_F(UT_ReencryptController, HotzoneSectorsFor_ScaledAndBounded)
+{
+    // 1 MiB/s disk gets the 4 MiB minimum
+    EXPECT_EQ(ReencryptController::hotzoneSectorsFor(1024 * 1024, 0), 4u * 1024 * 1024 / 512);
+    // 20 MiB/s rounds down to 16 MiB
+    EXPECT_EQ(ReencryptController::hotzoneSectorsFor(20 * 1024 * 1024, 0), 16u * 1024 * 1024 / 512);
+    // fast NVMe is capped to 64 MiB
+    EXPECT_EQ(ReencryptController::hotzoneSectorsFor(3000ull * 1024 * 1024, 0), 64u * 1024 * 1024 / 512);
+}
+
+TEST_F(UT_ReencryptController, HotzoneSectorsFor_DataShiftLimit)
+{
+    EXPECT_EQ(ReencryptController::hotzoneSectorsFor(3000ull * 1024 * 1024, 32 * 1024), 32u * 1024);
+}
+
+TEST_F(UT_ReencryptController, UpdateThrottle_LatencyRises_DelaysThenRecovers)
+{
+    ReencryptController controller("/dev/sdz1", "test", ReencryptController::kEncrypt);
+
+    EXPECT_EQ(controller.updateThrottle(5), 0);
+    EXPECT_EQ(controller.updateThrottle(40), 50);
+    EXPECT_EQ(controller.updateThrottle(40), 100);
+    EXPECT_EQ(controller.updateThrottle(6), 50);
+    EXPECT_EQ(controller.updateThrottle(6), 25);
+}
+
+TEST_F(UT_ReencryptController, UpdateThrottle_FastDiskJitter_NoDelay)
+{
+    ReencryptController controller("/dev/sdz1", "test", ReencryptController::kDecrypt);
+
+    EXPECT_EQ(controller.updateThrottle(0.5), 0);
+    EXPECT_EQ(controller.updateThrottle(10), 0);
+}
+
+TEST_F(UT_ReencryptController, RemainingSeconds_NoRate_Unknown)
+{
+    ReencryptController controller("/dev/sdz1", "test", ReencryptController::kEncrypt);
+
+    EXPECT_EQ(controller.remainingSeconds(100, 10), -1);
+    EXPECT_EQ(controller.remainingSeconds(100, 100), 0);
+}
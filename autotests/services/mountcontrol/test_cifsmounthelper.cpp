@@ -499,3 +499,167 @@ TEST_F(UT_CifsMountHelper, MountRoot_InvalidUser_ReturnsEmpty)
 
     EXPECT_TRUE(result.isEmpty());
 }
+
+TEST_F(UT_CifsMountHelper, ProfileOptions_BulkTransfer_MultichannelOnlySmb3)
+{
+    using Opts = QList<QPair<QString, QString>>;
+    const Opts &smb3 = CifsMountHelperPrivate::profileOptions(MountProfileField::kBulkTransfer, "3.11");
+    EXPECT_TRUE(smb3.contains(qMakePair(QString("rsize"), QString("4194304"))));
+    EXPECT_TRUE(smb3.contains(qMakePair(QString("multichannel"), QString())));
+
+    const Opts &smb2 = CifsMountHelperPrivate::profileOptions(MountProfileField::kBulkTransfer, "2.1");
+    EXPECT_TRUE(smb2.contains(qMakePair(QString("wsize"), QString("4194304"))));
+    EXPECT_FALSE(smb2.contains(qMakePair(QString("multichannel"), QString())));
+
+    EXPECT_TRUE(CifsMountHelperPrivate::profileOptions("", "3.11").isEmpty());
+    EXPECT_TRUE(CifsMountHelperPrivate::profileOptions("unknown", "3.11").isEmpty());
+}
+
+TEST_F(UT_CifsMountHelper, ConvertArgs_Profile_OverrideTakesPrecedence)
+{
+    QVariantMap overrides;
+    stub.set_lamda(&CifsMountHelper::overrideOptions, [&overrides](CifsMountHelper *) {
+        __DBG_STUB_INVOKE__
+        return overrides;
+    });
+    stub.set_lamda(&CifsMountHelper::invokerUid, [](CifsMountHelper *) {
+        __DBG_STUB_INVOKE__
+        return 1000u;
+    });
+
+    QVariantMap opts { { MountOptionsField::kVersion, "3.0" },
+                       { MountOptionsField::kProfile, MountProfileField::kBrowseHeavy } };
+    QStringList args = QString::fromStdString(getHelper()->convertArgs(opts)).split(",");
+    EXPECT_TRUE(args.contains("actimeo=30"));
+    EXPECT_FALSE(args.contains("actimeo=5"));
+    EXPECT_TRUE(args.contains("cache=strict"));
+
+    overrides.insert("actimeo", "1");
+    opts.insert(MountOptionsField::kProfile, MountProfileField::kBulkTransfer);
+    args = QString::fromStdString(getHelper()->convertArgs(opts)).split(",");
+    EXPECT_TRUE(args.contains("actimeo=1"));
+    EXPECT_TRUE(args.contains("rsize=4194304"));
+    EXPECT_TRUE(args.contains("multichannel"));
+
+    opts.remove(MountOptionsField::kProfile);
+    args = QString::fromStdString(getHelper()->convertArgs(opts)).split(",");
+    EXPECT_FALSE(args.contains("cache=strict"));
+}
+
+TEST_F(UT_CifsMountHelper, ChooseProfile_ByThroughput)
+{
+    EXPECT_EQ(CifsMountHelperPrivate::chooseProfile(100 * 1024 * 1024, 80 * 1024 * 1024),
+              QString(MountProfileField::kBulkTransfer));
+    EXPECT_EQ(CifsMountHelperPrivate::chooseProfile(2 * 1024 * 1024, 1024 * 1024),
+              QString(MountProfileField::kBrowseHeavy));
+}
+
+TEST_F(UT_CifsMountHelper, Mount_AutoProfile_SlowLinkRemountsBrowseHeavy)
+{
+    const QString mntPath("/media/user/smbmounts/test-mount");
+    stub.set_lamda(&CifsMountHelper::checkMount, [](CifsMountHelper *, const QString &, QString &) {
+        __DBG_STUB_INVOKE__
+        return CifsMountHelper::kNotExist;
+    });
+    stub.set_lamda(&CifsMountHelper::generateMountPath, [mntPath](CifsMountHelper *, const QString &) {
+        __DBG_STUB_INVOKE__
+        return mntPath;
+    });
+    stub.set_lamda(&CifsMountHelper::mkdir, [](CifsMountHelper *, const QString &) {
+        __DBG_STUB_INVOKE__
+        return true;
+    });
+    stub.set_lamda(&CifsMountHelper::invokerUid, [](CifsMountHelper *) {
+        __DBG_STUB_INVOKE__
+        return 1000u;
+    });
+    stub.set_lamda(&CifsMountHelperPrivate::probeVersion, [](CifsMountHelperPrivate *, const QString &, ushort) {
+        __DBG_STUB_INVOKE__
+        return QString("3.0");
+    });
+
+    QStringList mountOpts;
+    stub.set_lamda(mount, [&mountOpts](const char *, const char *, const char *, unsigned long, const void *data) -> int {
+        __DBG_STUB_INVOKE__
+        mountOpts << QString(static_cast<const char *>(data));
+        return 0;
+    });
+    int umountCount = 0;
+    stub.set_lamda(umount, [&umountCount](const char *) -> int {
+        __DBG_STUB_INVOKE__
+        ++umountCount;
+        return 0;
+    });
+    stub.set_lamda(&CifsMountHelperPrivate::probeThroughput, [](const QString &, qint64 *readBps, qint64 *writeBps) {
+        __DBG_STUB_INVOKE__
+        *readBps = 3 * 1024 * 1024;
+        *writeBps = 1024 * 1024;
+        return true;
+    });
+
+    QVariantMap opts { { MountOptionsField::kProfile, MountProfileField::kAuto } };
+    QVariantMap result = getHelper()->mount("smb://192.168.1.100/share", opts);
+
+    EXPECT_TRUE(result.value(MountReturnField::kResult).toBool());
+    EXPECT_EQ(result.value(MountReturnField::kProfile).toString(), QString(MountProfileField::kBrowseHeavy));
+    EXPECT_EQ(result.value(MountReturnField::kReadThroughput).toLongLong(), 3 * 1024 * 1024);
+    // probed with the bulk options, then mounted again for browsing
+    ASSERT_EQ(mountOpts.size(), 2);
+    EXPECT_TRUE(mountOpts.first().contains("rsize=4194304"));
+    EXPECT_TRUE(mountOpts.last().contains("actimeo=30"));
+    EXPECT_EQ(umountCount, 1);
+
+    stub.set_lamda(&CifsMountHelper::checkMount, [mntPath](CifsMountHelper *, const QString &, QString &mpt) {
+        __DBG_STUB_INVOKE__
+        mpt = mntPath;
+        return CifsMountHelper::kOkay;
+    });
+    QVariantMap info = getHelper()->mountProfile("smb://192.168.1.100/share");
+    EXPECT_TRUE(info.value(MountReturnField::kResult).toBool());
+    EXPECT_EQ(info.value(MountReturnField::kProfile).toString(), QString(MountProfileField::kBrowseHeavy));
+    EXPECT_EQ(info.value(MountReturnField::kWriteThroughput).toLongLong(), 1024 * 1024);
+}
+
+TEST_F(UT_CifsMountHelper, Mount_ProfileRejected_RetriesWithoutProfile)
+{
+    stub.set_lamda(&CifsMountHelper::checkMount, [](CifsMountHelper *, const QString &, QString &) {
+        __DBG_STUB_INVOKE__
+        return CifsMountHelper::kNotExist;
+    });
+    stub.set_lamda(&CifsMountHelper::generateMountPath, [](CifsMountHelper *, const QString &) {
+        __DBG_STUB_INVOKE__
+        return QString("/media/user/smbmounts/test-mount");
+    });
+    stub.set_lamda(&CifsMountHelper::mkdir, [](CifsMountHelper *, const QString &) {
+        __DBG_STUB_INVOKE__
+        return true;
+    });
+    stub.set_lamda(&CifsMountHelper::invokerUid, [](CifsMountHelper *) {
+        __DBG_STUB_INVOKE__
+        return 1000u;
+    });
+    stub.set_lamda(&CifsMountHelperPrivate::probeVersion, [](CifsMountHelperPrivate *, const QString &, ushort) {
+        __DBG_STUB_INVOKE__
+        return QString("3.11");
+    });
+
+    QStringList mountOpts;
+    stub.set_lamda(mount, [&mountOpts](const char *, const char *, const char *, unsigned long, const void *data) -> int {
+        __DBG_STUB_INVOKE__
+        mountOpts << QString(static_cast<const char *>(data));
+        if (mountOpts.size() == 1) {
+            errno = EINVAL;
+            return -1;
+        }
+        return 0;
+    });
+
+    QVariantMap opts { { MountOptionsField::kProfile, MountProfileField::kBulkTransfer } };
+    QVariantMap result = getHelper()->mount("smb://192.168.1.100/share", opts);
+
+    EXPECT_TRUE(result.value(MountReturnField::kResult).toBool());
+    EXPECT_FALSE(result.contains(MountReturnField::kProfile));
+    ASSERT_EQ(mountOpts.size(), 2);
+    EXPECT_TRUE(mountOpts.first().contains("multichannel"));
+    EXPECT_FALSE(mountOpts.last().contains("multichannel"));
+}
@@ -70,6 +70,12 @@ Q_SIGNALS:
      * \param const DFileInfo &newUrl 重名后的文件url
      */
     void fileRename(const QUrl &oldUrl, const QUrl &newUrl);
+    /*!
+     * \brief rescanRequested 监视事件有丢失（如inotify队列溢出）时发送此信号，需要重新遍历目录
+     *
+     * \param const QUrl &url 需要重新遍历的目录url
+     */
+    void rescanRequested(const QUrl &url);
 };
 }
 typedef QSharedPointer<DFMBASE_NAMESPACE::AbstractFileWatcher> AbstractFileWatcherPointer;
@@ -149,6 +149,9 @@ public:
         kCompleteCustomInfosKey = 17,
         kJobHandlePointer = 18,
         kWorkerPointer = 19,
+        kIoQueueKey = 20,   // 在设备上排队时前面的任务数，-1 表示已开始，类型：int
+        kIoDeviceKey = 21,   // 排队的设备名，类型：QString
+        kVerifySpeedKey = 22,   // 边拷贝边校验的速度，类型：qint64
     };
     Q_ENUM(NotifyInfoKey)
     enum class NotifyType : uint8_t {
@@ -3,11 +3,15 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "textbrowseredit.h"
+#include "textdocumentmodel.h"
 
 #include <DGuiApplicationHelper>
 #include <KSyntaxHighlighting/Theme>
 
+#include <QApplication>
+#include <QKeyEvent>
 #include <QScrollBar>
+#include <QSignalBlocker>
 #include <QDebug>
 
 #include <algorithm>
@@ -34,6 +38,12 @@ TextBrowserEdit::TextBrowserEdit(QWidget *parent)
     connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &TextBrowserEdit::scrollbarValueChange);
     connect(verticalScrollBar(), &QScrollBar::sliderMoved, this, &TextBrowserEdit::sliderPositionValueChange);
 
+    // scroll bar of large file mode, placed next to the edit by TextContextWidget
+    lineBar = new QScrollBar(Qt::Vertical, this);
+    lineBar->setSingleStep(1);
+    lineBar->hide();
+    connect(lineBar, &QScrollBar::valueChanged, this, &TextBrowserEdit::onLineScrollValueChanged);
+
     // Connect to system theme change signal for dynamic theme switching
     connect(DGuiApplicationHelper::instance(), &DGuiApplicationHelper::themeTypeChanged,
             this, &TextBrowserEdit::onThemeTypeChanged);
@@ -51,6 +61,8 @@ TextBrowserEdit::~TextBrowserEdit()
 
 void TextBrowserEdit::setFileData(std::string &data)
 {
+    resetDocumentModel();
+
     // Clear old content first
     clear();
     filestr = data;
@@ -62,8 +74,51 @@ void TextBrowserEdit::setFileData(std::string &data)
     fmDebug() << "Text preview: file data loaded";
 }
 
+void TextBrowserEdit::setDocumentModel(TextDocumentModel *model)
+{
+    resetDocumentModel();
+    clear();
+    filestr.clear();
+
+    docModel = model;
+    wheelDelta = 0;
+    if (!docModel)
+        return;
+
+    connect(docModel, &TextDocumentModel::lineCountChanged, this, &TextBrowserEdit::onLineCountChanged);
+
+    setLineWrapMode(QPlainTextEdit::NoWrap);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    lineBar->show();
+
+    {
+        QSignalBlocker blocker(lineBar);
+        lineBar->setValue(0);
+    }
+    updateLineScrollRange();
+    showLines(0);
+
+    fmDebug() << "Text preview: large file mode, file size:" << docModel->fileSize();
+}
+
+QScrollBar *TextBrowserEdit::lineScrollBar() const
+{
+    return lineBar;
+}
+
 void TextBrowserEdit::wheelEvent(QWheelEvent *e)
 {
+    if (docModel) {
+        // touchpads and high resolution wheels send fractions of a notch, keep the remainder
+        wheelDelta += e->angleDelta().y() * QApplication::wheelScrollLines();
+        const int steps = wheelDelta / 120;
+        wheelDelta -= steps * 120;
+        if (steps != 0)
+            lineBar->setValue(lineBar->value() - steps);
+        e->accept();
+        return;
+    }
+
     QPoint numDegrees = e->angleDelta();
     if (numDegrees.y() < 0) {
         int sbValue = verticalScrollBar()->value();
@@ -77,6 +132,137 @@ void TextBrowserEdit::wheelEvent(QWheelEvent *e)
     QPlainTextEdit::wheelEvent(e);
 }
 
+void TextBrowserEdit::keyPressEvent(QKeyEvent *e)
+{
+    if (!docModel)
+        return QPlainTextEdit::keyPressEvent(e);
+
+    const bool ctrl = e->modifiers().testFlag(Qt::ControlModifier);
+    switch (e->key()) {
+    case Qt::Key_End:
+        if (ctrl)
+            return showTail();
+        break;
+    case Qt::Key_Home:
+        if (ctrl)
+            return lineBar->setValue(0);
+        break;
+    case Qt::Key_PageDown:
+        return lineBar->triggerAction(QAbstractSlider::SliderPageStepAdd);
+    case Qt::Key_PageUp:
+        return lineBar->triggerAction(QAbstractSlider::SliderPageStepSub);
+    case Qt::Key_Down:
+        return lineBar->triggerAction(QAbstractSlider::SliderSingleStepAdd);
+    case Qt::Key_Up:
+        return lineBar->triggerAction(QAbstractSlider::SliderSingleStepSub);
+    default:
+        break;
+    }
+
+    QPlainTextEdit::keyPressEvent(e);
+}
+
+void TextBrowserEdit::resizeEvent(QResizeEvent *e)
+{
+    QPlainTextEdit::resizeEvent(e);
+
+    if (docModel && !followTail) {
+        updateLineScrollRange();
+        showLines(lineBar->value());
+    }
+}
+
+void TextBrowserEdit::onLineCountChanged(int count)
+{
+    Q_UNUSED(count)
+
+    const int previousMax = lineBar->maximum();
+    updateLineScrollRange();
+
+    if (followTail) {
+        if (docModel->isIndexFinished()) {
+            followTail = false;
+            QSignalBlocker blocker(lineBar);
+            lineBar->setValue(lineBar->maximum());
+            showLines(lineBar->value());
+        }
+        return;
+    }
+
+    // the visible window was not fully indexed yet when it was shown
+    if (lineBar->value() >= previousMax)
+        showLines(lineBar->value());
+}
+
+void TextBrowserEdit::onLineScrollValueChanged(int value)
+{
+    if (!docModel)
+        return;
+
+    followTail = false;
+    showLines(value);
+}
+
+void TextBrowserEdit::resetDocumentModel()
+{
+    if (!docModel)
+        return;
+
+    disconnect(docModel, nullptr, this, nullptr);
+    docModel = nullptr;
+    followTail = false;
+
+    lineBar->hide();
+    setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    setLineWrapMode(QPlainTextEdit::WidgetWidth);
+}
+
+int TextBrowserEdit::pageLineCount() const
+{
+    return qMax(1, viewport()->height() / qMax(1, fontMetrics().lineSpacing()));
+}
+
+void TextBrowserEdit::updateLineScrollRange()
+{
+    if (!docModel)
+        return;
+
+    const int pageLines = pageLineCount();
+    QSignalBlocker blocker(lineBar);
+    lineBar->setPageStep(pageLines);
+    lineBar->setRange(0, qMax(0, docModel->lineCount() - pageLines));
+}
+
+void TextBrowserEdit::showLines(int firstLine)
+{
+    if (!docModel)
+        return;
+
+    // one more line than visible to fill the partially shown bottom row
+    setPlainText(docModel->lines(firstLine, pageLineCount() + 1));
+    moveCursor(QTextCursor::Start, QTextCursor::MoveAnchor);
+}
+
+void TextBrowserEdit::showTail()
+{
+    if (!docModel)
+        return;
+
+    if (docModel->isIndexFinished()) {
+        lineBar->setValue(lineBar->maximum());
+        return;
+    }
+
+    // line numbers of the tail are unknown until indexing finished, read it backward
+    followTail = true;
+    {
+        QSignalBlocker blocker(lineBar);
+        lineBar->setValue(lineBar->maximum());
+    }
+    setPlainText(docModel->tailLines(pageLineCount()));
+    moveCursor(QTextCursor::End, QTextCursor::MoveAnchor);
+}
+
 void TextBrowserEdit::scrollbarValueChange(int value)
 {
     int maxValue = verticalScrollBar()->maximum();
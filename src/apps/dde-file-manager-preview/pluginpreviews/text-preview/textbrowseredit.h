@@ -8,6 +8,7 @@
 
 #include <QPlainTextEdit>
 #include <QPointer>
+#include <QScrollBar>
 
 #include <KSyntaxHighlighting/Repository>
 #include <KSyntaxHighlighting/SyntaxHighlighter>
@@ -15,6 +16,7 @@
 #include <vector>
 
 namespace plugin_filepreview {
+class TextDocumentModel;
 class TextBrowserEdit : public QPlainTextEdit
 {
     Q_OBJECT
@@ -25,6 +27,16 @@ public:
 
     void setFileData(std::string &data);
 
+    /**
+     * @brief Show a large file through a line indexed model
+     * @param model Model of the file, only the visible lines are loaded into the document
+     *
+     * The document keeps a window of lines around the visible area, lines are scrolled
+     * with lineScrollBar() instead of the scroll bar of the text edit.
+     */
+    void setDocumentModel(TextDocumentModel *model);
+    QScrollBar *lineScrollBar() const;
+
     /**
      * @brief Set syntax highlighting based on file path
      * @param filePath File path used to detect syntax definition
@@ -37,6 +49,8 @@ public:
 
 protected:
     void wheelEvent(QWheelEvent *e) override;
+    void keyPressEvent(QKeyEvent *e) override;
+    void resizeEvent(QResizeEvent *e) override;
 
 private slots:
     void scrollbarValueChange(int value);
@@ -45,6 +59,10 @@ private slots:
 
     void onThemeTypeChanged();
 
+    void onLineCountChanged(int count);
+
+    void onLineScrollValueChanged(int value);
+
 private:
     int verifyEndOfStrIntegrity(const char *s, int l);
 
@@ -58,8 +76,20 @@ private:
      */
     void updateHighlighterTheme();
 
+    void resetDocumentModel();
+    int pageLineCount() const;
+    void updateLineScrollRange();
+    void showLines(int firstLine);
+    void showTail();
+
     std::string filestr;
 
+    // Large file mode
+    QPointer<TextDocumentModel> docModel;
+    QScrollBar *lineBar { nullptr };
+    bool followTail { false };
+    int wheelDelta { 0 };   // angle delta not scrolled yet, times wheelScrollLines
+
     int lastPosition { 0 };
 
     // Syntax highlighting support
@@ -8,6 +8,7 @@
 #include <DPlainTextEdit>
 
 #include <QVBoxLayout>
+#include <QHBoxLayout>
 
 using namespace plugin_filepreview;
 DWIDGET_USE_NAMESPACE
@@ -22,9 +23,15 @@ TextContextWidget::TextContextWidget(QWidget *parent)
     titleWidget->setReadOnly(true);
     titleWidget->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 
+    QHBoxLayout *contentLay = new QHBoxLayout;
+    contentLay->addWidget(editWidget);
+    contentLay->addWidget(editWidget->lineScrollBar());
+    contentLay->setContentsMargins(0, 0, 0, 0);
+    contentLay->setSpacing(0);
+
     QVBoxLayout *mainLay = new QVBoxLayout(this);
     mainLay->addWidget(titleWidget);
-    mainLay->addWidget(editWidget);
+    mainLay->addLayout(contentLay);
     mainLay->setContentsMargins(0, 0, 0, 0);
     mainLay->setSpacing(0);
 }
@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "textdocumentmodel.h"
+
+#include <DTextEncoding>
+
+#include <QThread>
+#include <QDebug>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace plugin_filepreview;
+
+static constexpr int kLinesPerCheckpoint { 1024 };
+static constexpr qint64 kNotifyBytes { 16 * 1024 * 1024 };
+static constexpr qint64 kMaxWindowBytes { 4 * 1024 * 1024 };
+static constexpr qint64 kIndexChunkBytes { 1024 * 1024 };
+static constexpr qint64 kScanChunkBytes { 64 * 1024 };
+
+TextDocumentModel::TextDocumentModel(QObject *parent)
+    : QObject(parent)
+{
+}
+
+TextDocumentModel::~TextDocumentModel()
+{
+    close();
+}
+
+bool TextDocumentModel::open(const QString &filePath, const QString &encoding)
+{
+    close();
+
+    if (!isLineSplittable(encoding)) {
+        fmDebug() << "Text preview: encoding cannot be indexed by lines:" << encoding;
+        return false;
+    }
+
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        fmWarning() << "Text preview: failed to open file:" << filePath << file.errorString();
+        return false;
+    }
+
+    size = file.size();
+    fd = file.handle();
+    if (size <= 0 || fd < 0) {
+        fmWarning() << "Text preview: nothing to index in file:" << filePath;
+        file.close();
+        size = 0;
+        fd = -1;
+        return false;
+    }
+
+    // pages are only read once while indexing
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    fromEncoding = encoding.toLatin1();
+    needConvert = !encoding.isEmpty() && encoding.toLower() != "utf-8" && encoding.toLower() != "ascii";
+    checkpoints.append(0);
+
+    indexThread = QThread::create([this]() { buildIndex(); });
+    indexThread->start(QThread::LowPriority);
+
+    fmInfo() << "Text preview: indexing lines of file:" << filePath << "size:" << size;
+    return true;
+}
+
+void TextDocumentModel::close()
+{
+    if (indexThread) {
+        stopped = true;
+        indexThread->wait();
+        delete indexThread;
+        indexThread = nullptr;
+    }
+
+    fd = -1;
+    file.close();
+
+    {
+        QMutexLocker locker(&indexMutex);
+        checkpoints.clear();
+    }
+    size = 0;
+    indexedLines = 0;
+    finished = false;
+    stopped = false;
+}
+
+qint64 TextDocumentModel::fileSize() const
+{
+    return size;
+}
+
+int TextDocumentModel::lineCount() const
+{
+    return indexedLines;
+}
+
+bool TextDocumentModel::isIndexFinished() const
+{
+    return finished;
+}
+
+QString TextDocumentModel::lines(int firstLine, int count) const
+{
+    if (fd < 0 || firstLine < 0 || count <= 0 || firstLine >= indexedLines)
+        return QString();
+
+    const qint64 begin = lineOffset(firstLine);
+    if (begin < 0 || begin >= size)
+        return QString();
+
+    const qint64 end = skipLines(begin, count);
+    QByteArray data = read(begin, qMin(end - begin, kMaxWindowBytes));
+    // drop the newline of the last line, the view appends lines itself
+    if (data.endsWith('\n'))
+        data.chop(1);
+
+    return decode(data.constData(), data.size());
+}
+
+QString TextDocumentModel::tailLines(int count) const
+{
+    if (fd < 0 || count <= 0)
+        return QString();
+
+    // the window is capped anyway, read it once and search backward in it
+    const qint64 start = qMax<qint64>(0, size - kMaxWindowBytes - 1);
+    const QByteArray data = read(start, size - start);
+    const char *tail = data.constData();
+
+    qint64 end = data.size();
+    if (end > 0 && tail[end - 1] == '\n')
+        --end;
+
+    qint64 begin = end;
+    int found = 0;
+    while (begin > 0) {
+        const void *hit = memrchr(tail, '\n', static_cast<size_t>(begin));
+        if (!hit) {
+            begin = 0;
+            break;
+        }
+        const qint64 newline = static_cast<const char *>(hit) - tail;
+        if (++found == count) {
+            begin = newline + 1;
+            break;
+        }
+        begin = newline;
+    }
+
+    if (end - begin > kMaxWindowBytes)
+        begin = end - kMaxWindowBytes;
+
+    return decode(tail + begin, end - begin);
+}
+
+bool TextDocumentModel::isLineSplittable(const QString &encoding)
+{
+    // '\n' is a single byte only for ASCII compatible encodings
+    const QString &lower = encoding.toLower();
+    return !lower.startsWith("utf-16") && !lower.startsWith("utf-32")
+            && !lower.startsWith("ucs-2") && !lower.startsWith("ucs-4");
+}
+
+void TextDocumentModel::buildIndex()
+{
+    qint64 chunkBegin = 0;
+    int lineNum = 0;
+    qint64 nextNotify = kNotifyBytes;
+    char lastChar = '\n';
+
+    while (chunkBegin < size && !stopped) {
+        const QByteArray chunk = read(chunkBegin, qMin(kIndexChunkBytes, size - chunkBegin));
+        // truncated meanwhile, index what is left
+        if (chunk.isEmpty())
+            break;
+
+        const char *data = chunk.constData();
+        qint64 pos = 0;
+        while (pos < chunk.size()) {
+            const void *hit = memchr(data + pos, '\n', static_cast<size_t>(chunk.size() - pos));
+            if (!hit)
+                break;
+
+            pos = static_cast<const char *>(hit) - data + 1;
+            ++lineNum;
+
+            if (lineNum % kLinesPerCheckpoint == 0) {
+                QMutexLocker locker(&indexMutex);
+                checkpoints.append(chunkBegin + pos);
+            }
+        }
+
+        lastChar = chunk.back();
+        chunkBegin += chunk.size();
+        if (chunkBegin >= nextNotify) {
+            indexedLines = lineNum;
+            nextNotify = chunkBegin + kNotifyBytes;
+            Q_EMIT lineCountChanged(lineNum);
+        }
+    }
+
+    if (stopped)
+        return;
+
+    // last line without trailing newline
+    if (lastChar != '\n')
+        ++lineNum;
+
+    // the view reads windows randomly from now on
+    posix_fadvise(fd, 0, 0, POSIX_FADV_NORMAL);
+
+    indexedLines = lineNum;
+    finished = true;
+    fmInfo() << "Text preview: line index finished, lines:" << lineNum;
+
+    Q_EMIT lineCountChanged(lineNum);
+    Q_EMIT indexFinished(lineNum);
+}
+
+qint64 TextDocumentModel::lineOffset(int line) const
+{
+    qint64 offset = -1;
+    {
+        QMutexLocker locker(&indexMutex);
+        const int index = line / kLinesPerCheckpoint;
+        if (index >= checkpoints.size())
+            return -1;
+        offset = checkpoints.at(index);
+    }
+
+    return skipLines(offset, line % kLinesPerCheckpoint);
+}
+
+qint64 TextDocumentModel::skipLines(qint64 offset, int count) const
+{
+    while (count > 0 && offset < size) {
+        const QByteArray chunk = read(offset, qMin(kScanChunkBytes, size - offset));
+        if (chunk.isEmpty())
+            return size;
+
+        const char *data = chunk.constData();
+        qint64 pos = 0;
+        while (count > 0) {
+            const void *hit = memchr(data + pos, '\n', static_cast<size_t>(chunk.size() - pos));
+            if (!hit)
+                break;
+            pos = static_cast<const char *>(hit) - data + 1;
+            --count;
+        }
+        offset += count > 0 ? chunk.size() : pos;
+    }
+    return qMin(offset, size);
+}
+
+QByteArray TextDocumentModel::read(qint64 offset, qint64 len) const
+{
+    QByteArray data(static_cast<int>(len), Qt::Uninitialized);
+    qint64 done = 0;
+    while (done < len) {
+        const ssize_t ret = pread(fd, data.data() + done, static_cast<size_t>(len - done), offset + done);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        // short at the end of a truncated file
+        if (ret <= 0)
+            break;
+        done += ret;
+    }
+
+    data.truncate(static_cast<int>(done));
+    return data;
+}
+
+QString TextDocumentModel::decode(const char *data, qint64 len) const
+{
+    if (len <= 0)
+        return QString();
+
+    if (needConvert) {
+        QByteArray in(data, static_cast<int>(len));
+        QByteArray out;
+        if (DTK_NAMESPACE::DCORE_NAMESPACE::DTextEncoding::convertTextEncoding(in, out, "utf-8", fromEncoding))
+            return QString::fromUtf8(out);
+        fmDebug() << "Text preview: window encoding conversion failed, using original data";
+    }
+
+    return QString::fromUtf8(data, static_cast<int>(len));
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef TEXTDOCUMENTMODEL_H
+#define TEXTDOCUMENTMODEL_H
+
+#include "preview_plugin_global.h"
+
+#include <QObject>
+#include <QFile>
+#include <QMutex>
+#include <QVector>
+#include <QString>
+
+#include <atomic>
+
+class QThread;
+
+namespace plugin_filepreview {
+
+/**
+ * @brief Line indexed model of a large text file
+ *
+ * The file is never loaded as a whole. A background thread reads it in chunks and
+ * indexes line offsets incrementally, keeping only one checkpoint every
+ * kLinesPerCheckpoint lines, so the memory used by the index stays small whatever
+ * the file size is. Text is read and decoded per requested window, which lets the
+ * view render only the lines currently visible.
+ *
+ * The file is read with pread() rather than mapped: a file truncated by another
+ * process while it is previewed only gives short reads, where accessing a mapping
+ * past the new end would raise SIGBUS.
+ */
+class TextDocumentModel : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TextDocumentModel(QObject *parent = nullptr);
+    ~TextDocumentModel() override;
+
+    /**
+     * @brief Open the file and start indexing lines in background
+     * @param filePath Local file path
+     * @param encoding Detected file encoding, text is converted to UTF-8 per window
+     * @return false if the file cannot be opened or the encoding cannot be split by '\n'
+     */
+    bool open(const QString &filePath, const QString &encoding);
+    void close();
+
+    qint64 fileSize() const;
+
+    /**
+     * @brief Number of lines indexed so far, grows until indexFinished() is emitted
+     */
+    int lineCount() const;
+    bool isIndexFinished() const;
+
+    /**
+     * @brief Decoded text of lines [firstLine, firstLine + count)
+     *
+     * Only lines already indexed can be read, the window is capped to kMaxWindowBytes.
+     */
+    QString lines(int firstLine, int count) const;
+
+    /**
+     * @brief Decoded text of the last count lines
+     *
+     * Scans backward from the end of file, available before indexing finished.
+     */
+    QString tailLines(int count) const;
+
+    static bool isLineSplittable(const QString &encoding);
+
+Q_SIGNALS:
+    void lineCountChanged(int count);
+    void indexFinished(int count);
+
+private:
+    void buildIndex();
+    qint64 lineOffset(int line) const;
+    qint64 skipLines(qint64 offset, int count) const;
+    QByteArray read(qint64 offset, qint64 len) const;
+    QString decode(const char *data, qint64 len) const;
+
+    QFile file;
+    int fd { -1 };
+    qint64 size { 0 };
+    QByteArray fromEncoding;
+    bool needConvert { false };
+
+    mutable QMutex indexMutex;
+    QVector<qint64> checkpoints;   // offset of line i * kLinesPerCheckpoint
+    std::atomic_int indexedLines { 0 };
+    std::atomic_bool finished { false };
+    std::atomic_bool stopped { false };
+    QThread *indexThread { nullptr };
+};
+}
+#endif   // TEXTDOCUMENTMODEL_H
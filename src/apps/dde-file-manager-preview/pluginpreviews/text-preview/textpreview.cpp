@@ -5,6 +5,7 @@
 #include "textpreview.h"
 #include "textbrowseredit.h"
 #include "textcontextwidget.h"
+#include "textdocumentmodel.h"
 
 #include <dfm-base/interfaces/fileinfo.h>
 
@@ -82,19 +83,35 @@ bool TextPreview::setFileUrl(const QUrl &url)
 
     fmDebug() << "Text preview: file size:" << len << "bytes, will read up to:" << kReadTextSize << "bytes";
 
+    bool ok { false };
+    QString fileEncoding = DTK_NAMESPACE::DCORE_NAMESPACE::DTextEncoding::detectFileEncoding(filePath, &ok);
+    fmDebug() << "Text preview: detected file encoding:" << fileEncoding << "detection success:" << ok;
+
     if (len > kReadTextSize) {
+        // large file: map it and render only the visible lines instead of truncating
+        if (!docModel)
+            docModel = new TextDocumentModel(this);
+
+        if (docModel->open(filePath, ok ? fileEncoding : QString())) {
+            device.close();
+            textBrowser->textBrowserEdit()->setDocumentModel(docModel);
+            textBrowser->textBrowserEdit()->setSyntaxDefinition(filePath);
+
+            fmInfo() << "Text preview: large file loaded by line index:" << filePath << "title:" << titleStr;
+            Q_EMIT titleChanged();
+            return true;
+        }
+
         fmDebug() << "Text preview: file size exceeds limit, truncating to:" << kReadTextSize << "bytes";
         len = kReadTextSize;
+    } else if (docModel) {
+        docModel->close();
     }
 
     char *buf = new char[static_cast<unsigned long>(len)];
     device.seekg(0, ios::beg).read(buf, static_cast<streamsize>(len));
     device.close();
 
-    bool ok { false };
-    QString fileEncoding = DTK_NAMESPACE::DCORE_NAMESPACE::DTextEncoding::detectFileEncoding(filePath, &ok);
-    fmDebug() << "Text preview: detected file encoding:" << fileEncoding << "detection success:" << ok;
-
     std::string strBuf(buf, static_cast<unsigned long>(len));
     if (ok && fileEncoding.toLower() != "utf-8") {
         fmDebug() << "Text preview: converting from" << fileEncoding << "to UTF-8";
@@ -18,6 +18,7 @@
 
 namespace plugin_filepreview {
 class TextContextWidget;
+class TextDocumentModel;
 class TextPreview : public DFMBASE_NAMESPACE::AbstractBasePreview
 {
     Q_OBJECT
@@ -40,6 +41,9 @@ private:
 
     TextContextWidget *textBrowser { nullptr };
 
+    //! 大文件按行索引、映射读取，只加载可见部分
+    TextDocumentModel *docModel { nullptr };
+
     //! 操作文件的对象
     std::ifstream device;
 
@@ -35,6 +35,14 @@ QVariantMap MountControlAdaptor::Mount(const QString &path, const QVariantMap &o
     return out0;
 }
 
+QVariantMap MountControlAdaptor::MountProfile(const QString &path, const QVariantMap &opts)
+{
+    // handle method call org.deepin.Filemanager.MountControl.MountProfile
+    QVariantMap out0;
+    QMetaObject::invokeMethod(parent(), "MountProfile", Q_RETURN_ARG(QVariantMap, out0), Q_ARG(QString, path), Q_ARG(QVariantMap, opts));
+    return out0;
+}
+
 QStringList MountControlAdaptor::SupportedFileSystems()
 {
     // handle method call org.deepin.Filemanager.MountControl.SupportedFileSystems
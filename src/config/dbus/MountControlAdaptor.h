@@ -42,6 +42,13 @@ class MountControlAdaptor: public QDBusAbstractAdaptor
 "    <method name=\"SupportedFileSystems\">\n"
 "      <arg direction=\"out\" type=\"as\"/>\n"
 "    </method>\n"
+"    <method name=\"MountProfile\">\n"
+"      <arg direction=\"out\" type=\"a{sv}\"/>\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.Out0\"/>\n"
+"      <arg direction=\"in\" type=\"s\" name=\"path\"/>\n"
+"      <arg direction=\"in\" type=\"a{sv}\" name=\"opts\"/>\n"
+"      <annotation value=\"QVariantMap\" name=\"org.qtproject.QtDBus.QtTypeName.In1\"/>\n"
+"    </method>\n"
 "  </interface>\n"
         "")
 public:
@@ -51,6 +58,7 @@ public:
 public: // PROPERTIES
 public Q_SLOTS: // METHODS
     QVariantMap Mount(const QString &path, const QVariantMap &opts);
+    QVariantMap MountProfile(const QString &path, const QVariantMap &opts);
     QStringList SupportedFileSystems();
     QVariantMap Unmount(const QString &path, const QVariantMap &opts);
 Q_SIGNALS: // SIGNALS
@@ -6,11 +6,13 @@
 #include "private/application_p.h"
 
 #include "base/application/settings.h"
+#include "base/application/fileviewstatestore.h"
 
 #include <QCoreApplication>
 #include <QMetaEnum>
 #include <QtConcurrent>
 #include <QDBusInterface>
+#include <QStandardPaths>
 
 Q_LOGGING_CATEGORY(logDFMBase, "org.deepin.dde.filemanager.lib.base")
 
@@ -22,6 +24,9 @@ Q_GLOBAL_STATIC_WITH_ARGS(Settings, asGlobal, ("deepin/dde-file-manager/dde-file
 Q_GLOBAL_STATIC_WITH_ARGS(Settings, gosGlobal, ("deepin/dde-file-manager.obtusely", Settings::kGenericConfig))
 Q_GLOBAL_STATIC_WITH_ARGS(Settings, aosGlobal, ("deepin/dde-file-manager/dde-file-manager.obtusely", Settings::kGenericConfig))
 Q_GLOBAL_STATIC_WITH_ARGS(Settings, dpGlobal, ("deepin/dde-file-manager/dde-file-manager.dp", Settings::kGenericConfig))
+Q_GLOBAL_STATIC_WITH_ARGS(FileViewStateStore, vsGlobal,
+                          (QStandardPaths::writableLocation(QStandardPaths::GenericConfigLocation)
+                           + "/deepin/dde-file-manager/dde-file-manager.viewstate"))
 
 // blumia: since dde-desktop now also do show file selection dialog job, thus dde-desktop should share the same config file
 //         with dde-file-manager, so we use GenericConfig with specify path to simulate AppConfig.
@@ -148,37 +153,21 @@ void Application::setAppAttribute(Application::ApplicationAttribute aa, const QV
     const QString key = QString::fromLatin1(me.valueToKey(aa)).remove(0, 1);
 
     // clear all self iconSize, use globbal iconSize
-    if (key == "IconSizeLevel") {
-        auto settings = appObtuselySetting();
-        const QStringList &keys = settings->keyList("FileViewState");
-        for (const QString &url : keys) {
-            auto map = settings->value("FileViewState", url).toMap();
-            if (map.contains("iconSizeLevel")) {
-                qCDebug(logDFMBase) << "reset" << url << "iconSizeLevel to " << value.toInt();
-                map["iconSizeLevel"] = value;
-                settings->setValue("FileViewState", url, map);
-            }
-        }
-    } else if (key == "GridDensityLevel") {
-        auto settings = appObtuselySetting();
-        const QStringList &keys = settings->keyList("FileViewState");
-        for (const QString &url : keys) {
-            auto map = settings->value("FileViewState", url).toMap();
-            if (map.contains("gridDensityLevel")) {
-                qCDebug(logDFMBase) << "reset" << url << "gridDensityLevel to " << value.toInt();
-                map["gridDensityLevel"] = value;
-                settings->setValue("FileViewState", url, map);
-            }
-        }
-    } else if (key == "ListHeightLevel") {
-        auto settings = appObtuselySetting();
-        const QStringList &keys = settings->keyList("FileViewState");
+    static const QHash<QString, QString> kViewStateKeys {
+        { "IconSizeLevel", "iconSizeLevel" },
+        { "GridDensityLevel", "gridDensityLevel" },
+        { "ListHeightLevel", "listHeightLevel" }
+    };
+    if (kViewStateKeys.contains(key)) {
+        const QString &stateKey = kViewStateKeys.value(key);
+        auto store = fileViewStateStore();
+        const QStringList &keys = store->keyList();
         for (const QString &url : keys) {
-            auto map = settings->value("FileViewState", url).toMap();
-            if (map.contains("listHeightLevel")) {
-                qCDebug(logDFMBase) << "reset" << url << "listHeightLevel to " << value.toInt();
-                map["listHeightLevel"] = value;
-                settings->setValue("FileViewState", url, map);
+            auto map = store->value(url).toMap();
+            if (map.contains(stateKey)) {
+                qCDebug(logDFMBase) << "reset" << url << stateKey << "to " << value.toInt();
+                map[stateKey] = value;
+                store->setValue(url, map);
             }
         }
     }
@@ -301,26 +290,50 @@ Settings *Application::dataPersistence()
     return dpGlobal;
 }
 
+FileViewStateStore *Application::fileViewStateStore()
+{
+    if (!vsGlobal.exists()) {
+        auto settings = appObtuselySetting();
+        const QString &group = FileViewStateStore::kGroupName;
+
+        QHash<QString, QVariantMap> defaults;
+        for (const QString &key : settings->defaultConfigkeyList(group))
+            defaults.insert(key, settings->defaultConfigValue(group, key).toMap());
+        vsGlobal->setDefaultValues(defaults);
+
+        // one time migration, the group made every sync of the obtusely settings slow;
+        // left to the file manager, file dialogs use the settings read only
+        if (qApp->applicationName() == "dde-file-manager" && !settings->isReadOnly()
+            && vsGlobal->importFrom(settings, group)) {
+            settings->removeGroup(group);
+            settings->sync();
+        }
+    }
+
+    return vsGlobal;
+}
+
 void Application::appAttributeTrigger(TriggerAttribute ta, quint64 winId)
 {
     switch (ta) {
     case kRestoreViewMode: {
         auto defaultViewMode = appAttribute(Application::kViewMode).toInt();
         auto settings = appObtuselySetting();
+        auto store = fileViewStateStore();
 
-        const QString &kGroupName = "FileViewState";
+        const QString &kGroupName = FileViewStateStore::kGroupName;
         const QString &kViewModeKey = "viewMode";
 
-        const QStringList &keys = settings->keyList(kGroupName);
+        const QStringList &keys = store->keyList();
         const QStringList &defaultKeys = settings->defaultConfigkeyList(kGroupName);
         for (const QString &url : keys) {
-            auto map = settings->value(kGroupName, url).toMap();
+            auto map = store->value(url).toMap();
 
             if (defaultKeys.contains(url)) {
                 auto defaultMap = settings->defaultConfigValue(kGroupName, url).toMap();
                 if (defaultMap.contains(kViewModeKey) && defaultMap[kViewModeKey] != defaultViewMode) {
                     map.insert(kViewModeKey, defaultMap.value(kViewModeKey));
-                    settings->setValue(kGroupName, url, map);
+                    store->setValue(url, map);
                     continue;
                 }
             }
@@ -328,11 +341,11 @@ void Application::appAttributeTrigger(TriggerAttribute ta, quint64 winId)
             if (map.contains(kViewModeKey)) {
                 qCDebug(logDFMBase) << "Remove " << url << "viewMode";
                 map.remove(kViewModeKey);
-                settings->setValue(kGroupName, url, map);
+                store->setValue(url, map);
             }
         }
 
-        settings->sync();
+        store->sync();
 
         if (instance())
             Q_EMIT instance()->viewModeChanged(defaultViewMode);
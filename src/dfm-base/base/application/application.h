@@ -12,6 +12,7 @@
 namespace dfmbase {
 
 class Settings;
+class FileViewStateStore;
 class ApplicationPrivate;
 class Application : public QObject
 {
@@ -96,6 +97,9 @@ public:
 
     static Settings *dataPersistence();
 
+    // per-directory view state, formerly the "FileViewState" group of appObtuselySetting()
+    static FileViewStateStore *fileViewStateStore();
+
     static void appAttributeTrigger(TriggerAttribute ta, quint64 winId);
 
 Q_SIGNALS:
@@ -0,0 +1,598 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <dfm-base/base/application/fileviewstatestore.h>
+#include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/standardpaths.h>
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/interfaces/abstractfilewatcher.h>
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QThread>
+#include <QTimer>
+
+#include <algorithm>
+#include <sys/stat.h>
+
+namespace dfmbase {
+
+static constexpr quint32 kStoreMagic { 0x44465653 };   // "DFVS"
+static constexpr quint32 kStoreVersion { 1 };
+static constexpr QDataStream::Version kStreamVersion { QDataStream::Qt_5_12 };
+static constexpr int kMaxEntries { 10000 };
+static constexpr qint64 kCompactMinSize { 256 * 1024 };
+static constexpr int kSyncInterval { 1000 };
+static constexpr int kRefreshInterval { 2000 };   // ms, only used without a file watcher
+
+enum RecordType : quint8 {
+    kPutRecord = 1,
+    kRemoveRecord = 2
+};
+
+class FileViewStateStorePrivate
+{
+public:
+    struct Slot
+    {
+        qint64 offset { -1 };   // payload offset in the store file, -1 while only in the journal
+        quint32 size { 0 };
+        qint64 accessTime { 0 };
+    };
+
+    explicit FileViewStateStorePrivate(FileViewStateStore *qq);
+
+    void ensureLoaded();
+    void startWatcher();
+    void refreshIfStale();
+    void refresh();
+    bool rescan(QFile &file, bool notify);
+    bool scan(QFile &file, qint64 from, QStringList *changedKeys);
+    QVariantMap read(const QString &key);
+    void append(RecordType type, const QString &key, const QVariantMap &state);
+    bool needsCompaction() const;
+    bool compact();
+    void resetIndex();
+    void scheduleSync();
+    static QByteArray encodeRecord(RecordType type, const QString &key, qint64 accessTime, const QVariantMap &state);
+    static quint64 fileIdentity(const QString &path, qint64 *size);
+
+    FileViewStateStore *q { nullptr };
+    QString storeFile;
+    bool loaded { false };
+    bool corrupted { false };   // the file ends with a torn record, appending after it is unsafe
+    QHash<QString, Slot> index;
+    QHash<QString, QVariantMap> decoded;   // states read or written by this process
+    QHash<QString, QVariantMap> defaults;
+    QByteArray journal;   // records not written yet
+    int fileRecords { 0 };   // records in the scanned file, those not indexed are dead
+    qint64 scannedSize { 0 };
+    quint64 identity { 0 };   // inode of the scanned file, changes when another process compacted it
+    QTimer *syncTimer { nullptr };
+    bool readOnly { false };
+
+    // writes of other processes are noticed by watching the directory, compactions replace the file
+    AbstractFileWatcherPointer watcher;
+    bool stale { false };
+    QElapsedTimer refreshClock;   // throttles the stat when no watcher could be created
+};
+
+FileViewStateStorePrivate::FileViewStateStorePrivate(FileViewStateStore *qq)
+    : q(qq)
+{
+}
+
+void FileViewStateStorePrivate::ensureLoaded()
+{
+    if (loaded)
+        return;
+
+    loaded = true;
+    startWatcher();
+    refreshClock.start();
+
+    QFile file(storeFile);
+    if (!file.exists())
+        return;
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(logDFMBase) << "FileViewStateStore: cannot open" << storeFile << file.errorString();
+        return;
+    }
+
+    rescan(file, false);
+    qCInfo(logDFMBase) << "FileViewStateStore: indexed" << index.size() << "directories from" << storeFile;
+}
+
+void FileViewStateStorePrivate::startWatcher()
+{
+    const QString &dirPath = QFileInfo(storeFile).absolutePath();
+    if (!QDir().mkpath(dirPath))
+        return;
+
+    watcher = WatcherFactory::create<AbstractFileWatcher>(QUrl::fromLocalFile(dirPath));
+    if (!watcher) {
+        qCWarning(logDFMBase) << "FileViewStateStore: cannot watch" << dirPath << ", poll for changes instead";
+        return;
+    }
+
+    watcher->moveToThread(q->thread());
+    auto markStale = [this](const QUrl &url) {
+        if (url.toLocalFile() == storeFile)
+            stale = true;
+    };
+    QObject::connect(watcher.data(), &AbstractFileWatcher::fileAttributeChanged, q, markStale);
+    QObject::connect(watcher.data(), &AbstractFileWatcher::subfileCreated, q, markStale);
+    QObject::connect(watcher.data(), &AbstractFileWatcher::fileDeleted, q, markStale);
+    QObject::connect(watcher.data(), &AbstractFileWatcher::fileRename, q, [markStale](const QUrl &from, const QUrl &to) {
+        markStale(from);
+        markStale(to);
+    });
+    watcher->startWatcher();
+}
+
+void FileViewStateStorePrivate::refreshIfStale()
+{
+    if (watcher) {
+        if (!stale)
+            return;
+    } else if (refreshClock.isValid() && refreshClock.elapsed() < kRefreshInterval) {
+        return;
+    }
+
+    refreshClock.start();
+    refresh();
+}
+
+void FileViewStateStorePrivate::refresh()
+{
+    // pending records are flushed first, they would be lost by a full rescan
+    if (!journal.isEmpty())
+        return;
+
+    stale = false;
+    qint64 size = 0;
+    const quint64 id = fileIdentity(storeFile, &size);
+    if (id == 0 || (id == identity && size == scannedSize))
+        return;
+
+    QFile file(storeFile);
+    if (file.open(QIODevice::ReadOnly))
+        rescan(file, true);
+}
+
+bool FileViewStateStorePrivate::rescan(QFile &file, bool notify)
+{
+    qint64 size = 0;
+    const quint64 id = fileIdentity(storeFile, &size);
+
+    QStringList changedKeys;
+    bool ok = false;
+    if (id != identity || size < scannedSize) {
+        // rewritten by a compaction, offsets known so far are meaningless
+        resetIndex();
+        identity = id;
+        ok = scan(file, 0, nullptr);
+    } else {
+        ok = scan(file, scannedSize, notify ? &changedKeys : nullptr);
+    }
+
+    for (const QString &key : changedKeys)
+        Q_EMIT q->valueChanged(FileViewStateStore::kGroupName, key, q->value(key));
+
+    return ok;
+}
+
+bool FileViewStateStorePrivate::scan(QFile &file, qint64 from, QStringList *changedKeys)
+{
+    const qint64 fileSize = file.size();
+    if (!file.seek(from))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(kStreamVersion);
+
+    if (from == 0) {
+        if (fileSize == 0)
+            return true;
+
+        quint32 magic = 0;
+        quint32 version = 0;
+        in >> magic >> version;
+        if (in.status() != QDataStream::Ok || magic != kStoreMagic || version != kStoreVersion) {
+            qCWarning(logDFMBase) << "FileViewStateStore: unknown file format, it will be rewritten:" << storeFile;
+            corrupted = true;
+            return false;
+        }
+        scannedSize = file.pos();
+    }
+
+    while (!in.atEnd()) {
+        quint8 type = 0;
+        QString key;
+        qint64 accessTime = 0;
+        quint32 size = 0;
+        in >> type >> key >> accessTime >> size;
+
+        const qint64 payloadOffset = file.pos();
+        if (in.status() != QDataStream::Ok || payloadOffset + size > fileSize
+            || (type != kPutRecord && type != kRemoveRecord)) {
+            qCWarning(logDFMBase) << "FileViewStateStore: torn record at" << scannedSize << "in" << storeFile;
+            corrupted = true;
+            return false;
+        }
+        file.seek(payloadOffset + size);
+
+        ++fileRecords;
+        if (type == kPutRecord)
+            index.insert(key, { payloadOffset, size, accessTime });
+        else
+            index.remove(key);
+        decoded.remove(key);
+        scannedSize = file.pos();
+
+        if (changedKeys)
+            changedKeys->append(key);
+    }
+
+    return true;
+}
+
+QVariantMap FileViewStateStorePrivate::read(const QString &key)
+{
+    auto it = decoded.constFind(key);
+    if (it != decoded.constEnd())
+        return it.value();
+
+    const Slot &slot = index.value(key);
+    if (slot.offset < 0)
+        return {};
+
+    QFile file(storeFile);
+    if (!file.open(QIODevice::ReadOnly) || !file.seek(slot.offset)) {
+        qCWarning(logDFMBase) << "FileViewStateStore: cannot read" << key << file.errorString();
+        return {};
+    }
+
+    const QByteArray &payload = file.read(slot.size);
+    QDataStream in(payload);
+    in.setVersion(kStreamVersion);
+    QVariantMap state;
+    in >> state;
+
+    decoded.insert(key, state);
+    return state;
+}
+
+void FileViewStateStorePrivate::append(RecordType type, const QString &key, const QVariantMap &state)
+{
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+    if (type == kPutRecord) {
+        index.insert(key, { -1, 0, now });
+        decoded.insert(key, state);
+    } else {
+        index.remove(key);
+        decoded.remove(key);
+    }
+
+    // read only stores keep the change for this process only
+    if (readOnly)
+        return;
+
+    journal.append(encodeRecord(type, key, now, state));
+    scheduleSync();
+}
+
+bool FileViewStateStorePrivate::needsCompaction() const
+{
+    if (corrupted || index.size() > kMaxEntries)
+        return true;
+
+    const int deadRecords = fileRecords - index.size();
+    return scannedSize > kCompactMinSize && deadRecords > index.size();
+}
+
+bool FileViewStateStorePrivate::compact()
+{
+    QList<QString> keys = index.keys();
+    if (keys.size() > kMaxEntries) {
+        // least recently used directories go first
+        std::sort(keys.begin(), keys.end(), [this](const QString &l, const QString &r) {
+            return index.value(l).accessTime > index.value(r).accessTime;
+        });
+        qCInfo(logDFMBase) << "FileViewStateStore: pruning" << keys.size() - kMaxEntries << "stale directories";
+        keys = keys.mid(0, kMaxEntries);
+    }
+
+    QSaveFile file(storeFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logDFMBase) << "FileViewStateStore: cannot compact" << storeFile << file.errorString();
+        return false;
+    }
+
+    QHash<QString, QVariantMap> states;
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out.setVersion(kStreamVersion);
+        out << kStoreMagic << kStoreVersion;
+    }
+    for (const QString &key : keys) {
+        const QVariantMap &state = read(key);
+        states.insert(key, state);
+        data.append(encodeRecord(kPutRecord, key, index.value(key).accessTime, state));
+    }
+
+    file.write(data);
+    if (!file.commit()) {
+        qCWarning(logDFMBase) << "FileViewStateStore: cannot compact" << storeFile << file.errorString();
+        return false;
+    }
+
+    resetIndex();
+    journal.clear();
+    corrupted = false;
+
+    QFile reopened(storeFile);
+    if (reopened.open(QIODevice::ReadOnly)) {
+        identity = fileIdentity(storeFile, nullptr);
+        scan(reopened, 0, nullptr);
+    }
+    // keep what was already decoded, it did not change
+    decoded = states;
+
+    qCInfo(logDFMBase) << "FileViewStateStore: compacted" << storeFile << "directories:" << index.size();
+    return true;
+}
+
+void FileViewStateStorePrivate::resetIndex()
+{
+    index.clear();
+    decoded.clear();
+    fileRecords = 0;
+    scannedSize = 0;
+}
+
+void FileViewStateStorePrivate::scheduleSync()
+{
+    if (QThread::currentThread() == syncTimer->thread())
+        syncTimer->start();
+    else
+        syncTimer->metaObject()->invokeMethod(syncTimer, "start", Qt::QueuedConnection);
+}
+
+QByteArray FileViewStateStorePrivate::encodeRecord(RecordType type, const QString &key, qint64 accessTime, const QVariantMap &state)
+{
+    QByteArray payload;
+    if (type == kPutRecord) {
+        QDataStream out(&payload, QIODevice::WriteOnly);
+        out.setVersion(kStreamVersion);
+        out << state;
+    }
+
+    QByteArray record;
+    QDataStream out(&record, QIODevice::WriteOnly);
+    out.setVersion(kStreamVersion);
+    out << static_cast<quint8>(type) << key << accessTime << static_cast<quint32>(payload.size());
+    out.writeRawData(payload.constData(), payload.size());
+    return record;
+}
+
+quint64 FileViewStateStorePrivate::fileIdentity(const QString &path, qint64 *size)
+{
+    struct stat st;
+    if (::stat(QFile::encodeName(path).constData(), &st) != 0)
+        return 0;
+
+    if (size)
+        *size = st.st_size;
+    return static_cast<quint64>(st.st_ino);
+}
+
+FileViewStateStore::FileViewStateStore(const QString &storeFile, QObject *parent)
+    : QObject(parent), d(new FileViewStateStorePrivate(this))
+{
+    d->storeFile = storeFile;
+    d->syncTimer = new QTimer(this);
+    d->syncTimer->setSingleShot(true);
+    d->syncTimer->setInterval(kSyncInterval);
+    connect(d->syncTimer, &QTimer::timeout, this, &FileViewStateStore::sync);
+}
+
+FileViewStateStore::~FileViewStateStore()
+{
+    d->syncTimer->stop();
+    sync();
+}
+
+QString FileViewStateStore::storeFile() const
+{
+    return d->storeFile;
+}
+
+QStringList FileViewStateStore::keyList() const
+{
+    d->ensureLoaded();
+    d->refreshIfStale();
+    return d->index.keys();
+}
+
+bool FileViewStateStore::contains(const QString &key) const
+{
+    d->ensureLoaded();
+    d->refreshIfStale();
+    return d->index.contains(key);
+}
+
+QVariant FileViewStateStore::value(const QString &key) const
+{
+    d->ensureLoaded();
+    d->refreshIfStale();
+
+    auto it = d->index.find(key);
+    if (it == d->index.end()) {
+        auto defaultIt = d->defaults.constFind(key);
+        return defaultIt == d->defaults.constEnd() ? QVariant() : QVariant(defaultIt.value());
+    }
+
+    // only kept in memory, persisted with the next compaction
+    it->accessTime = QDateTime::currentSecsSinceEpoch();
+    return d->read(key);
+}
+
+QVariant FileViewStateStore::value(const QUrl &url) const
+{
+    return value(urlToKey(url));
+}
+
+void FileViewStateStore::setValue(const QString &key, const QVariantMap &state)
+{
+    d->ensureLoaded();
+    if (d->index.contains(key) && d->read(key) == state)
+        return;
+
+    d->append(kPutRecord, key, state);
+    Q_EMIT valueChanged(kGroupName, key, state);
+}
+
+void FileViewStateStore::setValue(const QUrl &url, const QVariantMap &state)
+{
+    setValue(urlToKey(url), state);
+}
+
+void FileViewStateStore::remove(const QString &key)
+{
+    d->ensureLoaded();
+    if (!d->index.contains(key))
+        return;
+
+    d->append(kRemoveRecord, key, {});
+    Q_EMIT valueChanged(kGroupName, key, value(key));
+}
+
+void FileViewStateStore::remove(const QUrl &url)
+{
+    remove(urlToKey(url));
+}
+
+bool FileViewStateStore::sync()
+{
+    if (!d->loaded || d->readOnly)
+        return true;
+
+    if (d->journal.isEmpty() && !d->needsCompaction())
+        return true;
+
+    if (d->corrupted)
+        return d->compact();
+
+    if (!d->journal.isEmpty()) {
+        QDir().mkpath(QFileInfo(d->storeFile).absolutePath());
+
+        QFile file(d->storeFile);
+        if (!file.open(QIODevice::ReadWrite | QIODevice::Append)) {
+            qCWarning(logDFMBase) << "FileViewStateStore: cannot write" << d->storeFile << file.errorString();
+            return false;
+        }
+
+        QByteArray data;
+        if (file.size() == 0) {
+            QDataStream out(&data, QIODevice::WriteOnly);
+            out.setVersion(kStreamVersion);
+            out << kStoreMagic << kStoreVersion;
+        }
+        // one write per sync, O_APPEND keeps records of concurrent processes whole
+        data.append(d->journal);
+        if (file.write(data) != data.size() || !file.flush()) {
+            qCWarning(logDFMBase) << "FileViewStateStore: cannot write" << d->storeFile << file.errorString();
+            return false;
+        }
+        d->journal.clear();
+
+        // index the appended records, this also gives journal slots their offsets
+        file.close();
+        if (file.open(QIODevice::ReadOnly))
+            d->rescan(file, false);
+    }
+
+    if (d->needsCompaction())
+        return d->compact();
+
+    return true;
+}
+
+void FileViewStateStore::reload()
+{
+    d->ensureLoaded();
+    d->refresh();
+}
+
+bool FileViewStateStore::isReadOnly() const
+{
+    return d->readOnly;
+}
+
+void FileViewStateStore::setReadOnly(bool readOnly)
+{
+    if (d->readOnly == readOnly)
+        return;
+
+    d->readOnly = readOnly;
+    // like Settings, pending changes are dropped when entering read only mode
+    if (readOnly) {
+        d->syncTimer->stop();
+        d->journal.clear();
+    }
+}
+
+void FileViewStateStore::setDefaultValues(const QHash<QString, QVariantMap> &values)
+{
+    d->defaults = values;
+}
+
+bool FileViewStateStore::importFrom(Settings *settings, const QString &group)
+{
+    if (!settings || d->readOnly || QFile::exists(d->storeFile))
+        return false;
+
+    d->ensureLoaded();
+    int imported = 0;
+    for (const QString &key : settings->keyList(group)) {
+        // defaults stay in the default config
+        if (settings->isRemovable(group, key)) {
+            d->append(kPutRecord, key, settings->value(group, key).toMap());
+            ++imported;
+        }
+    }
+
+    // no store file is written then, the caller must not clear the group every startup
+    if (imported == 0)
+        return false;
+
+    if (!sync())
+        return false;
+
+    qCInfo(logDFMBase) << "FileViewStateStore: imported" << d->index.size() << "directories from settings group" << group;
+    return true;
+}
+
+QString FileViewStateStore::urlToKey(const QUrl &url)
+{
+    // same keys as Settings used for the group
+    if (url.isLocalFile()) {
+        const QUrl &standardUrl = StandardPaths::toStandardUrl(url.toLocalFile());
+        if (standardUrl.isValid())
+            return standardUrl.toString();
+    }
+
+    return url.toString();
+}
+
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FILEVIEWSTATESTORE_H
+#define FILEVIEWSTATESTORE_H
+
+#include <dfm-base/dfm_base_global.h>
+
+#include <QObject>
+#include <QUrl>
+#include <QVariantMap>
+
+namespace dfmbase {
+
+class Settings;
+class FileViewStateStorePrivate;
+
+/*!
+ * \brief Persistent per-directory view state (sort role, view mode, icon size...)
+ *
+ * Replaces the "FileViewState" group of the obtusely Settings, which was parsed
+ * and rewritten as a whole JSON document. The store is an append only journal of
+ * records, one per changed directory:
+ *
+ * - nothing is read before the first access, then only record headers are
+ *   scanned to build a key -> offset index, a state is decoded when asked for;
+ * - a change appends one record, the journal is rewritten only when dead records
+ *   dominate or more than kMaxEntries directories are stored, dropping the least
+ *   recently used ones;
+ * - records appended by other processes are picked up on the next access after
+ *   the watcher of the store directory reported a change, reads do not stat.
+ *
+ * A read only store (file dialogs) keeps changes in memory and never writes.
+ *
+ * Like Settings it is not thread safe.
+ */
+class FileViewStateStore : public QObject
+{
+    Q_OBJECT
+    friend class FileViewStateStorePrivate;
+
+public:
+    static constexpr char kGroupName[] { "FileViewState" };
+
+    explicit FileViewStateStore(const QString &storeFile, QObject *parent = nullptr);
+    ~FileViewStateStore() override;
+
+    QString storeFile() const;
+
+    QStringList keyList() const;
+    bool contains(const QString &key) const;
+    QVariant value(const QString &key) const;
+    QVariant value(const QUrl &url) const;
+    void setValue(const QString &key, const QVariantMap &state);
+    void setValue(const QUrl &url, const QVariantMap &state);
+    void remove(const QString &key);
+    void remove(const QUrl &url);
+    bool sync();
+    // pick up records of other processes now, needed if the directory cannot be watched
+    void reload();
+
+    bool isReadOnly() const;
+    void setReadOnly(bool readOnly);
+
+    // states used for directories without a stored one, from the default config
+    void setDefaultValues(const QHash<QString, QVariantMap> &values);
+
+    /*!
+     * \brief Move the user values of group out of settings, only done while the
+     * store file does not exist yet
+     */
+    bool importFrom(Settings *settings, const QString &group);
+
+    static QString urlToKey(const QUrl &url);
+
+Q_SIGNALS:
+    // same signature as Settings::valueChanged, group is always kGroupName
+    void valueChanged(const QString &group, const QString &key, const QVariant &value);
+
+private:
+    QScopedPointer<FileViewStateStorePrivate> d;
+};
+
+}
+
+#endif   // FILEVIEWSTATESTORE_H
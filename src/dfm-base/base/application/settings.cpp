@@ -14,10 +14,257 @@
 #include <QJsonValue>
 #include <QDebug>
 #include <QFile>
-#include <QSaveFile>
 #include <QDir>
+#include <QFileInfo>
 #include <QTimer>
 #include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QTemporaryFile>
+
+#include <functional>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+namespace dfmbase {
+
+/*!
+ * \brief SettingsWriter 在后台线程写配置文件
+ *
+ * 自动同步时序列化和写文件都在后台进行，同一文件在写入前的多次提交只写最新的一份；
+ * 写临时文件后 rename 替换，只有显式 sync() 和退出时才 fsync。
+ */
+class SettingsWriter
+{
+public:
+    struct Snapshot
+    {
+        QHash<QString, QVariantHash> values;
+        QSet<QString> excludeGroups;
+        std::function<void(bool ok)> done;   // 写入后在写入的线程调用，被更新的提交覆盖时不调用
+    };
+
+    static SettingsWriter *instance();
+    static QByteArray toJson(const Snapshot &snapshot);
+
+    void post(const QString &path, const Snapshot &snapshot);
+    // 在调用线程写完该文件尚未写入的内容，durable 时落盘
+    bool finish(const QString &path, bool durable, const Snapshot *snapshot = nullptr);
+    void finishAll();
+    // 文件内容是否为本进程最后一次写入的内容
+    bool isOwnWrite(const QString &path, const QByteArray &content);
+
+private:
+    SettingsWriter();
+    ~SettingsWriter();
+    void run();
+    bool write(const QString &path, const QByteArray &json, bool durable);
+
+    QMutex mutex;
+    QWaitCondition changed;
+    QHash<QString, Snapshot> pending;   // 每个文件只保留最新的一份
+    QSet<QString> writing;
+    QSet<QString> unsynced;   // 已写入但未 fsync
+    QHash<QString, QByteArray> lastWritten;
+    bool quit { false };
+    QThread *thread { nullptr };
+};
+
+SettingsWriter *SettingsWriter::instance()
+{
+    static SettingsWriter ins;
+    return &ins;
+}
+
+SettingsWriter::SettingsWriter()
+{
+    thread = QThread::create([this] { run(); });
+    thread->start(QThread::LowPriority);
+
+    if (qApp)
+        QObject::connect(qApp, &QCoreApplication::aboutToQuit, qApp, [this] { finishAll(); }, Qt::DirectConnection);
+}
+
+SettingsWriter::~SettingsWriter()
+{
+    {
+        QMutexLocker lk(&mutex);
+        quit = true;
+        changed.wakeAll();
+    }
+    thread->wait();
+    delete thread;
+    finishAll();
+}
+
+QByteArray SettingsWriter::toJson(const Snapshot &snapshot)
+{
+    QJsonObject root_object;
+
+    for (auto begin = snapshot.values.constBegin(); begin != snapshot.values.constEnd(); ++begin) {
+        const QString &key = begin.key();
+        if (!snapshot.excludeGroups.contains(key))
+            root_object.insert(key, QJsonValue(QJsonObject::fromVariantHash(begin.value())));
+    }
+
+    return QJsonDocument(root_object).toJson();
+}
+
+void SettingsWriter::post(const QString &path, const Snapshot &snapshot)
+{
+    QMutexLocker lk(&mutex);
+    pending.insert(path, snapshot);
+    changed.wakeAll();
+}
+
+bool SettingsWriter::finish(const QString &path, bool durable, const Snapshot *snapshot)
+{
+    QMutexLocker lk(&mutex);
+    while (writing.contains(path))
+        changed.wait(&mutex);
+
+    const bool queued = pending.contains(path);
+    Snapshot data = pending.take(path);
+    const auto queuedDone = data.done;
+    // 传入的内容比排队的新
+    if (snapshot)
+        data = *snapshot;
+
+    if (!snapshot && !queued) {
+        // 没有新内容，只需把之前异步写入的内容落盘
+        if (!durable || !unsynced.remove(path))
+            return true;
+        lk.unlock();
+        const int fd = open(QFile::encodeName(path).constData(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        const bool ok = fsync(fd) == 0;
+        close(fd);
+        return ok;
+    }
+
+    writing.insert(path);
+    lk.unlock();
+    const bool ok = write(path, toJson(data), durable);
+    if (queuedDone)
+        queuedDone(ok);
+    lk.relock();
+    writing.remove(path);
+    changed.wakeAll();
+    return ok;
+}
+
+void SettingsWriter::finishAll()
+{
+    QStringList paths;
+    {
+        QMutexLocker lk(&mutex);
+        paths = pending.keys();
+        for (const QString &path : std::as_const(unsynced)) {
+            if (!paths.contains(path))
+                paths.append(path);
+        }
+    }
+    for (const QString &path : std::as_const(paths))
+        finish(path, true);
+}
+
+bool SettingsWriter::isOwnWrite(const QString &path, const QByteArray &content)
+{
+    QMutexLocker lk(&mutex);
+    auto it = lastWritten.constFind(path);
+    return it != lastWritten.constEnd() && it.value() == content;
+}
+
+void SettingsWriter::run()
+{
+    Q_FOREVER {
+        QString path;
+        Snapshot snapshot;
+        {
+            QMutexLocker lk(&mutex);
+            while (pending.isEmpty() && !quit)
+                changed.wait(&mutex);
+            if (quit)
+                return;
+            // 正在被 finish() 写的文件先跳过
+            auto it = pending.begin();
+            while (it != pending.end() && writing.contains(it.key()))
+                ++it;
+            if (it == pending.end()) {
+                changed.wait(&mutex);
+                continue;
+            }
+            path = it.key();
+            snapshot = it.value();
+            pending.erase(it);
+            writing.insert(path);
+        }
+
+        const bool ok = write(path, toJson(snapshot), false);
+        // 在 writing 中调用，finish() 返回前结果已经通知
+        if (snapshot.done)
+            snapshot.done(ok);
+
+        QMutexLocker lk(&mutex);
+        writing.remove(path);
+        changed.wakeAll();
+    }
+}
+
+bool SettingsWriter::write(const QString &path, const QByteArray &json, bool durable)
+{
+    const QFileInfo info(path);
+    if (!QDir().mkpath(info.absolutePath())) {
+        qCWarning(logDFMBase) << "Failed to create settings directory:" << info.absolutePath();
+        return false;
+    }
+
+    // 临时文件与目标在同一目录，rename 是原子的
+    QTemporaryFile file(info.absolutePath() + "/." + info.fileName() + ".XXXXXX");
+    if (!file.open()) {
+        qCWarning(logDFMBase) << "Failed to open settings file for writing:" << path << file.errorString();
+        return false;
+    }
+    file.setPermissions(info.exists() ? info.permissions()
+                                      : QFile::ReadOwner | QFile::WriteOwner | QFile::ReadGroup | QFile::ReadOther);
+
+    if (file.write(json) != json.size() || !file.flush()) {
+        qCWarning(logDFMBase) << "Failed to write settings data:" << path << file.errorString();
+        return false;
+    }
+    if (durable && fsync(file.handle()) != 0) {
+        qCWarning(logDFMBase) << "Failed to fsync settings file:" << path << strerror(errno);
+        return false;
+    }
+
+    if (::rename(QFile::encodeName(file.fileName()).constData(), QFile::encodeName(path).constData()) != 0) {
+        qCWarning(logDFMBase) << "Failed to commit settings file:" << path << strerror(errno);
+        return false;
+    }
+    file.setAutoRemove(false);
+
+    if (durable) {
+        const int dirFd = open(QFile::encodeName(info.absolutePath()).constData(), O_RDONLY | O_DIRECTORY);
+        if (dirFd >= 0) {
+            fsync(dirFd);
+            close(dirFd);
+        }
+    }
+
+    QMutexLocker lk(&mutex);
+    lastWritten.insert(path, json);
+    if (durable)
+        unsynced.remove(path);
+    else
+        unsynced.insert(path);
+    return true;
+}
+
+}   // namespace dfmbase
 
 /*!
  * \class SettingsPrivate 通用设置的私有类
@@ -33,6 +280,7 @@ public:
     bool autoSync = false;   // automatically synchronize
     bool watchChanges = false;   // monitor for configuration changes
     bool settingFileIsDirty = false;   // set whether the file has cached data (dirty data)
+    quint64 changeCount = 0;   // 每次修改加一，后台写入完成时判断写入后是否又有修改
     bool readOnly = false;   // read-only mode, sync() will not write to file
     QSet<QString> autoSyncGroupExclude;   // when auto sync, exclude some group
     QTimer *syncTimer = nullptr;   // synchronization Timer
@@ -109,7 +357,12 @@ public:
 
     void fromJsonFile(const QString &fileName, Data *data);
     void fromJson(const QByteArray &json, Data *data);
-    QByteArray toJson(const Data &data);
+    SettingsWriter::Snapshot snapshot() const
+    {
+        return { writableData.values, autoSyncGroupExclude, nullptr };
+    }
+    void postWrite();
+    void onWriteFinished(quint64 generation, bool ok);
 
     /*!
      * \brief makeSettingFileToDirty 同步设置到配置文件
@@ -117,6 +370,9 @@ public:
      */
     void makeSettingFileToDirty(bool dirty)
     {
+        if (dirty)
+            ++changeCount;
+
         if (settingFileIsDirty == dirty) {
             return;
         }
@@ -259,23 +515,44 @@ void SettingsPrivate::fromJson(const QByteArray &json, Data *data)
     }
 }
 /*!
- * \brief SettingsPrivate::toJson 将属性转换为Json对象的QByteArray
- *
- * \param data 属性data
+ * \brief SettingsPrivate::postWrite 自动同步时交给后台线程写入，不阻塞当前线程
  *
- * \return QByteArray json 的对象
+ * 写入成功后才清除脏标记，写入失败时仍是脏数据，稍后重试
  */
-QByteArray SettingsPrivate::toJson(const Data &data)
+void SettingsPrivate::postWrite()
 {
-    QJsonObject root_object;
+    if (!settingFileIsDirty)
+        return;
 
-    for (auto begin = data.values.constBegin(); begin != data.values.constEnd(); ++begin) {
-        const QString &key = begin.key();
-        if (!autoSyncGroupExclude.contains(key))
-            root_object.insert(key, QJsonValue(QJsonObject::fromVariantHash(begin.value())));
+    if (readOnly) {
+        makeSettingFileToDirty(false);
+        return;
     }
 
-    return QJsonDocument(root_object).toJson();
+    SettingsWriter::Snapshot data = snapshot();
+    const quint64 generation = changeCount;
+    Settings *context = q;
+    data.done = [this, context, generation](bool ok) {
+        QMetaObject::invokeMethod(
+                context, [this, generation, ok] { onWriteFinished(generation, ok); }, Qt::QueuedConnection);
+    };
+    SettingsWriter::instance()->post(settingFile, data);
+}
+/*!
+ * \brief SettingsPrivate::onWriteFinished 后台写入完成，在 Settings 所在线程调用
+ */
+void SettingsPrivate::onWriteFinished(quint64 generation, bool ok)
+{
+    if (ok && generation == changeCount) {
+        makeSettingFileToDirty(false);
+        return;
+    }
+
+    if (!ok)
+        qCWarning(logDFMBase) << "Failed to write settings file in background, retry later:" << settingFile;
+    // 写入失败或写入后又有修改
+    if (settingFileIsDirty && syncTimer)
+        syncTimer->start();
 }
 /*!
  * \brief SettingsPrivate::_q_onFileChanged 槽函数，当配置文件发上改变时调用
@@ -288,10 +565,20 @@ void SettingsPrivate::_q_onFileChanged(const QUrl &url)
         return;
     }
 
+    QByteArray json;
+    QFile file(settingFile);
+    if (file.open(QFile::ReadOnly))
+        json = file.readAll();
+
+    // 本进程后台写入引起的变化，内存中的值可能已经更新，不能用文件覆盖
+    if (SettingsWriter::instance()->isOwnWrite(settingFile, json))
+        return;
+
     const auto old_values = writableData.values;
 
     writableData.values.clear();
-    fromJsonFile(settingFile, &writableData);
+    if (!json.isEmpty())
+        fromJson(json, &writableData);
     makeSettingFileToDirty(false);
 
     for (auto begin = writableData.values.constBegin(); begin != writableData.values.constEnd(); ++begin) {
@@ -333,9 +620,9 @@ void SettingsPrivate::_q_onFileChanged(const QUrl &url)
     }
 }
 /*!
- * \brief SettingsPrivate::_q_onFileRenamed Handle file rename events (e.g., from QSaveFile)
+ * \brief SettingsPrivate::_q_onFileRenamed Handle file rename events (e.g., from an atomic save)
  *
- * When QSaveFile commits, it renames a temp file to the target file,
+ * When a file is saved atomically, it renames a temp file to the target file,
  * which changes the inode and invalidates file watchers. This handler
  * reloads the configuration data and restarts the watcher.
  *
@@ -356,7 +643,7 @@ void SettingsPrivate::_q_onFileRenamed(const QUrl &fromUrl, const QUrl &toUrl)
 /*!
  * \brief SettingsPrivate::restartWatcher Restart file watcher to monitor the current file
  *
- * This is necessary when the file inode changes (e.g., after QSaveFile commit)
+ * This is necessary when the file inode changes (e.g., after an atomic save)
  */
 void SettingsPrivate::restartWatcher()
 {
@@ -381,6 +668,8 @@ Settings::Settings(const QString &defaultFile, const QString &fallbackFile, cons
 
     d->fromJsonFile(defaultFile, &d->defaultData);
     d->fromJsonFile(fallbackFile, &d->fallbackData);
+    // 同一文件可能还有其他实例未写完的内容
+    SettingsWriter::instance()->finish(settingFile, false);
     d->fromJsonFile(settingFile, &d->writableData);
 }
 /*!
@@ -433,9 +722,8 @@ Settings::~Settings()
         d->syncTimer->stop();
     }
 
-    if (d->settingFileIsDirty) {
-        sync();
-    }
+    // 包括自动同步已提交但尚未落盘的内容
+    sync();
 }
 /*!
  * \brief Settings::contains 判断是否包含这个键值的属性
@@ -899,47 +1187,30 @@ void Settings::reload()
 
     d->writableData.privateValues.clear();
     d->writableData.values.clear();
+    SettingsWriter::instance()->finish(d->settingFile, false);
     d->fromJsonFile(d->settingFile, &d->writableData);
 }
 /*!
- * \brief Settings::sync 将属性写入到配置文件中
+ * \brief Settings::sync 将属性写入到配置文件中并落盘
+ *
+ * 自动同步在后台线程写入且不 fsync，显式调用时在当前线程写完并 fsync
  *
  * \return  bool 是否写入成功
  */
 bool Settings::sync()
 {
-    if (!d->settingFileIsDirty) {
-        return true;
-    }
-
     // read-only mode: clear dirty flag without writing
     if (d->readOnly) {
         d->makeSettingFileToDirty(false);
         return true;
     }
 
-    const QByteArray &json = d->toJson(d->writableData);
-
-    // Use QSaveFile for atomic write to prevent data corruption
-    // on crash, power failure, or disk full conditions
-    QSaveFile file(d->settingFile);
+    if (!d->settingFileIsDirty)
+        return SettingsWriter::instance()->finish(d->settingFile, true);
 
-    if (!file.open(QIODevice::WriteOnly)) {
-        qCWarning(logDFMBase) << "Failed to open settings file for writing:"
-                              << d->settingFile << file.errorString();
+    const SettingsWriter::Snapshot &snapshot = d->snapshot();
+    if (!SettingsWriter::instance()->finish(d->settingFile, true, &snapshot))
         return false;
-    }
-
-    if (file.write(json) != json.size()) {
-        qCWarning(logDFMBase) << "Failed to write settings data:" << file.errorString();
-        file.cancelWriting();
-        return false;
-    }
-
-    if (!file.commit()) {
-        qCWarning(logDFMBase) << "Failed to commit settings file:" << file.errorString();
-        return false;
-    }
 
     d->makeSettingFileToDirty(false);
     return true;
@@ -999,7 +1270,7 @@ void Settings::setAutoSync(bool autoSync)
             d->syncTimer->setSingleShot(true);
             d->syncTimer->setInterval(1000);
 
-            connect(d->syncTimer, &QTimer::timeout, this, &Settings::sync);
+            connect(d->syncTimer, &QTimer::timeout, this, [this] { d->postWrite(); });
         }
     } else {
         if (d->syncTimer) {
@@ -343,6 +343,11 @@ void TaskWidget::onShowTaskProccess(const JobInfoPointer JobInfo)
 
     qint64 current = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kCurrentProgressKey).value<qint64>();
     qint64 total = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kTotalSizeKey).value<qint64>();
+    // 边统计边拷贝时统计未完成，总大小不准确，进度保持不确定状态，统计完成后切换为精确值
+    const auto statisticState = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kStatisticStateKey)
+                                        .value<AbstractJobHandler::StatisticState>();
+    if (statisticState == AbstractJobHandler::StatisticState::kRunningState)
+        total = -1;
 
     qint64 value = 1;
 
@@ -395,6 +400,22 @@ void TaskWidget::onShowSpeedUpdatedInfo(const JobInfoPointer JobInfo)
         return;
     }
 
+    const QVariant &queueValue = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kIoQueueKey);
+    if (queueValue.isValid()) {
+        const int ahead = queueValue.toInt();
+        QString speedStr;
+        QString rmTimeStr;
+        if (ahead >= 0) {
+            speedStr = tr("Waiting for %1").arg(JobInfo->value(AbstractJobHandler::NotifyInfoKey::kIoDeviceKey).toString());
+            rmTimeStr = ahead > 0 ? tr("%n task(s) ahead", "", ahead) : tr("Starting soon");
+        }
+        preHoverSpeedStr = speedStr;
+        lbSpeed->setText(speedStr);
+        preHoverRmTimeStr = rmTimeStr;
+        lbRmTime->setText(rmTimeStr);
+        return;
+    }
+
     const QVariant &speedValue = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kSpeedKey);
     const QVariant &remindValue = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kRemindTimeKey);
     if (speedValue.isValid()) {
@@ -405,6 +426,9 @@ void TaskWidget::onShowSpeedUpdatedInfo(const JobInfoPointer JobInfo)
             speedStr = FileUtils::formatSize(speed) + "/s";
         else
             speedStr = speedValue.toString();
+        const QVariant &verifyValue = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kVerifySpeedKey);
+        if (ok && verifyValue.isValid())
+            speedStr += " " + tr("(verified %1/s)").arg(FileUtils::formatSize(verifyValue.toLongLong()));
         preHoverSpeedStr = speedStr;
         lbSpeed->setText(speedStr);
     }
@@ -417,8 +441,13 @@ void TaskWidget::onShowSpeedUpdatedInfo(const JobInfoPointer JobInfo)
             rmTimeStr = formatTime(rmTime);
         else
             rmTimeStr = remindValue.toString();
-        if (rmTime < 0)
-            rmTimeStr = "";
+        if (rmTime < 0) {
+            const auto statisticState = JobInfo->value(AbstractJobHandler::NotifyInfoKey::kStatisticStateKey)
+                                                .value<AbstractJobHandler::StatisticState>();
+            rmTimeStr = statisticState == AbstractJobHandler::StatisticState::kRunningState
+                    ? tr("Calculating...")
+                    : "";
+        }
         preHoverRmTimeStr = rmTimeStr;
         lbRmTime->setText(rmTimeStr);
     }
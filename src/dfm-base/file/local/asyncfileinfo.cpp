@@ -90,7 +90,7 @@ void AsyncFileInfo::refresh()
 void AsyncFileInfo::cacheAttribute(DFileInfo::AttributeID id, const QVariant &value)
 {
     QMutexLocker locker(&d->lock);
-    d->cacheAsyncAttributes.insert(static_cast<FileInfo::FileInfoAttributeID>(id), value);
+    d->cacheAsyncAttributes.insert(id, value);
 }
 
 QString AsyncFileInfo::nameOf(const NameInfoType type) const
@@ -1215,10 +1215,7 @@ int AsyncFileInfoPrivate::cacheAllAttributes(const QString &attributes)
 bool AsyncFileInfoPrivate::insertAsyncAttribute(const FileInfo::FileInfoAttributeID id, const QVariant &value)
 {
     QMutexLocker lk(&lock);
-    if (cacheAsyncAttributes.value(id) == value || !value.isValid())
-        return false;
-    cacheAsyncAttributes.insert(id, value);
-    return true;
+    return cacheAsyncAttributes.insert(id, value);
 }
 
 void AsyncFileInfoPrivate::fileMimeTypeAsync(QMimeDatabase::MatchMode mode)
@@ -5,15 +5,23 @@
 #include "file/local/localfilewatcher.h"
 #include "file/local/private/localfilewatcher_p.h"
 #include <dfm-base/base/urlroute.h>
+#include <dfm-base/utils/protocolutils.h>
 
 #include <dfm-io/dwatcher.h>
 
 #include <QEvent>
 #include <QDir>
+#include <QSet>
+#include <QFileInfo>
 #include <QDebug>
 #include <QApplication>
 
+#include <sys/inotify.h>
+
 namespace dfmbase {
+// 写文件时每次write都会产生IN_MODIFY，在这段时间内合并为一次通知
+static constexpr int kChangeMergeInterval { 200 };   // ms
+
 /*!
  * \class AbstractFileWatcherPrivate 文件监视器私有类
  *
@@ -23,6 +31,12 @@ LocalFileWatcherPrivate::LocalFileWatcherPrivate(const QUrl &fileUrl, LocalFileW
     : AbstractFileWatcherPrivate(fileUrl, qq)
 {
 }
+
+LocalFileWatcherPrivate::~LocalFileWatcherPrivate()
+{
+    if (inotifyToken >= 0)
+        InotifyMultiplexer::instance()->unsubscribe(inotifyToken);
+}
 /*!
  * \brief start 启动文件监视器
  *
@@ -32,6 +46,15 @@ LocalFileWatcherPrivate::LocalFileWatcherPrivate(const QUrl &fileUrl, LocalFileW
  */
 bool LocalFileWatcherPrivate::start()
 {
+    if (useInotify) {
+        if (startInotify())
+            return true;
+        // 例如inotify的监视数量已达上限，仍使用dfm-io的监视器
+        useInotify = false;
+        watcher.reset(new DWatcher(url));
+        initConnect();
+    }
+
     if (watcher.isNull()) {
         qCWarning(logDFMBase) << "LocalFileWatcher::start: Cannot start watcher, watcher instance is null";
         return false;
@@ -62,6 +85,16 @@ bool LocalFileWatcherPrivate::start()
  */
 bool LocalFileWatcherPrivate::stop()
 {
+    if (useInotify) {
+        if (inotifyToken >= 0)
+            InotifyMultiplexer::instance()->unsubscribe(inotifyToken);
+        inotifyToken = -1;
+        changedUrls.clear();
+        if (changeTimer)
+            changeTimer->stop();
+        return true;
+    }
+
     if (watcher.isNull()) {
         qCWarning(logDFMBase) << "LocalFileWatcher::stop: Cannot stop watcher, watcher instance is null";
         return false;
@@ -90,6 +123,11 @@ LocalFileWatcher::LocalFileWatcher(const QUrl &url, QObject *parent)
 void LocalFileWatcherPrivate::initFileWatcher()
 {
     qCDebug(logDFMBase) << "LocalFileWatcher::initFileWatcher: Initializing file watcher for:" << url;
+    if (canUseInotify(url)) {
+        useInotify = true;
+        return;
+    }
+
     watcher.reset(new DWatcher(url));
     if (!watcher) {
         qCCritical(logDFMBase) << "LocalFileWatcher::initFileWatcher: Critical error - failed to create DWatcher instance for:" << url;
@@ -102,12 +140,115 @@ void LocalFileWatcherPrivate::initFileWatcher()
  */
 void LocalFileWatcherPrivate::initConnect()
 {
+    if (watcher.isNull())
+        return;
+
     connect(watcher.data(), &DWatcher::fileChanged, q, &AbstractFileWatcher::fileAttributeChanged);
     connect(watcher.data(), &DWatcher::fileDeleted, q, &AbstractFileWatcher::fileDeleted);
     connect(watcher.data(), &DWatcher::fileAdded, q, &AbstractFileWatcher::subfileCreated);
     connect(watcher.data(), &DWatcher::fileRenamed, q, &AbstractFileWatcher::fileRename);
 }
 
+/*!
+ * \brief canUseInotify 本地文件系统上的文件使用进程共享的inotify监视，
+ * gvfs等远程挂载的文件收不到inotify事件，仍使用GIO的监视器
+ */
+bool LocalFileWatcherPrivate::canUseInotify(const QUrl &url)
+{
+    if (!url.isLocalFile() || url.path().isEmpty())
+        return false;
+    if (ProtocolUtils::isRemoteFile(url))
+        return false;
+
+    return InotifyMultiplexer::instance()->isValid();
+}
+
+bool LocalFileWatcherPrivate::startInotify()
+{
+    if (inotifyToken >= 0)
+        return started;
+
+    if (!QFileInfo::exists(path)) {
+        qCWarning(logDFMBase) << "LocalFileWatcher::start: Failed to start watcher, target directory does not exist:" << url;
+        return false;
+    }
+
+    inotifyToken = InotifyMultiplexer::instance()->subscribe(path, q, [this](const QList<InotifyEvent> &events) {
+        handleInotifyEvents(events);
+    });
+    started = inotifyToken >= 0;
+    return started;
+}
+
+/*!
+ * \brief handleInotifyEvents 将一批inotify事件转换为监视器的信号，
+ * 文件的修改事件按路径合并，在kChangeMergeInterval内只通知一次
+ */
+void LocalFileWatcherPrivate::handleInotifyEvents(const QList<InotifyEvent> &events)
+{
+    if (inotifyToken < 0)
+        return;
+
+    for (const InotifyEvent &event : events) {
+        const QUrl &eventUrl = event.name.isEmpty()
+                ? url
+                : QUrl::fromLocalFile(path.endsWith('/') ? path + event.name : path + '/' + event.name);
+
+        if (event.mask & IN_Q_OVERFLOW) {
+            qCWarning(logDFMBase) << "LocalFileWatcher: inotify queue overflowed, rescan:" << url;
+            emit q->rescanRequested(url);
+        } else if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+            changedUrls.clear();
+            emit q->fileDeleted(url);
+        } else if (event.mask & IN_MOVED_FROM) {
+            dropChanged(eventUrl);
+            if (event.movedPath.isEmpty())
+                emit q->fileDeleted(eventUrl);
+            else
+                emit q->fileRename(eventUrl, QUrl::fromLocalFile(event.movedPath));
+        } else if (event.mask & IN_MOVED_TO) {
+            if (event.movedPath.isEmpty())
+                emit q->subfileCreated(eventUrl);
+            else if (QFileInfo(event.movedPath).absolutePath() != path)
+                emit q->fileRename(QUrl::fromLocalFile(event.movedPath), eventUrl);   // 同目录下的重命名已在IN_MOVED_FROM中通知
+        } else if (event.mask & IN_CREATE) {
+            emit q->subfileCreated(eventUrl);
+        } else if (event.mask & IN_DELETE) {
+            dropChanged(eventUrl);
+            emit q->fileDeleted(eventUrl);
+        } else if (event.mask & (IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE)) {
+            queueChanged(eventUrl);
+        }
+    }
+}
+
+void LocalFileWatcherPrivate::queueChanged(const QUrl &fileUrl)
+{
+    changedUrls.insert(fileUrl);
+    if (!changeTimer) {
+        // 在事件所在的线程中创建
+        changeTimer = new QTimer(this);
+        changeTimer->setSingleShot(true);
+        changeTimer->setInterval(kChangeMergeInterval);
+        connect(changeTimer, &QTimer::timeout, this, &LocalFileWatcherPrivate::flushChanged);
+    }
+    if (!changeTimer->isActive())
+        changeTimer->start();
+}
+
+void LocalFileWatcherPrivate::dropChanged(const QUrl &fileUrl)
+{
+    changedUrls.remove(fileUrl);
+}
+
+void LocalFileWatcherPrivate::flushChanged()
+{
+    const QSet<QUrl> urls = std::move(changedUrls);
+    changedUrls.clear();
+    for (const QUrl &changed : urls)
+        emit q->fileAttributeChanged(changed);
+}
+
 void LocalFileWatcher::notifyFileAdded(const QUrl &url)
 {
     qCDebug(logDFMBase) << "LocalFileWatcher::notifyFileAdded: File added notification for:" << url;
@@ -6,6 +6,7 @@
 #define ASYNCFILEINFO_P_H
 
 #include "infodatafuture.h"
+#include "fileattributestore.h"
 
 #include <dfm-base/file/local/asyncfileinfo.h>
 #include <dfm-base/utils/fileutils.h>
@@ -48,7 +49,7 @@ public:
     QSharedPointer<InfoDataFuture> mediaFuture { nullptr };
     InfoHelperUeserDataPointer fileCountFuture { nullptr };
     InfoHelperUeserDataPointer updateFileCountFuture { nullptr };
-    QMap<FileInfo::FileInfoAttributeID, QVariant> cacheAsyncAttributes;
+    FileAttributeStore cacheAsyncAttributes;
     mutable QMutex notifyLock;
     QMultiMap<QUrl, QString> notifyUrls;
     quint64 tokenKey { 0 };
@@ -0,0 +1,326 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "fileattributestore.h"
+
+#include <QReadWriteLock>
+#include <QVector>
+
+using namespace dfmbase;
+
+namespace {
+// MIME types, icon names and owners repeat across thousands of files
+template<typename T>
+class InternPool
+{
+public:
+    quint32 intern(const T &value)
+    {
+        {
+            QReadLocker lk(&lock);
+            auto it = ids.constFind(value);
+            if (it != ids.cend())
+                return it.value();
+        }
+
+        QWriteLocker lk(&lock);
+        auto it = ids.constFind(value);
+        if (it != ids.cend())
+            return it.value();
+        values.append(value);
+        const quint32 id = static_cast<quint32>(values.size());   // 0 is reserved for not set
+        ids.insert(value, id);
+        return id;
+    }
+
+    T value(quint32 id) const
+    {
+        QReadLocker lk(&lock);
+        return id > 0 && id <= static_cast<quint32>(values.size()) ? values.at(static_cast<int>(id - 1)) : T();
+    }
+
+private:
+    mutable QReadWriteLock lock;
+    QHash<T, quint32> ids;
+    QVector<T> values;
+};
+
+InternPool<QString> *stringPool()
+{
+    static InternPool<QString> pool;
+    return &pool;
+}
+
+InternPool<QStringList> *iconPool()
+{
+    static InternPool<QStringList> pool;
+    return &pool;
+}
+}   // namespace
+
+FileAttributeStore::Slot FileAttributeStore::slotOf(AttributeID id)
+{
+    using ID = AttributeID;
+    // presence bits: numbers 0-5, smalls 6-11, flags 12-24, file type 25, texts 26-33
+    static constexpr quint8 kSmallBit = kNumberCount;
+    static constexpr quint8 kFlagBit = kSmallBit + kSmallCount;
+    static constexpr quint8 kFileTypeBit = kFlagBit + 13;
+    static constexpr quint8 kTextBit = kFileTypeBit + 1;
+
+    auto number = [](Number index) { return Slot { Slot::kNumber, index, index }; };
+    auto small = [](Small index) { return Slot { Slot::kSmall, index, static_cast<quint8>(kSmallBit + index) }; };
+    auto flag = [](quint8 index) { return Slot { Slot::kFlag, index, static_cast<quint8>(kFlagBit + index) }; };
+    auto text = [](Text index) { return Slot { Slot::kText, index, static_cast<quint8>(kTextBit + index) }; };
+    auto internedSlot = [](Interned index) { return Slot { Slot::kInterned, index, 0 }; };
+
+    switch (id) {
+    case ID::kStandardSize:
+        return number(kSize);
+    case ID::kTimeModified:
+        return number(kModified);
+    case ID::kTimeAccess:
+        return number(kAccess);
+    case ID::kTimeChanged:
+        return number(kChanged);
+    case ID::kTimeCreated:
+        return number(kCreated);
+    case ID::kUnixInode:
+        return number(kInode);
+    case ID::kTimeModifiedUsec:
+        return small(kModifiedUsec);
+    case ID::kTimeAccessUsec:
+        return small(kAccessUsec);
+    case ID::kTimeChangedUsec:
+        return small(kChangedUsec);
+    case ID::kTimeCreatedUsec:
+        return small(kCreatedUsec);
+    case ID::kUnixUID:
+        return small(kUid);
+    case ID::kUnixGID:
+        return small(kGid);
+    case ID::kStandardIsHidden:
+        return flag(0);
+    case ID::kStandardIsSymlink:
+        return flag(1);
+    case ID::kStandardFileExists:
+        return flag(2);
+    case ID::kStandardIsLocalDevice:
+        return flag(3);
+    case ID::kStandardIsCdRomDevice:
+        return flag(4);
+    case ID::kStandardIsFile:
+        return flag(5);
+    case ID::kStandardIsDir:
+        return flag(6);
+    case ID::kAccessCanRead:
+        return flag(7);
+    case ID::kAccessCanWrite:
+        return flag(8);
+    case ID::kAccessCanExecute:
+        return flag(9);
+    case ID::kAccessCanDelete:
+        return flag(10);
+    case ID::kAccessCanTrash:
+        return flag(11);
+    case ID::kAccessCanRename:
+        return flag(12);
+    case ID::kStandardFileType:
+        return Slot { Slot::kFileType, 0, kFileTypeBit };
+    case ID::kStandardContentType:
+        return internedSlot(kContentType);
+    case ID::kStandardFastContentType:
+        return internedSlot(kFastContentType);
+    case ID::kStandardIcon:
+        return internedSlot(kIcon);
+    case ID::kOwnerUser:
+        return internedSlot(kOwnerUser);
+    case ID::kOwnerGroup:
+        return internedSlot(kOwnerGroup);
+    case ID::kStandardName:
+        return text(kName);
+    case ID::kStandardDisplayName:
+        return text(kDisplayName);
+    case ID::kStandardBaseName:
+        return text(kBaseName);
+    case ID::kStandardCompleteBaseName:
+        return text(kCompleteBaseName);
+    case ID::kStandardCompleteSuffix:
+        return text(kCompleteSuffix);
+    case ID::kStandardFilePath:
+        return text(kFilePath);
+    case ID::kStandardParentPath:
+        return text(kParentPath);
+    case ID::kStandardSymlinkTarget:
+        return text(kSymlinkTarget);
+    default:
+        return {};
+    }
+}
+
+bool FileAttributeStore::contains(AttributeID id) const
+{
+    const Slot &slot = slotOf(id);
+    if (slot.kind == Slot::kInterned) {
+        if (interned[slot.index] != 0)
+            return true;
+    } else if (slot.kind != Slot::kNone && (present & (quint64(1) << slot.bit))) {
+        return true;
+    }
+
+    return extra && extra->contains(static_cast<quint16>(id));
+}
+
+QVariant FileAttributeStore::value(AttributeID id) const
+{
+    const Slot &slot = slotOf(id);
+    const bool isSet = slot.kind == Slot::kInterned
+            ? interned[slot.index] != 0
+            : slot.kind != Slot::kNone && (present & (quint64(1) << slot.bit));
+
+    if (!isSet)
+        return extra ? extra->value(static_cast<quint16>(id)) : QVariant();
+
+    switch (slot.kind) {
+    case Slot::kNumber:
+        if (slot.index == kInode)
+            return QVariant::fromValue(static_cast<quint64>(numbers[slot.index]));
+        return QVariant::fromValue(numbers[slot.index]);
+    case Slot::kSmall:
+        return QVariant::fromValue(smalls[slot.index]);
+    case Slot::kFlag:
+        return QVariant::fromValue(bool(flags & (1 << slot.index)));
+    case Slot::kFileType:
+        return QVariant::fromValue(static_cast<FileInfo::FileType>(fileType));
+    case Slot::kInterned:
+        if (slot.index == kIcon)
+            return QVariant::fromValue(iconPool()->value(interned[slot.index]));
+        return QVariant::fromValue(stringPool()->value(interned[slot.index]));
+    case Slot::kText:
+        return QVariant::fromValue((*texts)[slot.index]);
+    default:
+        return QVariant();
+    }
+}
+
+bool FileAttributeStore::insert(AttributeID id, const QVariant &value)
+{
+    if (!value.isValid())
+        return false;
+
+    const Slot &slot = slotOf(id);
+    const quint64 bit = quint64(1) << slot.bit;
+    const bool wasSet = slot.kind != Slot::kInterned && (present & bit);
+    bool ok = false;
+    bool changed = false;
+
+    switch (slot.kind) {
+    case Slot::kNumber: {
+        const qint64 v = value.toLongLong(&ok);
+        if (ok) {
+            changed = !wasSet || numbers[slot.index] != v;
+            numbers[slot.index] = v;
+        }
+        break;
+    }
+    case Slot::kSmall: {
+        const quint32 v = value.toUInt(&ok);
+        if (ok) {
+            changed = !wasSet || smalls[slot.index] != v;
+            smalls[slot.index] = v;
+        }
+        break;
+    }
+    case Slot::kFlag: {
+        ok = value.canConvert<bool>();
+        if (ok) {
+            const quint16 mask = static_cast<quint16>(1 << slot.index);
+            const quint16 v = value.toBool() ? mask : 0;
+            changed = !wasSet || (flags & mask) != v;
+            flags = static_cast<quint16>((flags & ~mask) | v);
+        }
+        break;
+    }
+    case Slot::kFileType: {
+        ok = value.metaType() == QMetaType::fromType<FileInfo::FileType>();
+        if (ok) {
+            const quint16 v = static_cast<quint16>(value.value<FileInfo::FileType>());
+            changed = !wasSet || fileType != v;
+            fileType = v;
+        }
+        break;
+    }
+    case Slot::kInterned: {
+        quint32 v = 0;
+        if (slot.index == kIcon && value.typeId() == QMetaType::QStringList) {
+            v = iconPool()->intern(value.toStringList());
+            ok = true;
+        } else if (slot.index != kIcon && value.typeId() == QMetaType::QString) {
+            v = stringPool()->intern(value.toString());
+            ok = true;
+        }
+        if (ok) {
+            changed = interned[slot.index] != v;
+            interned[slot.index] = v;
+        }
+        break;
+    }
+    case Slot::kText: {
+        ok = value.typeId() == QMetaType::QString;
+        if (ok) {
+            if (!texts)
+                texts.reset(new std::array<QString, kTextCount>);
+            const QString &v = value.toString();
+            changed = !wasSet || (*texts)[slot.index] != v;
+            (*texts)[slot.index] = v;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (!ok) {
+        // a type the block cannot hold, keep it as it is
+        if (slot.kind == Slot::kInterned)
+            interned[slot.index] = 0;
+        else if (slot.kind != Slot::kNone)
+            present &= ~bit;
+        return insertExtra(id, value);
+    }
+
+    if (slot.kind != Slot::kInterned)
+        present |= bit;
+    if (extra && extra->remove(static_cast<quint16>(id)) > 0)
+        changed = true;
+    return changed;
+}
+
+void FileAttributeStore::clear()
+{
+    numbers.fill(0);
+    smalls.fill(0);
+    interned.fill(0);
+    present = 0;
+    flags = 0;
+    fileType = 0;
+    texts.reset();
+    extra.reset();
+}
+
+bool FileAttributeStore::insertExtra(AttributeID id, const QVariant &value)
+{
+    if (!extra)
+        extra.reset(new QHash<quint16, QVariant>);
+
+    auto it = extra->find(static_cast<quint16>(id));
+    if (it != extra->end()) {
+        if (it.value() == value)
+            return false;
+        it.value() = value;
+        return true;
+    }
+
+    extra->insert(static_cast<quint16>(id), value);
+    return true;
+}
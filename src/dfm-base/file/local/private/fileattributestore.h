@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FILEATTRIBUTESTORE_H
+#define FILEATTRIBUTESTORE_H
+
+#include <dfm-base/dfm_base_global.h>
+#include <dfm-base/interfaces/fileinfo.h>
+
+#include <QVariant>
+#include <QHash>
+
+#include <array>
+#include <memory>
+
+namespace dfmbase {
+
+/*!
+ * \brief The cached attributes of a local file info
+ *
+ * Every cached info used to keep its attributes in a QMap of QVariant, that
+ * is a heap node per attribute. The stat fields, which every info has, are
+ * kept here in a fixed block instead. MIME types, icon names and owners are
+ * shared by many files, they are interned and only an id is kept. The file
+ * names and paths, and everything else in a side hash, are allocated on
+ * first use.
+ *
+ * It is not thread safe, the owner guards it with its own lock.
+ */
+class FileAttributeStore
+{
+public:
+    using AttributeID = FileInfo::FileInfoAttributeID;
+
+    FileAttributeStore() = default;
+    Q_DISABLE_COPY(FileAttributeStore)
+
+    bool contains(AttributeID id) const;
+    QVariant value(AttributeID id) const;
+    // returns false if the value is invalid or not changed
+    bool insert(AttributeID id, const QVariant &value);
+    void clear();
+
+    bool contains(DFMIO::DFileInfo::AttributeID id) const { return contains(static_cast<AttributeID>(id)); }
+    QVariant value(DFMIO::DFileInfo::AttributeID id) const { return value(static_cast<AttributeID>(id)); }
+    bool insert(DFMIO::DFileInfo::AttributeID id, const QVariant &v) { return insert(static_cast<AttributeID>(id), v); }
+
+private:
+    enum Number : quint8 {
+        kSize,
+        kModified,
+        kAccess,
+        kChanged,
+        kCreated,
+        kInode,
+        kNumberCount
+    };
+    enum Small : quint8 {
+        kModifiedUsec,
+        kAccessUsec,
+        kChangedUsec,
+        kCreatedUsec,
+        kUid,
+        kGid,
+        kSmallCount
+    };
+    enum Interned : quint8 {
+        kContentType,
+        kFastContentType,
+        kIcon,
+        kOwnerUser,
+        kOwnerGroup,
+        kInternedCount
+    };
+    enum Text : quint8 {
+        kName,
+        kDisplayName,
+        kBaseName,
+        kCompleteBaseName,
+        kCompleteSuffix,
+        kFilePath,
+        kParentPath,
+        kSymlinkTarget,
+        kTextCount
+    };
+
+    struct Slot
+    {
+        enum Kind : quint8 {
+            kNone,
+            kNumber,
+            kSmall,
+            kFlag,
+            kInterned,
+            kText,
+            kFileType
+        } kind { kNone };
+        quint8 index { 0 };
+        quint8 bit { 0 };   // in the presence mask, interned values use id 0 instead
+    };
+    static Slot slotOf(AttributeID id);
+
+    bool insertExtra(AttributeID id, const QVariant &value);
+
+    // hot stat fields, always allocated
+    std::array<qint64, kNumberCount> numbers {};
+    std::array<quint32, kSmallCount> smalls {};
+    std::array<quint32, kInternedCount> interned {};   // 0 means not set
+    quint64 present { 0 };
+    quint16 flags { 0 };
+    quint16 fileType { 0 };
+
+    std::unique_ptr<std::array<QString, kTextCount>> texts;
+    std::unique_ptr<QHash<quint16, QVariant>> extra;
+};
+
+}
+
+#endif   // FILEATTRIBUTESTORE_H
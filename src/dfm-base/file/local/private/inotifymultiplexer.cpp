@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "inotifymultiplexer.h"
+
+#include <QFile>
+#include <QDebug>
+
+#include <algorithm>
+
+#include <sys/inotify.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+using namespace dfmbase;
+
+namespace {
+constexpr quint32 kWatchMask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO
+        | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF;
+constexpr int kReadBufferSize = 64 * 1024;
+
+inline QString joinPath(const QString &dir, const QString &name)
+{
+    if (name.isEmpty())
+        return dir;
+    return dir.endsWith('/') ? dir + name : dir + '/' + name;
+}
+}   // namespace
+
+InotifyMultiplexer *InotifyMultiplexer::instance()
+{
+    static InotifyMultiplexer ins;
+    return &ins;
+}
+
+InotifyMultiplexer::InotifyMultiplexer()
+{
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    bool ok = inotifyFd >= 0 && epollFd >= 0 && wakeFd >= 0;
+    for (int fd : { inotifyFd, wakeFd }) {
+        if (!ok)
+            break;
+        epoll_event ev {};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        ok = epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) == 0;
+    }
+
+    if (!ok) {
+        qCWarning(logDFMBase) << "InotifyMultiplexer: failed to create the inotify instance:" << strerror(errno);
+        for (int *fd : { &inotifyFd, &epollFd, &wakeFd }) {
+            if (*fd >= 0)
+                ::close(*fd);
+            *fd = -1;
+        }
+        return;
+    }
+
+    thread = std::thread([this]() { run(); });
+}
+
+InotifyMultiplexer::~InotifyMultiplexer()
+{
+    if (!isValid())
+        return;
+
+    const quint64 quit = 1;
+    if (::write(wakeFd, &quit, sizeof(quit)) < 0)
+        qCWarning(logDFMBase) << "InotifyMultiplexer: failed to wake up the event thread:" << strerror(errno);
+    if (thread.joinable())
+        thread.join();
+
+    ::close(inotifyFd);
+    ::close(epollFd);
+    ::close(wakeFd);
+}
+
+bool InotifyMultiplexer::isValid() const
+{
+    return inotifyFd >= 0;
+}
+
+int InotifyMultiplexer::subscribe(const QString &path, QObject *context, Handler handler)
+{
+    if (!isValid() || path.isEmpty() || !context || !handler)
+        return -1;
+
+    QMutexLocker lk(&mutex);
+    // the same inode gives the same wd, so does a path watched twice
+    const int wd = inotify_add_watch(inotifyFd, QFile::encodeName(path).constData(), kWatchMask);
+    if (wd < 0) {
+        qCWarning(logDFMBase) << "InotifyMultiplexer: failed to watch" << path << strerror(errno);
+        return -1;
+    }
+
+    ++wdRefs[wd];
+    QStringList &paths = wdPaths[wd];
+    if (!paths.contains(path))
+        paths.append(path);
+
+    const int token = ++nextToken;
+    subscribers.insert(token, Subscriber { path, wd, context, std::move(handler) });
+    return token;
+}
+
+void InotifyMultiplexer::unsubscribe(int token)
+{
+    QMutexLocker lk(&mutex);
+    auto it = subscribers.find(token);
+    if (it == subscribers.end())
+        return;
+
+    const int wd = it->wd;
+    const QString path = it->path;
+    subscribers.erase(it);
+    if (wd < 0)
+        return;
+
+    const bool pathInUse = std::any_of(subscribers.cbegin(), subscribers.cend(), [wd, &path](const Subscriber &sub) {
+        return sub.wd == wd && sub.path == path;
+    });
+    if (!pathInUse) {
+        auto paths = wdPaths.find(wd);
+        if (paths != wdPaths.end())
+            paths->removeOne(path);
+    }
+    releaseWatch(wd);
+}
+
+int InotifyMultiplexer::watchCount() const
+{
+    QMutexLocker lk(&mutex);
+    return wdRefs.size();
+}
+
+void InotifyMultiplexer::releaseWatch(int wd)
+{
+    auto it = wdRefs.find(wd);
+    if (it == wdRefs.end() || --it.value() > 0)
+        return;
+
+    wdRefs.erase(it);
+    wdPaths.remove(wd);
+    inotify_rm_watch(inotifyFd, wd);
+}
+
+QString InotifyMultiplexer::watchedPath(int wd, const Subscriber &subscriber) const
+{
+    if (wd == subscriber.wd)
+        return subscriber.path;
+    const QStringList &paths = wdPaths.value(wd);
+    return paths.isEmpty() ? QString() : paths.first();
+}
+
+void InotifyMultiplexer::run()
+{
+    epoll_event evs[2];
+    while (true) {
+        const int n = epoll_wait(epollFd, evs, 2, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            qCWarning(logDFMBase) << "InotifyMultiplexer: epoll_wait failed:" << strerror(errno);
+            return;
+        }
+
+        bool hasEvents = false;
+        for (int i = 0; i < n; ++i) {
+            if (evs[i].data.fd == wakeFd)
+                return;
+            hasEvents = true;
+        }
+
+        QList<RawEvent> events;
+        if (hasEvents && readEvents(&events) && !events.isEmpty())
+            dispatch(events);
+    }
+}
+
+bool InotifyMultiplexer::readEvents(QList<RawEvent> *events)
+{
+    alignas(struct inotify_event) char buf[kReadBufferSize];
+    while (true) {
+        const ssize_t len = ::read(inotifyFd, buf, sizeof(buf));
+        if (len < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        if (len == 0)
+            return false;
+
+        for (const char *p = buf; p < buf + len;) {
+            const auto *ev = reinterpret_cast<const struct inotify_event *>(p);
+            RawEvent raw;
+            raw.wd = ev->wd;
+            raw.mask = ev->mask;
+            raw.cookie = ev->cookie;
+            if (ev->len > 0)
+                raw.name = QFile::decodeName(ev->name);
+            events->append(raw);
+            p += sizeof(struct inotify_event) + ev->len;
+        }
+    }
+}
+
+void InotifyMultiplexer::dispatch(const QList<RawEvent> &events)
+{
+    QMutexLocker lk(&mutex);
+
+    bool overflow = false;
+    QHash<int, QList<DirEvent>> dirEvents;
+    QHash<quint32, QPair<int, int>> movedFrom;   // cookie, wd and index in the dir events
+    QList<int> ignored;
+
+    for (const RawEvent &raw : events) {
+        if (raw.mask & IN_Q_OVERFLOW) {
+            overflow = true;
+            continue;
+        }
+        if (raw.mask & IN_IGNORED) {
+            ignored.append(raw.wd);
+            continue;
+        }
+        if (!wdPaths.contains(raw.wd))
+            continue;
+
+        DirEvent event { InotifyEvent { raw.name, raw.mask, QString() }, -1, QString() };
+        if ((raw.mask & IN_MOVED_TO) && movedFrom.contains(raw.cookie)) {
+            const auto from = movedFrom.take(raw.cookie);
+            DirEvent &fromEvent = dirEvents[from.first][from.second];
+            fromEvent.movedWd = raw.wd;
+            fromEvent.movedName = raw.name;
+            event.movedWd = from.first;
+            event.movedName = fromEvent.event.name;
+        }
+
+        QList<DirEvent> &list = dirEvents[raw.wd];
+        list.append(event);
+        if (raw.mask & IN_MOVED_FROM)
+            movedFrom.insert(raw.cookie, { raw.wd, list.size() - 1 });
+    }
+
+    for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+        QList<InotifyEvent> batch;
+        if (overflow)
+            batch.append(InotifyEvent { QString(), IN_Q_OVERFLOW, QString() });
+        if (it->wd >= 0) {
+            for (const DirEvent &dirEvent : dirEvents.value(it->wd)) {
+                InotifyEvent event = dirEvent.event;
+                if (dirEvent.movedWd >= 0)
+                    event.movedPath = joinPath(watchedPath(dirEvent.movedWd, *it), dirEvent.movedName);
+                batch.append(event);
+            }
+        }
+        if (batch.isEmpty() || it->context.isNull())
+            continue;
+
+        // posted under the lock, the context unsubscribes before it is destroyed
+        Handler handler = it->handler;
+        QMetaObject::invokeMethod(
+                it->context.data(), [handler, batch]() { handler(batch); }, Qt::QueuedConnection);
+    }
+
+    // the watched path is removed or unmounted, the kernel has dropped the watch
+    for (int wd : ignored) {
+        if (!wdRefs.remove(wd))
+            continue;
+        wdPaths.remove(wd);
+        for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+            if (it->wd == wd)
+                it->wd = -1;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef INOTIFYMULTIPLEXER_H
+#define INOTIFYMULTIPLEXER_H
+
+#include <dfm-base/dfm_base_global.h>
+
+#include <QObject>
+#include <QPointer>
+#include <QMutex>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+
+#include <functional>
+#include <thread>
+
+namespace dfmbase {
+
+struct InotifyEvent
+{
+    QString name;   // empty if the event is of the watched path itself
+    quint32 mask { 0 };
+    QString movedPath;   // the other side of a move, if both sides are watched
+};
+
+/*!
+ * \brief One inotify fd for all the local file watchers of the process
+ *
+ * A GIO monitor per directory means a main loop dispatch and a rate limiter
+ * per directory. Here every watched path shares one inotify fd read by one
+ * epoll thread, a path watched by many watchers has one watch descriptor,
+ * so do the paths of one directory, e.g. through a symlink.
+ * The events read at once are decoded into (dir, name, mask) records and
+ * posted to each subscriber as one batch, in the thread of its context.
+ * If the kernel queue overflows every subscriber gets an IN_Q_OVERFLOW
+ * record and should rescan its path.
+ */
+class InotifyMultiplexer
+{
+public:
+    using Handler = std::function<void(const QList<InotifyEvent> &events)>;
+
+    static InotifyMultiplexer *instance();
+    ~InotifyMultiplexer();
+
+    bool isValid() const;
+    // returns a token, or -1 if the path cannot be watched
+    int subscribe(const QString &path, QObject *context, Handler handler);
+    void unsubscribe(int token);
+    int watchCount() const;
+
+private:
+    struct Subscriber
+    {
+        QString path;
+        int wd { -1 };
+        QPointer<QObject> context;
+        Handler handler;
+    };
+    struct RawEvent
+    {
+        int wd { -1 };
+        quint32 mask { 0 };
+        quint32 cookie { 0 };
+        QString name;
+    };
+    // the other side of a move is kept as a wd, its path depends on the subscriber
+    struct DirEvent
+    {
+        InotifyEvent event;
+        int movedWd { -1 };
+        QString movedName;
+    };
+
+    InotifyMultiplexer();
+    Q_DISABLE_COPY(InotifyMultiplexer)
+
+    void run();
+    bool readEvents(QList<RawEvent> *events);
+    void dispatch(const QList<RawEvent> &events);
+    void releaseWatch(int wd);
+    QString watchedPath(int wd, const Subscriber &subscriber) const;
+
+    int inotifyFd { -1 };
+    int epollFd { -1 };
+    int wakeFd { -1 };
+    std::thread thread;
+
+    mutable QMutex mutex;
+    int nextToken { 0 };
+    QHash<int, Subscriber> subscribers;
+    QHash<int, QStringList> wdPaths;   // a wd is shared by every path of the inode, e.g. through a symlink
+    QHash<int, int> wdRefs;
+};
+
+}
+
+#endif   // INOTIFYMULTIPLEXER_H
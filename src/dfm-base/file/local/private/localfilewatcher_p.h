@@ -8,10 +8,13 @@
 #include <dfm-base/file/local/localfilewatcher.h>
 #include <dfm-base/interfaces/private/abstractfilewatcher_p.h>
 #include <dfm-base/utils/threadcontainer.h>
+#include "inotifymultiplexer.h"
 
 #include <dfm-io/dwatcher.h>
 
 #include <QUrl>
+#include <QTimer>
+#include <QSet>
 
 USING_IO_NAMESPACE
 namespace dfmbase {
@@ -22,14 +25,25 @@ class LocalFileWatcherPrivate : public AbstractFileWatcherPrivate
 
 public:
     explicit LocalFileWatcherPrivate(const QUrl &fileUrl, LocalFileWatcher *qq);
-    virtual ~LocalFileWatcherPrivate() {}
+    virtual ~LocalFileWatcherPrivate();
     virtual bool start();
     virtual bool stop();
     void initFileWatcher();
     void initConnect();
 
 private:
+    static bool canUseInotify(const QUrl &url);
+    bool startInotify();
+    void handleInotifyEvents(const QList<InotifyEvent> &events);
+    void queueChanged(const QUrl &fileUrl);
+    void dropChanged(const QUrl &fileUrl);
+    void flushChanged();
+
     QSharedPointer<DWatcher> watcher { nullptr };   // dfm-io的文件监视器
+    bool useInotify { false };   // 本地文件使用共享的inotify监视
+    int inotifyToken { -1 };
+    QTimer *changeTimer { nullptr };   // 合并连续写入产生的修改事件
+    QSet<QUrl> changedUrls;
 };
 }
 
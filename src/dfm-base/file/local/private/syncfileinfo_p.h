@@ -6,6 +6,7 @@
 #define SYNCFILEINFO_P_H
 
 #include "infodatafuture.h"
+#include "fileattributestore.h"
 
 #include <dfm-base/interfaces/private/fileinfo_p.h>
 #include <dfm-base/file/local/syncfileinfo.h>
@@ -46,7 +47,7 @@ public:
     QVariant isCdRomDevice;
     QSharedPointer<InfoDataFuture> mediaFuture { nullptr };
     InfoHelperUeserDataPointer fileMimeTypeFuture { nullptr };
-    QMap<DFMIO::DFileInfo::AttributeID, QVariant> cacheAttributes;
+    FileAttributeStore cacheAttributes;
 
 public:
     explicit SyncFileInfoPrivate(SyncFileInfo *qq);
@@ -1012,7 +1012,7 @@ QVariant SyncFileInfoPrivate::attribute(DFileInfo::AttributeID key, bool *ok) co
     // 多线程环境下，`initdfmFileInfo`和`reset`操作可能导致`dfmFileInfo`和`tmp`为null，从而返回错误属性。
     QMutexLocker locker(&lock);
     if (dfmFileInfo) {
-        if (cacheAttributes.count(key) > 0) {
+        if (cacheAttributes.contains(key)) {
             if (ok)
                 *ok = true;
             return cacheAttributes.value(key);
@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "mimeappsindex.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QLocale>
+#include <QSaveFile>
+#include <QSet>
+
+#include <algorithm>
+
+using namespace dfmbase;
+
+static constexpr quint32 kIndexMagic { 0x44464d41 };   // "DFMA"
+static constexpr quint32 kIndexVersion { 1 };
+
+MimeAppsIndex::MimeAppsIndex(const QString &cacheFile)
+    : cacheFile(cacheFile)
+{
+}
+
+bool MimeAppsIndex::load()
+{
+    desktopEntries.clear();
+    dirty = true;
+
+    QFile file(cacheFile);
+    if (cacheFile.isEmpty() || !file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString locale;
+    in >> magic >> version >> locale;
+    if (magic != kIndexMagic || version != kIndexVersion || locale != QLocale::system().name()) {
+        qCInfo(logDFMBase) << "MimeAppsIndex::load: Index is outdated, rebuild it:" << cacheFile;
+        return false;
+    }
+
+    quint32 count = 0;
+    in >> count;
+    QHash<QString, Entry> entries;
+    entries.reserve(static_cast<int>(count));
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        QString path;
+        Entry entry;
+        in >> path >> entry.modifiedTime >> entry.size >> entry.birthTime >> entry.desktop;
+        entries.insert(path, entry);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(logDFMBase) << "MimeAppsIndex::load: Index is corrupted, rebuild it:" << cacheFile;
+        return false;
+    }
+
+    desktopEntries = entries;
+    dirty = false;
+    return true;
+}
+
+bool MimeAppsIndex::save()
+{
+    if (cacheFile.isEmpty())
+        return false;
+
+    QDir().mkpath(QFileInfo(cacheFile).absolutePath());
+    QSaveFile file(cacheFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(logDFMBase) << "MimeAppsIndex::save: Cannot open index:" << cacheFile << file.errorString();
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << kIndexMagic << kIndexVersion << QLocale::system().name();
+    out << static_cast<quint32>(desktopEntries.size());
+    for (auto it = desktopEntries.cbegin(); it != desktopEntries.cend(); ++it)
+        out << it.key() << it->modifiedTime << it->size << it->birthTime << it->desktop;
+
+    if (!file.commit()) {
+        qCWarning(logDFMBase) << "MimeAppsIndex::save: Cannot write index:" << cacheFile << file.errorString();
+        return false;
+    }
+
+    dirty = false;
+    return true;
+}
+
+int MimeAppsIndex::refresh(const QStringList &folders)
+{
+    int changed = 0;
+    QSet<QString> seen;
+    seen.reserve(desktopEntries.size());
+
+    for (const QString &folder : folders) {
+        QDirIterator it(folder, QStringList("*.desktop"), QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            it.next();
+            const QString &filePath = it.filePath();
+            if (seen.contains(filePath))
+                continue;
+            seen.insert(filePath);
+
+            // the iterator has stat the file already
+            const QFileInfo &info = it.fileInfo();
+            auto entry = desktopEntries.find(filePath);
+            if (entry != desktopEntries.end()
+                && entry->modifiedTime == info.lastModified().toMSecsSinceEpoch()
+                && entry->size == info.size())
+                continue;
+
+            Entry parsed;
+            if (!parse(filePath, &parsed))
+                continue;
+            desktopEntries.insert(filePath, parsed);
+            ++changed;
+        }
+    }
+
+    for (auto it = desktopEntries.begin(); it != desktopEntries.end();) {
+        if (seen.contains(it.key())) {
+            ++it;
+        } else {
+            it = desktopEntries.erase(it);
+            ++changed;
+        }
+    }
+
+    if (changed > 0)
+        dirty = true;
+    return changed;
+}
+
+bool MimeAppsIndex::update(const QString &filePath)
+{
+    if (!filePath.endsWith(".desktop"))
+        return false;
+
+    const QFileInfo info(filePath);
+    if (!info.isFile()) {
+        if (desktopEntries.remove(filePath) == 0)
+            return false;
+        dirty = true;
+        return true;
+    }
+
+    auto entry = desktopEntries.find(filePath);
+    if (entry != desktopEntries.end()
+        && entry->modifiedTime == info.lastModified().toMSecsSinceEpoch()
+        && entry->size == info.size())
+        return false;
+
+    Entry parsed;
+    if (!parse(filePath, &parsed))
+        return false;
+    desktopEntries.insert(filePath, parsed);
+    dirty = true;
+    return true;
+}
+
+QMap<QString, QStringList> MimeAppsIndex::mimeApps(const QMap<QString, QStringList> &extraMimeTypes) const
+{
+    QHash<QString, QVector<QString>> appsOfMime;
+    for (auto it = desktopEntries.cbegin(); it != desktopEntries.cend(); ++it) {
+        if (it->desktop.isNoShow())
+            continue;
+
+        QStringList mimeTypes = it->desktop.desktopMimeType();
+        const QString &fileName = QFileInfo(it.key()).fileName();
+        auto extra = extraMimeTypes.constFind(fileName);
+        if (extra != extraMimeTypes.cend())
+            mimeTypes.append(extra.value());
+
+        for (const QString &mimeType : mimeTypes) {
+            if (mimeType.isEmpty())
+                continue;
+            appsOfMime[mimeType].append(it.key());
+        }
+    }
+
+    auto birthTime = [this](const QString &path) {
+        auto entry = desktopEntries.constFind(path);
+        return entry == desktopEntries.cend() ? qint64(-1) : entry->birthTime;
+    };
+
+    QMap<QString, QStringList> result;
+    for (auto it = appsOfMime.begin(); it != appsOfMime.end(); ++it) {
+        QVector<QString> &apps = it.value();
+        std::sort(apps.begin(), apps.end(), [&birthTime](const QString &l, const QString &r) {
+            const qint64 lt = birthTime(l);
+            const qint64 rt = birthTime(r);
+            return lt == rt ? l < r : lt < rt;
+        });
+        // a mime type listed twice by the same app
+        apps.erase(std::unique(apps.begin(), apps.end()), apps.end());
+        result.insert(it.key(), QStringList(apps.cbegin(), apps.cend()));
+    }
+    return result;
+}
+
+bool MimeAppsIndex::parse(const QString &filePath, Entry *entry) const
+{
+    const QFileInfo info(filePath);
+    if (!info.isFile())
+        return false;
+
+    entry->modifiedTime = info.lastModified().toMSecsSinceEpoch();
+    entry->size = info.size();
+    const QDateTime &birth = info.birthTime();
+    entry->birthTime = birth.isValid() ? birth.toMSecsSinceEpoch() : -1;
+    entry->desktop = DesktopFile(filePath);
+    return true;
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef MIMEAPPSINDEX_H
+#define MIMEAPPSINDEX_H
+
+#include <dfm-base/dfm_base_global.h>
+#include <dfm-base/utils/desktopfile.h>
+
+#include <QHash>
+#include <QMap>
+#include <QStringList>
+
+namespace dfmbase {
+
+/*!
+ * \brief Parsed desktop entries of the application folders, persisted between runs
+ *
+ * Every entry remembers the mtime and size it was parsed from, so a refresh only
+ * stats the folders and parses the desktop files that changed since the last run
+ * or the last refresh. The index is saved with the locale, localized names are
+ * parsed again when it changes.
+ *
+ * Not thread safe, MimesAppsManager serializes the access.
+ */
+class MimeAppsIndex
+{
+public:
+    struct Entry
+    {
+        qint64 modifiedTime { -1 };   // ms
+        qint64 size { -1 };
+        qint64 birthTime { -1 };   // ms, the order of apps sharing a mime type
+        DesktopFile desktop;
+    };
+
+    explicit MimeAppsIndex(const QString &cacheFile);
+
+    bool load();
+    bool save();
+    bool isDirty() const { return dirty; }
+
+    /*!
+     * \brief Walk folders, parse new or modified desktop files and drop removed ones
+     * \return number of entries added, updated or removed
+     */
+    int refresh(const QStringList &folders);
+
+    /*!
+     * \brief Bring a single path up to date, used for watcher notifications
+     * \return true if the entry changed
+     */
+    bool update(const QString &filePath);
+
+    const QHash<QString, Entry> &entries() const { return desktopEntries; }
+
+    // mime type -> visible apps, oldest first, extraMimeTypes is keyed by file name
+    QMap<QString, QStringList> mimeApps(const QMap<QString, QStringList> &extraMimeTypes) const;
+
+private:
+    bool parse(const QString &filePath, Entry *entry) const;
+
+    QString cacheFile;
+    QHash<QString, Entry> desktopEntries;
+    bool dirty { false };
+};
+
+}
+
+#endif   // MIMEAPPSINDEX_H
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "mimesappsmanager.h"
+#include "mimeappsindex.h"
 
 #include <dfm-base/mimetype/dmimedatabase.h>
 #include <dfm-base/mimetype/mimetypedisplaymanager.h>
@@ -11,7 +12,6 @@
 #include <QDir>
 #include <QSettings>
 #include <QMimeType>
-#include <QDirIterator>
 #include <QDateTime>
 #include <QThread>
 #include <QStandardPaths>
@@ -21,7 +21,7 @@
 #include <QApplication>
 #include <QDebug>
 #include <QUrl>
-#include <QStandardPaths>
+#include <QMutex>
 
 #undef signals
 extern "C" {
@@ -42,6 +42,26 @@ QMap<QString, DesktopFile> MimesAppsManager::TextMimeApps = {};
 QMap<QString, DesktopFile> MimesAppsManager::AudioMimeApps = {};
 QMap<QString, DesktopFile> MimesAppsManager::DesktopObjs = {};
 
+// the index is read from the GUI thread and updated from the worker thread
+static QMutex mimeAppsMutex;
+static bool mimeAppsLoaded { false };
+static qint64 ddeMimeTypesModified { -2 };
+static qint64 mimeInfoCacheModified { -2 };
+// mime type name -> recommended apps, cleared whenever MimeApps is rebuilt
+static QHash<QString, QStringList> recommendedAppsCache;
+
+static MimeAppsIndex *mimeAppsIndex()
+{
+    static MimeAppsIndex index(MimesAppsManager::getMimeAppsIndexFile());
+    return &index;
+}
+
+static qint64 fileModifiedTime(const QString &path)
+{
+    const QFileInfo info(path);
+    return info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1;
+}
+
 MimeAppsWorker::MimeAppsWorker(QObject *parent)
     : QObject(parent)
 {
@@ -63,13 +83,21 @@ void MimeAppsWorker::initConnect()
 
 void MimeAppsWorker::startWatch()
 {
-    const QStringList &paths { MimesAppsManager::getApplicationsFolders() };
+    QStringList paths { MimesAppsManager::getApplicationsFolders() };
+    // dde-mimetype.list is only read again on a refresh
+    const QString &ddeMimeTypeDir = QFileInfo(MimesAppsManager::getDDEMimeTypeFile()).absolutePath();
+    if (QFileInfo::exists(ddeMimeTypeDir) && !paths.contains(ddeMimeTypeDir))
+        paths.append(ddeMimeTypeDir);
     std::for_each(paths.begin(), paths.end(), [this](const QString &path) {
         AbstractFileWatcherPointer watcher { WatcherFactory::create<AbstractFileWatcher>(QUrl::fromLocalFile(path)) };
         watcherGroup.append(watcher);
         if (watcher) {
-            connect(watcher.data(), &AbstractFileWatcher::fileAttributeChanged, this, [this]() {
-                updateCacheTimer->start();
+            connect(watcher.data(), &AbstractFileWatcher::fileAttributeChanged, this, &MimeAppsWorker::onFileChanged);
+            connect(watcher.data(), &AbstractFileWatcher::subfileCreated, this, &MimeAppsWorker::onFileChanged);
+            connect(watcher.data(), &AbstractFileWatcher::fileDeleted, this, &MimeAppsWorker::onFileChanged);
+            connect(watcher.data(), &AbstractFileWatcher::fileRename, this, [this](const QUrl &oldUrl, const QUrl &newUrl) {
+                onFileChanged(oldUrl);
+                onFileChanged(newUrl);
             });
             watcher->startWatcher();
         }
@@ -78,7 +106,27 @@ void MimeAppsWorker::startWatch()
 
 void MimeAppsWorker::updateCache()
 {
-    MimesAppsManager::initMimeTypeApps();
+    const QStringList files(changedDesktopFiles.cbegin(), changedDesktopFiles.cend());
+    changedDesktopFiles.clear();
+
+    // directories created or removed, walk the folders again
+    if (needFullRefresh || files.isEmpty()) {
+        needFullRefresh = false;
+        MimesAppsManager::refreshMimeTypeApps();
+        return;
+    }
+
+    MimesAppsManager::updateMimeTypeApps(files);
+}
+
+void MimeAppsWorker::onFileChanged(const QUrl &url)
+{
+    const QString &path = url.toLocalFile();
+    if (path.endsWith(".desktop"))
+        changedDesktopFiles.insert(path);
+    else
+        needFullRefresh = true;
+    updateCacheTimer->start();
 }
 
 void MimeAppsWorker::writeData(const QString &path, const QByteArray &content)
@@ -271,10 +319,14 @@ QStringList MimesAppsManager::getRecommendedApps(const QUrl &url)
     QStringList recommendedApps;
     QString mimeType;
 
-    FileInfoPointer info = InfoFactory::create<FileInfo>(url);
-    mimeType = info->fileMimeType().name();
-
     DFMBASE_NAMESPACE::DMimeDatabase db;
+    if (url.isLocalFile()) {
+        mimeType = db.mimeTypeForFile(url.toLocalFile(), QMimeDatabase::MatchDefault, QString()).name();
+    } else {
+        FileInfoPointer info = InfoFactory::create<FileInfo>(url);
+        if (info)
+            mimeType = info->fileMimeType().name();
+    }
 
     recommendedApps = getRecommendedAppsByQio(db.mimeTypeForName(mimeType));
 
@@ -306,6 +358,11 @@ QStringList MimesAppsManager::getRecommendedApps(const QUrl &url)
 
 QStringList MimesAppsManager::getRecommendedAppsByQio(const QMimeType &mimeType)
 {
+    QMutexLocker locker(&mimeAppsMutex);
+    auto cached = recommendedAppsCache.constFind(mimeType.name());
+    if (cached != recommendedAppsCache.cend())
+        return cached.value();
+
     QStringList recommendApps;
     QList<QMimeType> mimeTypeList;
     DFMBASE_NAMESPACE::DMimeDatabase mimeDatabase;
@@ -361,6 +418,7 @@ QStringList MimesAppsManager::getRecommendedAppsByQio(const QMimeType &mimeType)
             break;
     }
 
+    recommendedAppsCache.insert(mimeType.name(), recommendApps);
     return recommendApps;
 }
 
@@ -453,6 +511,12 @@ QString MimesAppsManager::getDDEMimeTypeFile()
     return QString("%1/%2/%3").arg(getMimeInfoCacheFileRootPath(), "deepin", "dde-mimetype.list");
 }
 
+QString MimesAppsManager::getMimeAppsIndexFile()
+{
+    const QString &cacheDir = StandardPaths::location(StandardPaths::kCachePath);
+    return cacheDir.isEmpty() ? QString() : cacheDir + "/mimeapps.index";
+}
+
 QMap<QString, DesktopFile> MimesAppsManager::getDesktopObjs()
 {
     QMap<QString, DesktopFile> desktopObjs;
@@ -464,89 +528,123 @@ QMap<QString, DesktopFile> MimesAppsManager::getDesktopObjs()
 
 void MimesAppsManager::initMimeTypeApps()
 {
-    qCInfo(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Initializing MIME type applications in thread:"
-                       << QThread::currentThread();
-    DesktopFiles.clear();
-    DesktopObjs.clear();
-    DDE_MimeTypes.clear();
-
-    QMap<QString, QSet<QString>> mimeAppsSet;
-    loadDDEMimeTypes();
-
-    const QStringList &appFolders = getApplicationsFolders();
-    qCDebug(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Scanning application folders:" << appFolders;
-
-    int totalDesktopFiles = 0;
-    for (const QString &desktopFolder : appFolders) {
-        QDirIterator it(desktopFolder, QStringList("*.desktop"), QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
-        int folderCount = 0;
-        while (it.hasNext()) {
-            it.next();
-            const QString &filePath = it.filePath();
-            DesktopFile desktopFile(filePath);
-            if (desktopFile.isNoShow())
-                continue;
+    QMutexLocker locker(&mimeAppsMutex);
+    // called on every open with menu, later changes come from the watchers
+    if (mimeAppsLoaded)
+        return;
+    refreshMimeApps();
+}
 
-            DesktopFiles.append(filePath);
-            DesktopObjs.insert(filePath, desktopFile);
-            QStringList mimeTypes = desktopFile.desktopMimeType();
-            QString fileName = QFileInfo(filePath).fileName();
-            if (DDE_MimeTypes.contains(fileName)) {
-                mimeTypes.append(DDE_MimeTypes.value(fileName));
-            }
+void MimesAppsManager::refreshMimeTypeApps()
+{
+    QMutexLocker locker(&mimeAppsMutex);
+    refreshMimeApps();
+}
 
-            for (const QString &mimeType : mimeTypes) {
-                if (!mimeType.isEmpty()) {
-                    QSet<QString> apps;
-                    if (mimeAppsSet.contains(mimeType)) {
-                        apps = mimeAppsSet.value(mimeType);
-                        apps.insert(filePath);
-                    } else {
-                        apps.insert(filePath);
-                    }
-                    mimeAppsSet.insert(mimeType, apps);
-                }
-            }
-            folderCount++;
-            totalDesktopFiles++;
-        }
-        qCDebug(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Found" << folderCount
-                            << "desktop files in:" << desktopFolder;
+void MimesAppsManager::refreshMimeApps()
+{
+    MimeAppsIndex *index = mimeAppsIndex();
+
+    bool rebuild = false;
+    if (!mimeAppsLoaded) {
+        mimeAppsLoaded = true;
+        rebuild = true;
+        if (index->load())
+            qCInfo(logDFMBase) << "MimesAppsManager::refreshMimeApps: Loaded" << index->entries().size()
+                               << "desktop entries from index";
     }
 
-    qCInfo(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Loaded" << totalDesktopFiles
-                       << "desktop files, processing" << mimeAppsSet.size() << "MIME types";
+    const qint64 ddeModified = fileModifiedTime(getDDEMimeTypeFile());
+    if (ddeModified != ddeMimeTypesModified) {
+        ddeMimeTypesModified = ddeModified;
+        DDE_MimeTypes.clear();
+        loadDDEMimeTypes();
+        rebuild = true;
+    }
 
-    for (const QString &key : mimeAppsSet.keys()) {
-        QSet<QString> apps = mimeAppsSet.value(key);
-        QStringList orderApps;
-        if (apps.count() > 1) {
-            QFileInfoList fileInfos;
-            for (const QString &app : apps) {
-                QFileInfo info(app);
-                fileInfos.append(info);
-            }
+    const int changed = index->refresh(getApplicationsFolders());
+    if (changed > 0) {
+        qCInfo(logDFMBase) << "MimesAppsManager::refreshMimeApps:" << changed << "desktop files changed in thread:"
+                           << QThread::currentThread();
+        rebuild = true;
+    }
 
-            std::sort(fileInfos.begin(), fileInfos.end(), MimesAppsManager::lessByDateTime);
+    if (rebuild)
+        rebuildMimeApps();
+    if (index->isDirty())
+        index->save();
 
-            for (const QFileInfo &info : fileInfos) {
-                orderApps.append(info.absoluteFilePath());
-            }
-        } else {
-            orderApps.append(apps.values());
-        }
-        MimeApps.insert(key, orderApps);
+    const qint64 cacheModified = fileModifiedTime(getMimeInfoCacheFilePath());
+    if (cacheModified != mimeInfoCacheModified || changed > 0) {
+        mimeInfoCacheModified = cacheModified;
+        loadCategoryApps();
+    }
+}
+
+void MimesAppsManager::updateMimeTypeApps(const QStringList &desktopFiles)
+{
+    QMutexLocker locker(&mimeAppsMutex);
+    if (!mimeAppsLoaded) {
+        refreshMimeApps();
+        return;
+    }
+
+    MimeAppsIndex *index = mimeAppsIndex();
+    int changed = 0;
+    for (const QString &file : desktopFiles) {
+        if (index->update(file))
+            ++changed;
+    }
+
+    qCDebug(logDFMBase) << "MimesAppsManager::updateMimeTypeApps:" << changed << "of" << desktopFiles.size()
+                        << "desktop files changed";
+    if (changed == 0)
+        return;
+
+    rebuildMimeApps();
+    index->save();
+    loadCategoryApps();
+}
+
+void MimesAppsManager::rebuildMimeApps()
+{
+    const QHash<QString, MimeAppsIndex::Entry> &entries = mimeAppsIndex()->entries();
+
+    QStringList desktopFiles;
+    QMap<QString, DesktopFile> desktopObjs;
+    for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+        if (it->desktop.isNoShow())
+            continue;
+        desktopFiles.append(it.key());
+        desktopObjs.insert(it.key(), it->desktop);
     }
+    desktopFiles.sort();
+
+    DesktopFiles = desktopFiles;
+    DesktopObjs = desktopObjs;
+    MimeApps = mimeAppsIndex()->mimeApps(DDE_MimeTypes);
+    recommendedAppsCache.clear();
+
+    qCInfo(logDFMBase) << "MimesAppsManager::rebuildMimeApps: Indexed" << DesktopFiles.size()
+                       << "desktop files for" << MimeApps.size() << "MIME types";
+}
+
+void MimesAppsManager::loadCategoryApps()
+{
+    VideoMimeApps.clear();
+    ImageMimeApps.clear();
+    TextMimeApps.clear();
+    AudioMimeApps.clear();
 
     // check mime apps from cache
     QFile f(getMimeInfoCacheFilePath());
     if (!f.open(QIODevice::ReadOnly)) {
-        qCWarning(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Failed to read MIME info cache file:"
+        qCWarning(logDFMBase) << "MimesAppsManager::loadCategoryApps: Failed to read MIME info cache file:"
                               << getMimeInfoCacheFilePath() << "Error:" << f.errorString();
         return;
     }
 
-    qCDebug(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Processing MIME info cache file";
+    qCDebug(logDFMBase) << "MimesAppsManager::loadCategoryApps: Processing MIME info cache file";
 
     QStringList audioDesktopList;
     QStringList imageDeksopList;
@@ -581,19 +679,24 @@ void MimesAppsManager::initMimeTypeApps()
     f.close();
 
     const QString &mimeInfoCacheRootPath = getMimeInfoCacheFileRootPath();
+    const QHash<QString, MimeAppsIndex::Entry> &entries = mimeAppsIndex()->entries();
 
-    // Process categorized applications
+    // Process categorized applications, the index has parsed most of them already
     auto processCategory = [&](const QStringList &desktopList, QMap<QString, DesktopFile> &targetMap, const QString &category) {
         int validCount = 0;
         for (const QString &desktop : desktopList) {
             const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
-            if (!QFile::exists(path))
-                continue;
-            DesktopFile df(path);
-            targetMap.insert(path, df);
+            auto entry = entries.constFind(path);
+            if (entry != entries.cend()) {
+                targetMap.insert(path, entry->desktop);
+            } else {
+                if (!QFile::exists(path))
+                    continue;
+                targetMap.insert(path, DesktopFile(path));
+            }
             validCount++;
         }
-        qCDebug(logDFMBase) << "MimesAppsManager::initMimeTypeApps: Processed" << validCount
+        qCDebug(logDFMBase) << "MimesAppsManager::loadCategoryApps: Processed" << validCount
                             << category << "applications";
     };
 
@@ -601,9 +704,6 @@ void MimesAppsManager::initMimeTypeApps()
     processCategory(imageDeksopList, ImageMimeApps, "image");
     processCategory(textDekstopList, TextMimeApps, "text");
     processCategory(videoDesktopList, VideoMimeApps, "video");
-
-    qCInfo(logDFMBase) << "MimesAppsManager::initMimeTypeApps: MIME type applications initialization completed";
-    return;
 }
 
 void MimesAppsManager::loadDDEMimeTypes()
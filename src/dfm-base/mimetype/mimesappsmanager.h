@@ -41,8 +41,13 @@ public Q_SLOTS:
     QByteArray readData(const QString &path);
 
 private:
+    void onFileChanged(const QUrl &url);
+
     QTimer *updateCacheTimer = nullptr;
     QList<AbstractFileWatcherPointer> watcherGroup;
+    // desktop files reported by the watchers since the last update
+    QSet<QString> changedDesktopFiles;
+    bool needFullRefresh = false;
 };
 
 class MimesAppsManager : public QObject
@@ -84,7 +89,12 @@ public:
     static QString getMimeInfoCacheFileRootPath();
     static QString getDDEMimeTypeFile();
     static QMap<QString, DesktopFile> getDesktopObjs();
+    static QString getMimeAppsIndexFile();
+    // loads the index once, later changes are applied by the watchers of MimeAppsWorker
     static void initMimeTypeApps();
+    // walks the folders and parses only the desktop files modified since the last walk
+    static void refreshMimeTypeApps();
+    static void updateMimeTypeApps(const QStringList &desktopFiles);
     static void loadDDEMimeTypes();
     static bool lessByDateTime(const QFileInfo &f1, const QFileInfo &f2);
     static bool removeOneDupFromList(QStringList &list, const QString desktopFilePath);
@@ -94,6 +104,9 @@ Q_SIGNALS:
 
 private:
     explicit MimesAppsManager(QObject *parent = nullptr);
+    static void refreshMimeApps();
+    static void rebuildMimeApps();
+    static void loadCategoryApps();
     MimeAppsWorker *mimeAppsWorker = nullptr;
     QThread mimeAppsThread;
 };
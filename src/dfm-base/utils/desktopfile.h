@@ -8,6 +8,7 @@
 #include <dfm-base/dfm_base_global.h>
 
 #include <QStringList>
+#include <QDataStream>
 
 /**
  * @class DesktopFile
@@ -36,6 +37,10 @@ public:
     QStringList desktopCategories() const;
     QStringList desktopMimeType() const;
 
+    // used to persist parsed entries, see MimeAppsIndex
+    friend QDataStream &operator<<(QDataStream &out, const DesktopFile &file);
+    friend QDataStream &operator>>(QDataStream &in, DesktopFile &file);
+
 private:
     QString fileName;
     QString name;
@@ -52,6 +57,9 @@ private:
     bool hidden = false;
 };
 
+QDataStream &operator<<(QDataStream &out, const DesktopFile &file);
+QDataStream &operator>>(QDataStream &in, DesktopFile &file);
+
 }
 
 #endif   // DESKTOPFILE_H
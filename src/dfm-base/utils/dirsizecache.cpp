@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dirsizecache.h"
+
+#include <dfm-base/file/local/private/inotifymultiplexer.h>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QThread>
+
+#include <sys/inotify.h>
+
+using namespace dfmbase;
+
+// 与文件监视器共用 inotify 实例，给它们留出余量
+static constexpr int kMaxWatchedDirs { 8192 };
+// 监视数达到上限时，释放这段时间内未使用的条目
+static constexpr qint64 kIdleTime { 10 * 60 };   // s
+static constexpr int kMaxDepth { 1024 };
+
+DirSizeCache *DirSizeCache::instance()
+{
+    static DirSizeCache *ins = new DirSizeCache;
+    return ins;
+}
+
+DirSizeCache::DirSizeCache()
+    : context(new QObject)
+{
+    // 扫描线程没有事件循环，通知交给主线程处理
+    if (qApp && context->thread() != qApp->thread())
+        context->moveToThread(qApp->thread());
+}
+
+DirSizeCache::~DirSizeCache()
+{
+    clear();
+    if (context->thread() == QThread::currentThread())
+        delete context;
+    else
+        context->deleteLater();
+}
+
+bool DirSizeCache::watch(quint64 device, quint64 inode, const QByteArray &path)
+{
+    const Key key { device, inode };
+    QWriteLocker lk(&lock);
+    auto it = nodes.find(key);
+    if (it != nodes.end()) {
+        // 重新读取，已排队的旧通知最多让这次的条目不被写入
+        if (it->filled) {
+            it->filled = false;
+            it->entry = {};
+            invalidateAncestors(key);
+        }
+        it->changed = false;
+        it->subtreeValid = false;
+        return true;
+    }
+
+    if (nodes.size() >= kMaxWatchedDirs && !evictIdle())
+        return false;
+
+    const int token = InotifyMultiplexer::instance()->subscribe(
+            QFile::decodeName(path), context, [this, key](const QList<InotifyEvent> &events) {
+                onChanged(key, events);
+            });
+    if (token < 0)
+        return false;
+
+    Node &node = nodes[key];
+    node.watchToken = token;
+    node.usedTime = QDateTime::currentSecsSinceEpoch();
+    return true;
+}
+
+void DirSizeCache::insert(quint64 device, quint64 inode, const Entry &entry)
+{
+    const Key key { device, inode };
+    QWriteLocker lk(&lock);
+    auto it = nodes.find(key);
+    if (it == nodes.end())
+        return;
+    if (it->changed) {
+        removeNode(key);
+        return;
+    }
+
+    it->entry = entry;
+    it->filled = true;
+    it->usedTime = QDateTime::currentSecsSinceEpoch();
+    for (const SubDir &subDir : entry.subDirs)
+        parents.insert({ subDir.device, subDir.inode }, key);
+}
+
+void DirSizeCache::release(quint64 device, quint64 inode)
+{
+    const Key key { device, inode };
+    QWriteLocker lk(&lock);
+    auto it = nodes.find(key);
+    if (it != nodes.end() && !it->filled)
+        removeNode(key);
+}
+
+bool DirSizeCache::find(quint64 device, quint64 inode, qint64 modifiedTime, Entry *entry)
+{
+    QWriteLocker lk(&lock);
+    auto it = nodes.find({ device, inode });
+    // 通知在主线程排队处理，mtime 仍用来发现尚未处理的变化
+    if (it == nodes.end() || !it->filled || it->entry.modifiedTime != modifiedTime)
+        return false;
+
+    it->usedTime = QDateTime::currentSecsSinceEpoch();
+    *entry = it->entry;
+    return true;
+}
+
+bool DirSizeCache::findSubtree(quint64 device, quint64 inode, qint64 modifiedTime, Totals *totals)
+{
+    const Key key { device, inode };
+    QWriteLocker lk(&lock);
+    auto it = nodes.constFind(key);
+    if (it == nodes.cend() || !it->filled || it->entry.modifiedTime != modifiedTime)
+        return false;
+
+    return sumSubtree(key, 0, totals);
+}
+
+void DirSizeCache::clear()
+{
+    QWriteLocker lk(&lock);
+    for (const Node &node : std::as_const(nodes))
+        InotifyMultiplexer::instance()->unsubscribe(node.watchToken);
+    nodes.clear();
+    parents.clear();
+}
+
+int DirSizeCache::count() const
+{
+    QReadLocker lk(&lock);
+    int filled = 0;
+    for (const Node &node : nodes)
+        filled += node.filled ? 1 : 0;
+    return filled;
+}
+
+void DirSizeCache::onChanged(const Key &key, const QList<InotifyEvent> &events)
+{
+    QWriteLocker lk(&lock);
+    for (const InotifyEvent &event : events) {
+        // 队列溢出时丢失了通知，所有条目都不再可信
+        if (event.mask & IN_Q_OVERFLOW) {
+            lk.unlock();
+            clear();
+            return;
+        }
+    }
+
+    auto it = nodes.find(key);
+    if (it == nodes.end())
+        return;
+    if (!it->filled) {
+        it->changed = true;
+        return;
+    }
+    removeNode(key);
+}
+
+void DirSizeCache::removeNode(const Key &key)
+{
+    auto it = nodes.find(key);
+    if (it == nodes.end())
+        return;
+
+    invalidateAncestors(key);
+    InotifyMultiplexer::instance()->unsubscribe(it->watchToken);
+    for (const SubDir &subDir : std::as_const(it->entry.subDirs)) {
+        const Key child { subDir.device, subDir.inode };
+        if (parents.value(child) == key)
+            parents.remove(child);
+    }
+    nodes.erase(it);
+}
+
+void DirSizeCache::invalidateAncestors(const Key &key)
+{
+    auto it = nodes.find(key);
+    if (it != nodes.end())
+        it->subtreeValid = false;
+
+    // bind mount 可能让路径成环，限制层数
+    Key current = key;
+    for (int depth = 0; depth < kMaxDepth; ++depth) {
+        auto parent = parents.constFind(current);
+        if (parent == parents.cend())
+            break;
+        current = parent.value();
+        auto node = nodes.find(current);
+        if (node != nodes.end())
+            node->subtreeValid = false;
+    }
+}
+
+bool DirSizeCache::sumSubtree(const Key &key, int depth, Totals *totals)
+{
+    auto it = nodes.find(key);
+    if (it == nodes.end() || !it->filled || depth > kMaxDepth)
+        return false;
+
+    it->usedTime = QDateTime::currentSecsSinceEpoch();
+    if (it->subtreeValid) {
+        *totals = it->subtree;
+        return true;
+    }
+
+    // 多链接的文件要在整次统计中去重，不能预先求和
+    if (!it->entry.linkedFiles.isEmpty())
+        return false;
+
+    Totals sum;
+    sum.fileCount = it->entry.fileCount;
+    sum.fileSize = it->entry.fileSize;
+    sum.progressSize = it->entry.progressSize;
+    const QList<SubDir> subDirs = it->entry.subDirs;
+    for (const SubDir &subDir : subDirs) {
+        Totals child;
+        if (!sumSubtree({ subDir.device, subDir.inode }, depth + 1, &child))
+            return false;
+        sum.fileCount += child.fileCount;
+        sum.directoryCount += child.directoryCount + 1;
+        sum.fileSize += child.fileSize;
+        sum.progressSize += child.progressSize;
+    }
+
+    // 递归只修改已有节点，迭代器仍然有效
+    it->subtree = sum;
+    it->subtreeValid = true;
+    *totals = sum;
+    return true;
+}
+
+bool DirSizeCache::evictIdle()
+{
+    const qint64 idleBefore = QDateTime::currentSecsSinceEpoch() - kIdleTime;
+    QList<Key> idle;
+    for (auto it = nodes.cbegin(); it != nodes.cend(); ++it) {
+        if (it->filled && it->usedTime < idleBefore)
+            idle.append(it.key());
+    }
+    for (const Key &key : std::as_const(idle))
+        removeNode(key);
+    return nodes.size() < kMaxWatchedDirs;
+}
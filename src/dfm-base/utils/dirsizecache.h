@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef DIRSIZECACHE_H
+#define DIRSIZECACHE_H
+
+#include <dfm-base/dfm_base_global.h>
+
+#include <QByteArrayList>
+#include <QHash>
+#include <QList>
+#include <QReadWriteLock>
+
+class QObject;
+
+namespace dfmbase {
+
+struct InotifyEvent;
+
+/*!
+ * \brief 目录大小缓存
+ *
+ * 按 (设备, inode) 记录每个目录直接子项的统计和子目录。目录在读取前加入
+ * inotify 监视，目录中的任何变化（包括文件内容修改）都会丢弃它的条目，
+ * 并让所有上级目录的子树汇总失效，因此缓存的统计与磁盘一致，不需要有效期。
+ *
+ * 子树中每个目录都有条目时，汇总由条目求和并记在子树根上，再次统计时
+ * 只需 stat 根目录。某个目录变化后只有它和它的上级需要重新统计。
+ *
+ * 条目只在被监视期间有效，不写入磁盘。监视数有上限，超出时先释放最久未用的
+ * 条目，仍然不够的目录照常读取，不进入缓存。
+ *
+ * 线程安全。监视的通知在创建缓存的应用的主线程中处理。
+ */
+class DirSizeCache
+{
+    Q_DISABLE_COPY(DirSizeCache)
+
+public:
+    // 多链接的文件不计入目录统计，复用条目时仍按 (设备, inode) 去重
+    struct LinkedFile
+    {
+        quint64 inode { 0 };
+        qint64 size { 0 };
+    };
+
+    struct SubDir
+    {
+        QByteArray name;
+        quint64 device { 0 };
+        quint64 inode { 0 };
+    };
+
+    struct Entry
+    {
+        qint64 modifiedTime { 0 };   // ns
+        qint64 fileCount { 0 };   // 直接子项中非目录的数量，不含 linkedFiles
+        qint64 fileSize { 0 };
+        qint64 progressSize { 0 };
+        QList<SubDir> subDirs;
+        QList<LinkedFile> linkedFiles;
+    };
+
+    // 子树的汇总，不含根目录本身
+    struct Totals
+    {
+        qint64 fileCount { 0 };
+        qint64 directoryCount { 0 };
+        qint64 fileSize { 0 };
+        qint64 progressSize { 0 };   // 不含目录，目录的进度由调用者按 directoryCount 计算
+    };
+
+    static DirSizeCache *instance();
+
+    DirSizeCache();
+    ~DirSizeCache();
+
+    // 读取目录前调用，开始监视目录；返回 false 时目录不能缓存
+    bool watch(quint64 device, quint64 inode, const QByteArray &path);
+    // 读取完整后写入条目，读取期间目录有变化时丢弃
+    void insert(quint64 device, quint64 inode, const Entry &entry);
+    // 读取未完成时释放 watch 的监视
+    void release(quint64 device, quint64 inode);
+
+    // 条目存在且 mtime 一致时返回 true
+    bool find(quint64 device, quint64 inode, qint64 modifiedTime, Entry *entry);
+    // 子树中每个目录都有条目、且不含多链接的文件时返回 true
+    bool findSubtree(quint64 device, quint64 inode, qint64 modifiedTime, Totals *totals);
+
+    void clear();
+    int count() const;
+
+private:
+    struct Key
+    {
+        quint64 device;
+        quint64 inode;
+        bool operator==(const Key &other) const { return device == other.device && inode == other.inode; }
+        friend size_t qHash(const Key &key, size_t seed) { return qHashMulti(seed, key.device, key.inode); }
+    };
+
+    struct Node
+    {
+        int watchToken { -1 };
+        bool filled { false };   // 条目已写入
+        bool changed { false };   // 读取期间收到变化通知
+        qint64 usedTime { 0 };   // s
+        Entry entry;
+        bool subtreeValid { false };
+        Totals subtree;
+    };
+
+    void onChanged(const Key &key, const QList<InotifyEvent> &events);
+    void removeNode(const Key &key);
+    void invalidateAncestors(const Key &key);
+    bool sumSubtree(const Key &key, int depth, Totals *totals);
+    bool evictIdle();
+
+    QObject *context { nullptr };
+    mutable QReadWriteLock lock;
+    QHash<Key, Node> nodes;
+    QHash<Key, Key> parents;   // 子目录 -> 已缓存的上级目录
+};
+
+}
+
+#endif   // DIRSIZECACHE_H
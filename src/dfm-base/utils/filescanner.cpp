@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "filescanner.h"
+#include "dirsizecache.h"
 
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/interfaces/fileinfo.h>
@@ -16,15 +17,43 @@
 #include <QDir>
 #include <QQueue>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
 #include <dirent.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/vfs.h>
 
 DFMBASE_USE_NAMESPACE
 
 namespace dfmbase {
 
+static constexpr int kMaxParallelScanThreads = 8;
+static constexpr int kParallelProgressInterval = 100;   // ms
+
+// 目录 mtime 不可靠或内容随时变化的文件系统，不使用目录大小缓存
+static const QSet<quint32> kUncachedFileSystems {
+    0x9fa0,   // proc
+    0x62656572,   // sysfs
+    0x6969,   // nfs
+    0x517b,   // smb
+    0xff534d42,   // cifs
+    0xfe534d42,   // smb2
+    0x65735546,   // fuse
+};
+
+static qint64 modifiedTimeOf(const struct stat &statBuf)
+{
+    return static_cast<qint64>(statBuf.st_mtim.tv_sec) * 1000 * 1000 * 1000 + statBuf.st_mtim.tv_nsec;
+}
+
 //===================================================================
 // FileScannerCore - 核心扫描逻辑（纯算法，无 QObject 依赖）
 //===================================================================
@@ -79,9 +108,12 @@ private:
 
     // 核心扫描逻辑
     static void scanLocalPathsImpl(ScanState &state, const QList<QUrl> &urls);
+    static void scanLocalPathsParallel(ScanState &state, const QList<QUrl> &urls);
+    static QStringList prepareSourcePaths(ScanState &state, const QList<QUrl> &urls);
     static void scanOtherProtocolsImpl(ScanState &state, const QList<QUrl> &urls);
 
     // 辅助方法
+    static bool useSizeCache(FileScanner::ScanOptions options);
     static qint64 progressDeltaForFileSize(const ScanState &state, qint64 fileSize);
     static bool tryScanOtherProtocolCountOnlyByLocalPath(
             ScanState &state,
@@ -99,6 +131,437 @@ private:
     static void markInodeProcessed(ScanState &state, quint64 device, quint64 inode);
 };
 
+//===================================================================
+// ParallelScanJob - 本地目录并行扫描
+//
+// 每个线程持有一个目录队列，自己从队尾取（深度优先），空闲时从其他线程
+// 的队首窃取。目录以字节路径入队，条目直接在目录 fd 上 fstatat，
+// 不构造 QUrl；硬链接按 (dev, inode) 在分片集合中去重。
+// 设置了 cache 时，有子树汇总的目录不再向下统计，有条目的目录不读取。
+//===================================================================
+class ParallelScanJob
+{
+public:
+    ParallelScanJob(FileScanner::ScanOptions options, qint64 memoryPageSize, int threadCount,
+                    DirSizeCache *cache = nullptr);
+    ~ParallelScanJob();
+
+    void addDirectory(const QByteArray &path, bool isSourcePath);
+    void start();
+    void stop();
+    // 等待扫描结束，超时返回 false
+    bool waitFor(int msecs);
+
+    // 扫描过程中的计数快照（不含 allFiles）
+    FileScanner::ScanResult snapshot() const;
+    // 扫描结束后合并各线程的结果
+    FileScanner::ScanResult takeResult();
+    int processedSourceDirs() const { return sourceDirs.load(std::memory_order_relaxed); }
+
+private:
+    struct DirTask
+    {
+        QByteArray path;
+        bool isSourcePath { false };
+        // 父目录所在设备和是否可缓存，同一设备上不重复检查文件系统
+        quint64 parentDevice { 0 };
+        bool cacheable { false };
+    };
+
+    struct alignas(64) Worker
+    {
+        std::mutex queueLock;
+        std::deque<DirTask> queue;
+
+        // 只由所属线程写入，其他线程读取快照
+        std::atomic<qint64> fileCount { 0 };
+        std::atomic<qint64> directoryCount { 0 };
+        std::atomic<qint64> totalSize { 0 };
+        std::atomic<qint64> progressSize { 0 };
+        QList<QUrl> allFiles;
+    };
+
+    struct InodeKey
+    {
+        quint64 device;
+        quint64 inode;
+        bool operator==(const InodeKey &other) const { return device == other.device && inode == other.inode; }
+    };
+
+    struct InodeKeyHash
+    {
+        size_t operator()(const InodeKey &key) const { return std::hash<quint64>()(key.inode ^ (key.device << 32)); }
+    };
+
+    struct InodeShard
+    {
+        std::mutex lock;
+        std::unordered_set<InodeKey, InodeKeyHash> inodes;
+    };
+
+    static constexpr int kInodeShardCount = 64;
+
+    void run(int index);
+    void push(Worker &worker, DirTask task);
+    bool take(int index, DirTask *task);
+    void scanDirectory(Worker &worker, const DirTask &task);
+    bool scanCachedDirectory(Worker &worker, const DirTask &task, const struct stat &dirStat);
+    void addRegularFile(Worker &worker, const struct stat &statBuf);
+    void addLinkedFile(Worker &worker, quint64 device, quint64 inode, qint64 size);
+    void collect(Worker &worker, const QByteArray &path);
+    bool markInode(quint64 device, quint64 inode);
+    void finishTask();
+
+    FileScanner::ScanOptions options;
+    qint64 memoryPageSize { 4096 };
+    int nextWorker { 0 };
+    DirSizeCache *cache { nullptr };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::unique_ptr<InodeShard[]> inodeShards;
+
+    // 已入队但未处理完的目录数，归零即扫描结束
+    std::atomic<qint64> pendingTasks { 0 };
+    std::atomic<bool> stopped { false };
+    std::atomic<int> sourceDirs { 0 };
+
+    std::mutex idleLock;
+    std::condition_variable idleCond;
+    std::mutex doneLock;
+    std::condition_variable doneCond;
+    int runningThreads { 0 };
+};
+
+ParallelScanJob::ParallelScanJob(FileScanner::ScanOptions options, qint64 memoryPageSize, int threadCount,
+                                 DirSizeCache *cache)
+    : options(options),
+      memoryPageSize(memoryPageSize),
+      cache(cache),
+      inodeShards(new InodeShard[kInodeShardCount])
+{
+    for (int i = 0; i < threadCount; ++i)
+        workers.emplace_back(new Worker);
+}
+
+ParallelScanJob::~ParallelScanJob()
+{
+    stop();
+    for (std::thread &thread : threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+void ParallelScanJob::addDirectory(const QByteArray &path, bool isSourcePath)
+{
+    // 源目录轮流分给各线程
+    Worker &worker = *workers[static_cast<size_t>(nextWorker++ % static_cast<int>(workers.size()))];
+    push(worker, { path, isSourcePath, 0, false });
+}
+
+void ParallelScanJob::start()
+{
+    runningThreads = static_cast<int>(workers.size());
+    for (size_t i = 0; i < workers.size(); ++i)
+        threads.emplace_back(&ParallelScanJob::run, this, static_cast<int>(i));
+}
+
+void ParallelScanJob::stop()
+{
+    stopped.store(true, std::memory_order_relaxed);
+    idleCond.notify_all();
+}
+
+bool ParallelScanJob::waitFor(int msecs)
+{
+    std::unique_lock<std::mutex> lk(doneLock);
+    return doneCond.wait_for(lk, std::chrono::milliseconds(msecs), [this] { return runningThreads == 0; });
+}
+
+FileScanner::ScanResult ParallelScanJob::snapshot() const
+{
+    FileScanner::ScanResult result;
+    for (const auto &worker : workers) {
+        result.fileCount += static_cast<int>(worker->fileCount.load(std::memory_order_relaxed));
+        result.directoryCount += static_cast<int>(worker->directoryCount.load(std::memory_order_relaxed));
+        result.totalSize += worker->totalSize.load(std::memory_order_relaxed);
+        result.progressSize += worker->progressSize.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+FileScanner::ScanResult ParallelScanJob::takeResult()
+{
+    FileScanner::ScanResult result = snapshot();
+    if (options & FileScanner::ScanOption::CollectFiles) {
+        for (const auto &worker : workers)
+            result.allFiles.append(std::move(worker->allFiles));
+    }
+    return result;
+}
+
+void ParallelScanJob::push(Worker &worker, DirTask task)
+{
+    pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lk(worker.queueLock);
+        worker.queue.push_back(std::move(task));
+    }
+    idleCond.notify_one();
+}
+
+bool ParallelScanJob::take(int index, DirTask *task)
+{
+    Worker &self = *workers[static_cast<size_t>(index)];
+    {
+        std::lock_guard<std::mutex> lk(self.queueLock);
+        if (!self.queue.empty()) {
+            *task = std::move(self.queue.back());
+            self.queue.pop_back();
+            return true;
+        }
+    }
+
+    // 窃取其他线程最早入队的目录，通常是较浅、子树较大的目录
+    const int count = static_cast<int>(workers.size());
+    for (int i = 1; i < count; ++i) {
+        Worker &victim = *workers[static_cast<size_t>((index + i) % count)];
+        std::lock_guard<std::mutex> lk(victim.queueLock);
+        if (!victim.queue.empty()) {
+            *task = std::move(victim.queue.front());
+            victim.queue.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ParallelScanJob::finishTask()
+{
+    if (pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        idleCond.notify_all();
+}
+
+void ParallelScanJob::run(int index)
+{
+    Worker &self = *workers[static_cast<size_t>(index)];
+    DirTask task;
+    while (!stopped.load(std::memory_order_relaxed)) {
+        if (take(index, &task)) {
+            scanDirectory(self, task);
+            finishTask();
+            continue;
+        }
+
+        if (pendingTasks.load(std::memory_order_acquire) == 0)
+            break;
+
+        // 其他线程仍在处理目录，可能产生新的任务；超时避免漏掉唤醒
+        std::unique_lock<std::mutex> lk(idleLock);
+        idleCond.wait_for(lk, std::chrono::milliseconds(2));
+    }
+
+    std::lock_guard<std::mutex> lk(doneLock);
+    if (--runningThreads == 0)
+        doneCond.notify_all();
+}
+
+void ParallelScanJob::scanDirectory(Worker &worker, const DirTask &task)
+{
+    // 先计数目录本身（无论是否能读取内容），与单线程扫描一致
+    worker.directoryCount.fetch_add(1, std::memory_order_relaxed);
+    worker.progressSize.fetch_add(memoryPageSize, std::memory_order_relaxed);
+    if (task.isSourcePath)
+        sourceDirs.fetch_add(1, std::memory_order_relaxed);
+
+    struct stat dirStat;
+    quint64 device = 0;
+    bool cacheable = false;
+    if (cache && stat(task.path.constData(), &dirStat) == 0) {
+        device = static_cast<quint64>(dirStat.st_dev);
+        if (device == task.parentDevice) {
+            cacheable = task.cacheable;
+        } else {
+            struct statfs fsBuf;
+            cacheable = statfs(task.path.constData(), &fsBuf) == 0
+                    && !kUncachedFileSystems.contains(static_cast<quint32>(fsBuf.f_type));
+        }
+        if (cacheable && scanCachedDirectory(worker, task, dirStat))
+            return;
+        // 读取前开始监视，读取期间的变化不会漏掉
+        if (cacheable)
+            cacheable = cache->watch(device, static_cast<quint64>(dirStat.st_ino), task.path);
+    }
+
+    const int dirFd = ::open(task.path.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd < 0) {
+        qCWarning(logDFMBase) << "FileScannerCore: open failed for" << task.path << ":" << strerror(errno);
+        if (cacheable)
+            cache->release(device, static_cast<quint64>(dirStat.st_ino));
+        return;
+    }
+    DIR *dir = fdopendir(dirFd);
+    if (!dir) {
+        qCWarning(logDFMBase) << "FileScannerCore: fdopendir failed for" << task.path << ":" << strerror(errno);
+        ::close(dirFd);
+        if (cacheable)
+            cache->release(device, static_cast<quint64>(dirStat.st_ino));
+        return;
+    }
+
+    const bool countOnly = options & FileScanner::ScanOption::CountOnly;
+    // 目录完整读取后才写入缓存
+    DirSizeCache::Entry cacheEntry;
+    bool complete = cacheable;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (stopped.load(std::memory_order_relaxed)) {
+            complete = false;
+            break;
+        }
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        QByteArray childPath;
+        childPath.reserve(task.path.size() + 1 + static_cast<int>(strlen(entry->d_name)));
+        childPath.append(task.path).append('/').append(entry->d_name);
+
+        if (countOnly) {
+            // CountOnly 模式：优先用 d_type，仅在 DT_UNKNOWN 时 fstatat 取类型
+            bool isDir = entry->d_type == DT_DIR;
+            if (entry->d_type == DT_UNKNOWN) {
+                struct stat sb;
+                isDir = fstatat(dirFd, entry->d_name, &sb, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(sb.st_mode);
+            }
+            if (isDir)
+                push(worker, { childPath, false, 0, false });
+            else
+                worker.fileCount.fetch_add(1, std::memory_order_relaxed);
+            collect(worker, childPath);
+            continue;
+        }
+
+        struct stat statBuf;
+        if (fstatat(dirFd, entry->d_name, &statBuf, AT_SYMLINK_NOFOLLOW) != 0) {
+            qCWarning(logDFMBase) << "FileScannerCore: fstatat failed for" << entry->d_name << "in" << task.path;
+            complete = false;
+            continue;
+        }
+
+        if (S_ISDIR(statBuf.st_mode)) {
+            push(worker, { childPath, false, device, cacheable });
+            if (cacheable)
+                cacheEntry.subDirs.append({ QByteArray(entry->d_name), static_cast<quint64>(statBuf.st_dev),
+                                            static_cast<quint64>(statBuf.st_ino) });
+        } else if (S_ISREG(statBuf.st_mode)) {
+            // 跳过特殊系统文件
+            if (childPath == "/proc/kcore" || childPath == "/dev/core")
+                continue;
+            addRegularFile(worker, statBuf);
+            if (statBuf.st_nlink > 1) {
+                if (cacheable)
+                    cacheEntry.linkedFiles.append({ static_cast<quint64>(statBuf.st_ino), statBuf.st_size });
+            } else {
+                cacheEntry.fileCount++;
+                cacheEntry.fileSize += statBuf.st_size;
+                cacheEntry.progressSize += statBuf.st_size <= 0 ? memoryPageSize : statBuf.st_size;
+            }
+        } else if (S_ISLNK(statBuf.st_mode)) {
+            // 符号链接只计数，不跟随
+            worker.fileCount.fetch_add(1, std::memory_order_relaxed);
+            worker.progressSize.fetch_add(memoryPageSize, std::memory_order_relaxed);
+            cacheEntry.fileCount++;
+            cacheEntry.progressSize += memoryPageSize;
+        } else {
+            worker.fileCount.fetch_add(1, std::memory_order_relaxed);
+            cacheEntry.fileCount++;
+        }
+        collect(worker, childPath);
+    }
+
+    closedir(dir);
+
+    if (complete) {
+        cacheEntry.modifiedTime = modifiedTimeOf(dirStat);
+        cache->insert(device, static_cast<quint64>(dirStat.st_ino), cacheEntry);
+    } else if (cacheable) {
+        cache->release(device, static_cast<quint64>(dirStat.st_ino));
+    }
+}
+
+bool ParallelScanJob::scanCachedDirectory(Worker &worker, const DirTask &task, const struct stat &dirStat)
+{
+    const quint64 device = static_cast<quint64>(dirStat.st_dev);
+    const quint64 inode = static_cast<quint64>(dirStat.st_ino);
+    const qint64 modifiedTime = modifiedTimeOf(dirStat);
+
+    // 整个子树都在监视中且没有变化，不再向下统计
+    DirSizeCache::Totals totals;
+    if (cache->findSubtree(device, inode, modifiedTime, &totals)) {
+        worker.fileCount.fetch_add(totals.fileCount, std::memory_order_relaxed);
+        worker.directoryCount.fetch_add(totals.directoryCount, std::memory_order_relaxed);
+        worker.totalSize.fetch_add(totals.fileSize, std::memory_order_relaxed);
+        worker.progressSize.fetch_add(totals.progressSize + totals.directoryCount * memoryPageSize,
+                                      std::memory_order_relaxed);
+        return true;
+    }
+
+    DirSizeCache::Entry entry;
+    if (!cache->find(device, inode, modifiedTime, &entry))
+        return false;
+
+    // 目录没有变化，使用缓存的统计，只需继续检查子目录
+    worker.fileCount.fetch_add(entry.fileCount, std::memory_order_relaxed);
+    worker.totalSize.fetch_add(entry.fileSize, std::memory_order_relaxed);
+    worker.progressSize.fetch_add(entry.progressSize, std::memory_order_relaxed);
+    for (const DirSizeCache::LinkedFile &link : std::as_const(entry.linkedFiles))
+        addLinkedFile(worker, device, link.inode, link.size);
+
+    for (const DirSizeCache::SubDir &subDir : std::as_const(entry.subDirs)) {
+        QByteArray childPath;
+        childPath.reserve(task.path.size() + 1 + subDir.name.size());
+        childPath.append(task.path).append('/').append(subDir.name);
+        push(worker, { childPath, false, device, true });
+    }
+    return true;
+}
+
+void ParallelScanJob::addRegularFile(Worker &worker, const struct stat &statBuf)
+{
+    if (statBuf.st_nlink > 1) {
+        addLinkedFile(worker, statBuf.st_dev, statBuf.st_ino, statBuf.st_size);
+        return;
+    }
+
+    worker.fileCount.fetch_add(1, std::memory_order_relaxed);
+    worker.totalSize.fetch_add(statBuf.st_size, std::memory_order_relaxed);
+    worker.progressSize.fetch_add(statBuf.st_size <= 0 ? memoryPageSize : statBuf.st_size, std::memory_order_relaxed);
+}
+
+void ParallelScanJob::addLinkedFile(Worker &worker, quint64 device, quint64 inode, qint64 size)
+{
+    worker.fileCount.fetch_add(1, std::memory_order_relaxed);
+    // 硬链接只统计一次大小
+    if (markInode(device, inode))
+        worker.totalSize.fetch_add(size, std::memory_order_relaxed);
+    worker.progressSize.fetch_add(size <= 0 ? memoryPageSize : size, std::memory_order_relaxed);
+}
+
+void ParallelScanJob::collect(Worker &worker, const QByteArray &path)
+{
+    if (options & FileScanner::ScanOption::CollectFiles)
+        worker.allFiles.append(QUrl::fromLocalFile(QString::fromUtf8(path)));
+}
+
+bool ParallelScanJob::markInode(quint64 device, quint64 inode)
+{
+    const InodeKey key { device, inode };
+    InodeShard &shard = inodeShards[InodeKeyHash()(key) % kInodeShardCount];
+    std::lock_guard<std::mutex> lk(shard.lock);
+    return shard.inodes.insert(key).second;
+}
+
 //===================================================================
 // FileScannerPrivate - 私有实现
 //===================================================================
@@ -319,7 +782,14 @@ FileScanner::ScanResult FileScannerCore::scanImpl(
 
     // 判断是否为本地文件路径
     if (!urls.isEmpty() && urls.first().scheme() == Global::Scheme::kFile) {
-        scanLocalPathsImpl(state, urls);
+        // 只统计顶层时没有可并行的子树
+        const bool parallel = (options & FileScanner::ScanOption::Parallel)
+                && !(options & FileScanner::ScanOption::SingleDepth)
+                && QThread::idealThreadCount() > 1;
+        if (parallel || useSizeCache(options))
+            scanLocalPathsParallel(state, urls);
+        else
+            scanLocalPathsImpl(state, urls);
     } else {
         scanOtherProtocolsImpl(state, urls);
     }
@@ -327,6 +797,15 @@ FileScanner::ScanResult FileScannerCore::scanImpl(
     return state.result;
 }
 
+bool FileScannerCore::useSizeCache(FileScanner::ScanOptions options)
+{
+    // 缓存只记录大小统计，不能用于收集文件和只计数
+    return (options & FileScanner::ScanOption::UseSizeCache)
+            && !(options & FileScanner::ScanOption::SingleDepth)
+            && !(options & FileScanner::ScanOption::CountOnly)
+            && !(options & FileScanner::ScanOption::CollectFiles);
+}
+
 qint64 FileScannerCore::progressDeltaForFileSize(const ScanState &state, qint64 fileSize)
 {
     return fileSize <= 0 ? state.memoryPageSize : fileSize;
@@ -341,37 +820,12 @@ void FileScannerCore::scanLocalPathsImpl(ScanState &state, const QList<QUrl> &ur
     QStack<ScanContext> dirStack;
 
     // 准备源路径
-    for (const QUrl &url : urls) {
-        QString path = url.path();
-
-        struct stat statBuf;
-        if (lstat(path.toUtf8().constData(), &statBuf) == 0) {
-            // 判断是否为目录（包括指向目录的符号链接）
-            if (isDirectoryPath(path, statBuf)) {
-                ScanContext ctx;
-                ctx.fullPath = path;
-                ctx.depth = 0;
-                ctx.isSourcePath = true;
-                dirStack.push(ctx);
-                // 收集源目录URL（如果启用 CollectFiles 选项）
-                collectFileIfEnabled(state, url, true);
-            } else {
-                // 非目录：直接收集（普通文件、符号链接等）
-                if (state.options & FileScanner::ScanOption::CountOnly) {
-                    state.result.fileCount++;
-                } else if (S_ISREG(statBuf.st_mode)) {
-                    processRegularFile(state, path, statBuf);
-                } else if (S_ISLNK(statBuf.st_mode)) {
-                    processSymlink(state, path);
-                } else {
-                    state.result.fileCount++;
-                }
-                // 收集源文件URL
-                collectFileIfEnabled(state, url, true);
-            }
-        } else {
-            qCWarning(logDFMBase) << "FileScannerCore: lstat failed for source:" << path;
-        }
+    for (const QString &path : prepareSourcePaths(state, urls)) {
+        ScanContext ctx;
+        ctx.fullPath = path;
+        ctx.depth = 0;
+        ctx.isSourcePath = true;
+        dirStack.push(ctx);
     }
 
     // ========== 遍历阶段 ==========
@@ -406,7 +860,8 @@ void FileScannerCore::scanLocalPathsImpl(ScanState &state, const QList<QUrl> &ur
             }
 
             const QString entryPath = dirPath + "/" + entry.name;
-            const QUrl entryUrl = QUrl::fromLocalFile(entryPath);
+            // 只有收集文件时才需要 URL
+            const QUrl entryUrl = (state.options & FileScanner::ScanOption::CollectFiles) ? QUrl::fromLocalFile(entryPath) : QUrl();
 
             if (countOnly) {
                 // CountOnly 模式：直接用 d_type 计数，无需 stat
@@ -493,6 +948,88 @@ void FileScannerCore::scanLocalPathsImpl(ScanState &state, const QList<QUrl> &ur
                         << "dirs:" << state.result.directoryCount << "size:" << state.result.totalSize;
 }
 
+QStringList FileScannerCore::prepareSourcePaths(ScanState &state, const QList<QUrl> &urls)
+{
+    // 非目录的源直接统计，返回需要遍历的源目录
+    QStringList dirPaths;
+    for (const QUrl &url : urls) {
+        QString path = url.path();
+
+        struct stat statBuf;
+        if (lstat(path.toUtf8().constData(), &statBuf) == 0) {
+            // 判断是否为目录（包括指向目录的符号链接）
+            if (isDirectoryPath(path, statBuf)) {
+                dirPaths.append(path);
+                // 收集源目录URL（如果启用 CollectFiles 选项）
+                collectFileIfEnabled(state, url, true);
+            } else {
+                // 非目录：直接收集（普通文件、符号链接等）
+                if (state.options & FileScanner::ScanOption::CountOnly) {
+                    state.result.fileCount++;
+                } else if (S_ISREG(statBuf.st_mode)) {
+                    processRegularFile(state, path, statBuf);
+                } else if (S_ISLNK(statBuf.st_mode)) {
+                    processSymlink(state, path);
+                } else {
+                    state.result.fileCount++;
+                }
+                // 收集源文件URL
+                collectFileIfEnabled(state, url, true);
+            }
+        } else {
+            qCWarning(logDFMBase) << "FileScannerCore: lstat failed for source:" << path;
+        }
+    }
+    return dirPaths;
+}
+
+void FileScannerCore::scanLocalPathsParallel(ScanState &state, const QList<QUrl> &urls)
+{
+    // 目录大小缓存只在任务中使用，未要求并行时用单线程
+    const int threadCount = (state.options & FileScanner::ScanOption::Parallel)
+            ? qMax(1, qMin(QThread::idealThreadCount(), kMaxParallelScanThreads))
+            : 1;
+    DirSizeCache *cache = useSizeCache(state.options) ? DirSizeCache::instance() : nullptr;
+    qCDebug(logDFMBase) << "FileScannerCore: Scanning local paths in parallel, threads:" << threadCount
+                        << "size cache:" << (cache != nullptr);
+
+    ParallelScanJob job(state.options, state.memoryPageSize, threadCount, cache);
+    for (const QString &path : prepareSourcePaths(state, urls))
+        job.addDirectory(path.toUtf8(), true);
+
+    // 源中的文件已计入 state.result，进度为其与各线程计数之和
+    const FileScanner::ScanResult sourceResult = state.result;
+    auto merged = [&sourceResult](const FileScanner::ScanResult &jobResult) {
+        FileScanner::ScanResult result = sourceResult;
+        result.fileCount += jobResult.fileCount;
+        result.directoryCount += jobResult.directoryCount;
+        result.totalSize += jobResult.totalSize;
+        result.progressSize += jobResult.progressSize;
+        result.allFiles.append(jobResult.allFiles);
+        return result;
+    };
+
+    job.start();
+    while (!job.waitFor(kParallelProgressInterval)) {
+        if (state.shouldStop || !state.progressCallback)
+            continue;
+        state.result = merged(job.snapshot());
+        emitProgress(state);
+        if (state.shouldStop)
+            job.stop();
+    }
+
+    state.result = merged(job.takeResult());
+
+    // 默认排除源目录本身
+    if (!(state.options & FileScanner::ScanOption::IncludeSource)) {
+        state.result.directoryCount -= job.processedSourceDirs();
+    }
+
+    qCDebug(logDFMBase) << "FileScannerCore: Parallel local scan completed - files:" << state.result.fileCount
+                        << "dirs:" << state.result.directoryCount << "size:" << state.result.totalSize;
+}
+
 void FileScannerCore::scanOtherProtocolsImpl(ScanState &state, const QList<QUrl> &urls)
 {
     qCDebug(logDFMBase) << "FileScannerCore: Scanning other protocols using InfoFactory";
@@ -60,7 +60,9 @@ public:
         SingleDepth = 0x01,   ///< 只统计顶层，不递归
         IncludeSource = 0x02,   ///< 包含源目录本身（默认不包含）
         CollectFiles = 0x04,   ///< 收集所有文件URL列表（默认不收集）
-        CountOnly = 0x08   ///< 只统计数量，跳过大小统计，避免 stat 系统调用以提升性能
+        CountOnly = 0x08,   ///< 只统计数量，跳过大小统计，避免 stat 系统调用以提升性能
+        Parallel = 0x10,   ///< 本地目录多线程并行扫描（SingleDepth 和非本地路径仍为单线程）
+        UseSizeCache = 0x20   ///< 本地目录复用监视中的目录大小缓存，只跳过没有变化的目录和子树（不适用于 CountOnly 和 CollectFiles）
     };
     Q_ENUM(ScanOption)
     Q_DECLARE_FLAGS(ScanOptions, ScanOption)
@@ -7,6 +7,7 @@
 #include "dialogs/dumpisooptdialog.h"
 #include "utils/burnhelper.h"
 #include "utils/burnjobmanager.h"
+#include "utils/virtualstaging.h"
 #include "events/burneventcaller.h"
 
 #include <dfm-base/dfm_global_defines.h>
@@ -41,6 +42,12 @@ BurnEventReceiver *BurnEventReceiver::instance()
 
 void BurnEventReceiver::handleShowBurnDlg(const QString &dev, bool isSupportedUDF, QWidget *parent)
 {
+    if (VirtualStaging::isStaging(BurnHelper::localStagingFile(dev).toLocalFile())) {
+        fmInfo() << "Files are still being added to the disc, burn refused:" << dev;
+        DialogManagerInstance->showMessageDialog(tr("Files are still being added to the disc. Please try again later."));
+        return;
+    }
+
     QString devId { DeviceUtils::getBlockDeviceId(dev) };
     const auto &map = DevProxyMng->queryBlockInfo(devId, true);
 
@@ -114,7 +121,49 @@ void BurnEventReceiver::handlePasteTo(const QList<QUrl> &urls, const QUrl &dest,
         tmpDest = UrlRoute::urlParent(tmpDest);
     QDir().mkpath(tmpDest.toLocalFile());
 
-    BurnEventCaller::sendPasteFiles(urls, tmpDest, isCopy);
+    QList<QUrl> copyUrls { urls };
+    if (isCopy && BurnHelper::isVirtualStagingEnabled())
+        copyUrls = stageWithoutCopy(dev, urls, tmpDest);
+
+    if (!copyUrls.isEmpty())
+        BurnEventCaller::sendPasteFiles(copyUrls, tmpDest, isCopy);
+}
+
+QList<QUrl> BurnEventReceiver::stageWithoutCopy(const QString &dev, const QList<QUrl> &urls, const QUrl &stagingDir)
+{
+    const QString &destDir { stagingDir.toLocalFile() };
+    QList<QUrl> graftUrls;
+    QList<QUrl> copyUrls;
+    for (const QUrl &url : urls) {
+        if (VirtualStaging::canStage(url, destDir))
+            graftUrls.append(url);
+        else
+            copyUrls.append(url);
+    }
+
+    if (graftUrls.isEmpty())
+        return copyUrls;
+
+    // linking a large folder tree walks it and hashes every file, keep it off the main thread
+    const QString &stagingRoot { BurnHelper::localStagingFile(dev).toLocalFile() };
+    VirtualStaging::setStaging(stagingRoot, true);
+    QtConcurrent::run([this, graftUrls, destDir, stagingDir, stagingRoot]() {
+        QList<QUrl> stagedSources;
+        QList<QUrl> stagedTargets;
+        VirtualStaging staging(stagingRoot);
+        const QList<QUrl> &rest { staging.stage(graftUrls, destDir, &stagedSources, &stagedTargets) };
+        VirtualStaging::setStaging(stagingRoot, false);
+        fmInfo() << "Staged" << stagedSources.size() << "items without copying, copy" << rest.size() << "items";
+
+        QMetaObject::invokeMethod(this, [rest, stagingDir, stagedSources, stagedTargets]() {
+            if (!stagedSources.isEmpty())
+                BurnHelper::mapStagingFilesPath(stagedSources, stagedTargets);
+            if (!rest.isEmpty())
+                BurnEventCaller::sendPasteFiles(rest, stagingDir, true);
+        });
+    });
+
+    return copyUrls;
 }
 
 void BurnEventReceiver::handleCopyFilesResult(const QList<QUrl> &srcUrls, const QList<QUrl> &destUrls, bool ok, const QString &errMsg)
@@ -43,6 +43,7 @@ public slots:
 
 private:
     explicit BurnEventReceiver(QObject *parent = nullptr);
+    QList<QUrl> stageWithoutCopy(const QString &dev, const QList<QUrl> &urls, const QUrl &stagingDir);
 };
 
 }
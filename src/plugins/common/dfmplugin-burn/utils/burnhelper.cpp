@@ -235,6 +235,12 @@ bool BurnHelper::isBurnEnabled()
     return ret.isValid() ? ret.toBool() : true;
 }
 
+bool BurnHelper::isVirtualStagingEnabled()
+{
+    const auto &&ret = DConfigManager::instance()->value("org.deepin.dde.file-manager.burn", "virtualStaging");
+    return ret.isValid() ? ret.toBool() : true;
+}
+
 bool BurnHelper::burnIsOnLocalStaging(const QUrl &url)
 {
     if (!url.path().contains("/.cache/deepin/discburn/_dev_"))
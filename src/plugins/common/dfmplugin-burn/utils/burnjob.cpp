@@ -6,6 +6,7 @@
 #include "utils/burnhelper.h"
 #include "utils/burnsignalmanager.h"
 #include "utils/burncheckstrategy.h"
+#include "utils/virtualstaging.h"
 
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/base/application/settings.h>
@@ -237,6 +238,26 @@ bool AbstractBurnJob::readyToWork()
     return true;
 }
 
+bool AbstractBurnJob::stagingUnchanged()
+{
+    // grafted files are burned from the sources, lock their content at commit
+    const auto &stagingUrl { curProperty[PropertyType::KStagingUrl].toUrl() };
+    if (VirtualStaging::isStaging(stagingUrl.toLocalFile())) {
+        fmWarning() << "Files are still being added to the disc:" << stagingUrl;
+        emit requestErrorMessageDialog(tr("Files are still being added to the disc. Please try again later."), {});
+        return false;
+    }
+
+    const QStringList &modified { VirtualStaging(stagingUrl.toLocalFile()).modifiedFiles() };
+    if (modified.isEmpty())
+        return true;
+
+    fmWarning() << "Files modified after they were added to the disc:" << modified;
+    emit requestErrorMessageDialog(tr("Some files were modified after being added to the disc. Please add them again."),
+                                   modified.join("\n"));
+    return false;
+}
+
 void AbstractBurnJob::workingInSubProcess()
 {
     int progressPipefd[2] {};
@@ -534,6 +555,8 @@ void BurnISOFilesJob::work()
     firstJobType = curJobType = JobType::kOpticalBurn;
     if (!fileSystemLimitsValid())
         return;
+    if (!stagingUnchanged())
+        return;
     if (!readyToWork())
         return;
     onJobUpdated(JobStatus::kIdle, 0, {}, {});
@@ -630,6 +653,8 @@ void BurnUDFFilesJob::work()
     firstJobType = curJobType = JobType::kOpticalBurn;
     if (!fileSystemLimitsValid())
         return;
+    if (!stagingUnchanged())
+        return;
     if (!readyToWork())
         return;
     onJobUpdated(JobStatus::kIdle, 0, {}, {});
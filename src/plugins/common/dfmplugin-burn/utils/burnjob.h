@@ -74,6 +74,7 @@ protected:
 
     void run() override;
     bool readyToWork();
+    bool stagingUnchanged();
     void workingInSubProcess();
     [[nodiscard]] DFMBURN::DOpticalDiscManager *createManager(int fd);
     QByteArray updatedInSubProcess(DFMBURN::JobStatus status, int progress, const QString &speed, const QStringList &message);
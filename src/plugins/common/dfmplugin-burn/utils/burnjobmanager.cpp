@@ -6,6 +6,7 @@
 #include "utils/burnjob.h"
 #include "utils/auditlogjob.h"
 #include "utils/packetwritingjob.h"
+#include "utils/virtualstaging.h"
 
 #include <dfm-base/file/local/localfilehandler.h>
 #include <dfm-base/utils/dialogmanager.h>
@@ -220,6 +221,7 @@ bool BurnJobManager::deleteStagingDir(const QUrl &url)
         return false;
     }
 
+    VirtualStaging::clear(path);
     fmInfo() << "Delete cache folder: " << url << "success";
     return true;
 }
@@ -0,0 +1,320 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "virtualstaging.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QSaveFile>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace dfmplugin_burn;
+
+static constexpr quint32 kRecordMagic { 0x44464d47 };   // "DFMG"
+static constexpr quint32 kRecordVersion { 2 };
+
+static QMutex stagingMutex;
+static QHash<QString, int> stagingCounts;
+
+// the staged entry still is the one we have recorded, i.e. it was not removed or replaced
+static bool lstatRecorded(const VirtualStaging::GraftPoint &point, struct stat *st)
+{
+    return ::lstat(QFile::encodeName(point.stagedPath).constData(), st) == 0
+            && static_cast<quint64>(st->st_ino) == point.inode;
+}
+
+VirtualStaging::VirtualStaging(const QString &stagingRoot)
+    : root(QDir::cleanPath(stagingRoot))
+{
+    load();
+}
+
+bool VirtualStaging::canStage(const QUrl &source, const QString &destDir)
+{
+    if (!source.isLocalFile())
+        return false;
+
+    const QString &sourcePath = QDir::cleanPath(source.toLocalFile());
+    const QString &target = QDir(destDir).filePath(QFileInfo(sourcePath).fileName());
+    // conflicts and copying a folder into itself are left to the copy job
+    if (QFileInfo::exists(target) || QDir::cleanPath(destDir).startsWith(sourcePath + "/"))
+        return false;
+
+    // a removable source may be gone before the burn, copy it while it is there
+    struct stat sourceStat;
+    struct stat destStat;
+    if (::lstat(QFile::encodeName(sourcePath).constData(), &sourceStat) != 0
+        || ::stat(QFile::encodeName(destDir).constData(), &destStat) != 0)
+        return false;
+    return sourceStat.st_dev == destStat.st_dev;
+}
+
+QList<QUrl> VirtualStaging::stage(const QList<QUrl> &sources, const QString &destDir,
+                                  QList<QUrl> *stagedSources, QList<QUrl> *stagedTargets)
+{
+    // pastes to the same disc may run at the same time, they share the record file
+    static QMutex mutex;
+    QMutexLocker locker(&mutex);
+    load();
+
+    QList<QUrl> rest;
+    for (const QUrl &url : sources) {
+        if (!canStage(url, destDir)) {
+            rest.append(url);
+            continue;
+        }
+
+        const QString &source = QDir::cleanPath(url.toLocalFile());
+        const QString &target = QDir(destDir).filePath(QFileInfo(source).fileName());
+        QList<GraftPoint> added;
+        if (!stageEntry(source, target, &added)) {
+            fmInfo() << "Cannot stage without copying, fallback to copy:" << source;
+            // the target did not exist before, remove what has been staged
+            if (QFileInfo(target).isDir())
+                QDir(target).removeRecursively();
+            else
+                QFile::remove(target);
+            rest.append(url);
+            continue;
+        }
+
+        grafts.append(added);
+        if (stagedSources)
+            stagedSources->append(url);
+        if (stagedTargets)
+            stagedTargets->append(QUrl::fromLocalFile(target));
+    }
+
+    if (rest.size() != sources.size())
+        save();
+    return rest;
+}
+
+QList<VirtualStaging::GraftPoint> VirtualStaging::graftPoints() const
+{
+    return grafts;
+}
+
+QStringList VirtualStaging::modifiedFiles() const
+{
+    QStringList files;
+    for (const GraftPoint &point : grafts) {
+        // a reflink owns its content once staged
+        if (point.mode != Mode::kLink)
+            continue;
+
+        struct stat st;
+        if (!lstatRecorded(point, &st))
+            continue;
+
+        // size and mtime may be kept by an edit, compare the content
+        if (::stat(QFile::encodeName(point.source).constData(), &st) != 0
+            || st.st_size != point.size || checksum(point.source) != point.checksum)
+            files.append(point.source);
+    }
+    return files;
+}
+
+void VirtualStaging::clear(const QString &stagingRoot)
+{
+    QFile::remove(recordFile(QDir::cleanPath(stagingRoot)));
+}
+
+void VirtualStaging::setStaging(const QString &stagingRoot, bool staging)
+{
+    const QString &root = QDir::cleanPath(stagingRoot);
+    QMutexLocker locker(&stagingMutex);
+    if (staging)
+        ++stagingCounts[root];
+    else if (--stagingCounts[root] <= 0)
+        stagingCounts.remove(root);
+}
+
+bool VirtualStaging::isStaging(const QString &stagingRoot)
+{
+    QMutexLocker locker(&stagingMutex);
+    return stagingCounts.contains(QDir::cleanPath(stagingRoot));
+}
+
+bool VirtualStaging::load()
+{
+    grafts.clear();
+
+    QFile file(recordFile(root));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    in >> magic >> version >> count;
+    if (magic != kRecordMagic || version != kRecordVersion)
+        return false;
+
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        GraftPoint point;
+        quint8 mode = 0;
+        in >> point.source >> point.stagedPath >> mode >> point.inode >> point.size >> point.checksum;
+        point.mode = static_cast<Mode>(mode);
+
+        // removed from the staging area since
+        struct stat st;
+        if (lstatRecorded(point, &st))
+            grafts.append(point);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        fmWarning() << "Graft records are corrupted:" << file.fileName();
+        grafts.clear();
+        return false;
+    }
+    return true;
+}
+
+bool VirtualStaging::save() const
+{
+    QSaveFile file(recordFile(root));
+    if (!file.open(QIODevice::WriteOnly)) {
+        fmWarning() << "Cannot save graft records:" << file.fileName() << file.errorString();
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << kRecordMagic << kRecordVersion << static_cast<quint32>(grafts.size());
+    for (const GraftPoint &point : grafts)
+        out << point.source << point.stagedPath << static_cast<quint8>(point.mode)
+            << point.inode << point.size << point.checksum;
+
+    return file.commit();
+}
+
+bool VirtualStaging::stageEntry(const QString &source, const QString &target, QList<GraftPoint> *added) const
+{
+    const QByteArray &sourceName = QFile::encodeName(source);
+    const QByteArray &targetName = QFile::encodeName(target);
+
+    struct stat st;
+    if (::lstat(sourceName.constData(), &st) != 0)
+        return false;
+
+    if (S_ISREG(st.st_mode))
+        return stageFile(source, target, added);
+
+    if (S_ISLNK(st.st_mode)) {
+        char linkTarget[PATH_MAX] { 0 };
+        const ssize_t len = ::readlink(sourceName.constData(), linkTarget, sizeof(linkTarget) - 1);
+        return len > 0 && ::symlink(linkTarget, targetName.constData()) == 0;
+    }
+
+    if (S_ISDIR(st.st_mode)) {
+        // the staging area must stay editable
+        if (::mkdir(targetName.constData(), (st.st_mode & 07777) | S_IRWXU) != 0)
+            return false;
+
+        const QStringList &names = QDir(source).entryList(QDir::AllEntries | QDir::NoDotAndDotDot
+                                                          | QDir::Hidden | QDir::System);
+        for (const QString &name : names) {
+            if (!stageEntry(source + "/" + name, target + "/" + name, added))
+                return false;
+        }
+        return true;
+    }
+
+    // devices, fifos and sockets are left to the copy job
+    return false;
+}
+
+bool VirtualStaging::stageFile(const QString &source, const QString &target, QList<GraftPoint> *added) const
+{
+    GraftPoint point;
+    point.source = source;
+    point.stagedPath = target;
+
+    // a reflink owns its content, a link is checked against the checksum before the burn
+    if (reflink(source, target)) {
+        point.mode = Mode::kReflink;
+    } else {
+        struct stat st;
+        if (::stat(QFile::encodeName(source).constData(), &st) != 0)
+            return false;
+        point.size = st.st_size;
+        point.checksum = checksum(source);
+        if (point.checksum.isEmpty()
+            || ::symlink(QFile::encodeName(source).constData(), QFile::encodeName(target).constData()) != 0)
+            return false;
+        point.mode = Mode::kLink;
+    }
+
+    struct stat st;
+    if (::lstat(QFile::encodeName(target).constData(), &st) != 0)
+        return false;
+    point.inode = static_cast<quint64>(st.st_ino);
+    added->append(point);
+    return true;
+}
+
+bool VirtualStaging::reflink(const QString &source, const QString &target)
+{
+#ifdef FICLONE
+    const int in = ::open(QFile::encodeName(source).constData(), O_RDONLY | O_CLOEXEC);
+    if (in < 0)
+        return false;
+
+    struct stat st;
+    if (::fstat(in, &st) != 0) {
+        ::close(in);
+        return false;
+    }
+
+    const QByteArray &targetName = QFile::encodeName(target);
+    const int out = ::open(targetName.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, st.st_mode & 07777);
+    if (out < 0) {
+        ::close(in);
+        return false;
+    }
+
+    const bool ok = ::ioctl(out, FICLONE, in) == 0;
+    ::close(out);
+    ::close(in);
+    if (!ok)
+        ::unlink(targetName.constData());
+    return ok;
+#else
+    Q_UNUSED(source)
+    Q_UNUSED(target)
+    return false;
+#endif
+}
+
+QByteArray VirtualStaging::checksum(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    if (!hash.addData(&file))
+        return {};
+    return hash.result();
+}
+
+QString VirtualStaging::recordFile(const QString &stagingRoot)
+{
+    // outside of the staging folder, it must not be burned
+    return stagingRoot + ".grafts";
+}
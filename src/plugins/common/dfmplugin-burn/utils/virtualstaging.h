@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef VIRTUALSTAGING_H
+#define VIRTUALSTAGING_H
+
+#include "dfmplugin_burn_global.h"
+
+#include <QUrl>
+#include <QList>
+#include <QStringList>
+
+namespace dfmplugin_burn {
+
+/*!
+ * \brief Stages files for a data disc without duplicating their content
+ *
+ * The burn backend takes a staging directory. Instead of copying a source
+ * into it, every file is added as a graft point: a symbolic link to the
+ * source, so the burner reads the data straight from the source. Where the
+ * file system supports it a reflink is made instead, which owns its content
+ * and shares only the extents until either side is written. The staging
+ * area never shares an inode with a source.
+ *
+ * The grafts are recorded next to the staging directory with the size and a
+ * checksum of the source taken when it was staged. The burn job compares
+ * them before commit and refuses to burn a file that was modified in between.
+ */
+class VirtualStaging
+{
+public:
+    enum class Mode {
+        kLink,   // symbolic link to the source
+        kReflink
+    };
+
+    struct GraftPoint
+    {
+        QString source;
+        QString stagedPath;
+        Mode mode { Mode::kLink };
+        quint64 inode { 0 };   // of the staged entry
+        qint64 size { 0 };
+        QByteArray checksum;
+    };
+
+    explicit VirtualStaging(const QString &stagingRoot);
+
+    static bool canStage(const QUrl &source, const QString &destDir);
+    QList<QUrl> stage(const QList<QUrl> &sources, const QString &destDir,
+                      QList<QUrl> *stagedSources, QList<QUrl> *stagedTargets);
+
+    QList<GraftPoint> graftPoints() const;
+    QStringList modifiedFiles() const;
+    static void clear(const QString &stagingRoot);
+
+    // staging runs in background, the burn must wait until it is done
+    static void setStaging(const QString &stagingRoot, bool staging);
+    static bool isStaging(const QString &stagingRoot);
+
+private:
+    bool load();
+    bool save() const;
+    bool stageEntry(const QString &source, const QString &target, QList<GraftPoint> *added) const;
+    bool stageFile(const QString &source, const QString &target, QList<GraftPoint> *added) const;
+    static bool reflink(const QString &source, const QString &target);
+    static QByteArray checksum(const QString &path);
+    static QString recordFile(const QString &stagingRoot);
+
+    QString root;
+    QList<GraftPoint> grafts;
+};
+
+}   // namespace dfmplugin_burn
+
+#endif   // VIRTUALSTAGING_H
@@ -42,6 +42,7 @@ protected:
     void stop() override;
     bool initArgs() override;
     void endWork() override;
+    bool supportStreamStatistics() const override { return true; }
 
 protected:
     bool copyFiles();
@@ -122,6 +122,7 @@ void AbstractWorker::stop()
  */
 void AbstractWorker::pause()
 {
+    suspendIoDevices();
     if (currentState == AbstractJobHandler::JobState::kPauseState)
         return;
     if (speedtimer) {
@@ -269,7 +270,10 @@ bool AbstractWorker::statisticsFilesSize()
     // Set workData flags for use in DoCopyFileWorker
     workData->isSourceFileLocal = isSourceFileLocal;
 
-    if (isSourceFileLocal) {
+    // 本地文件开启边统计边拷贝时，与非本地文件一样走异步统计，拷贝不等待统计完成
+    const bool streaming = isSourceFileLocal && supportStreamStatistics() && FileOperationsUtils::streamStatistics();
+
+    if (isSourceFileLocal && !streaming) {
         fmDebug() << "Using synchronous file size calculation for local files";
         const SizeInfoPointer &fileSizeInfo = FileOperationsUtils::statisticsFilesSize(sourceUrls, true);
         allFilesList = fileSizeInfo->allFiles;
@@ -278,7 +282,11 @@ bool AbstractWorker::statisticsFilesSize()
         sourceFilesCount = fileSizeInfo->fileCount;
         fmInfo() << "File statistics completed - total size:" << sourceFilesTotalSize << "file count:" << sourceFilesCount;
     } else {
-        fmDebug() << "Using asynchronous file size calculation for remote files";
+        if (streaming)
+            fmDebug() << "Using streaming file size calculation for local files";
+        else
+            fmDebug() << "Using asynchronous file size calculation for remote files";
+        streamStatistics = streaming;
         workData->dirSize = FileUtils::getMemoryPageSize();
         startAsyncStatistics(sourceUrls);
     }
@@ -290,10 +298,16 @@ bool AbstractWorker::statisticsFilesSize()
  */
 bool AbstractWorker::workerWait()
 {
-    QMutexLocker locker(&mutex);
-    waitCondition.wait(&mutex);
+    suspendIoDevices();
+    {
+        QMutexLocker locker(&mutex);
+        waitCondition.wait(&mutex);
+    }
 
-    return currentState == AbstractJobHandler::JobState::kRunningState;
+    if (currentState != AbstractJobHandler::JobState::kRunningState)
+        return false;
+    // 继续前重新排队取得设备令牌
+    return ioCheckpoint();
 }
 /*!
  * \brief AbstractWorker::setStat Set current task status
@@ -334,6 +348,8 @@ bool AbstractWorker::initArgs()
 void AbstractWorker::endWork()
 {
     syncFilesToDevice();
+    if (workData)
+        workData->ioTicket.reset();
 
     setStat(AbstractJobHandler::JobState::kStopState);
     Q_EMIT removeTaskWidget();
@@ -404,7 +420,7 @@ void AbstractWorker::emitProgressChangedNotify(const qint64 &writSize)
     }
     AbstractJobHandler::StatisticState state = AbstractJobHandler::StatisticState::kNoState;
     if (statisticsThread) {
-        if (statisticsThread->isRunning())
+        if (isStatisticsRunning())
             state = AbstractJobHandler::StatisticState::kRunningState;
         else
             state = AbstractJobHandler::StatisticState::kStopState;
@@ -522,6 +538,62 @@ void AbstractWorker::checkRetry()
         return;
     emit retryErrSuccess(quintptr(this));
 }
+/*!
+ * \brief AbstractWorker::acquireIoDevices 拷贝和跨设备剪切按设备排队
+ * 同一机械盘上的任务依次执行，避免多个任务同时读写导致磁头来回寻道
+ * \return false 排队时任务被停止
+ */
+bool AbstractWorker::acquireIoDevices()
+{
+    if (!FileOperationsUtils::ioDeviceScheduler())
+        return true;
+    if (jobType != AbstractJobHandler::JobType::kCopyType && jobType != AbstractJobHandler::JobType::kCutType)
+        return true;
+    // 同一挂载点内的剪切只是重命名
+    if (jobType == AbstractJobHandler::JobType::kCutType
+        && std::all_of(sourceUrls.cbegin(), sourceUrls.cend(), [this](const QUrl &url) {
+               return FileUtils::isSameMountPoint(url, targetUrl);
+           }))
+        return true;
+
+    QList<QUrl> urls = sourceUrls;
+    urls.append(targetUrl);
+    workData->ioTicket = IoDeviceScheduler::instance()->createTicket(urls);
+    return IoDeviceScheduler::instance()->acquire(
+            workData->ioTicket, [this] { return isStopped(); },
+            [this](int ahead, const QString &device) { emitIoQueueNotify(ahead, device); });
+}
+/*!
+ * \brief AbstractWorker::ioCheckpoint 在文件之间和暂停结束后调用，重新取得暂停时归还的令牌，
+ * 机械盘上的时间片用完后让给排队的任务
+ * \return false 重新排队时任务被停止
+ */
+bool AbstractWorker::ioCheckpoint()
+{
+    if (!workData || !workData->ioTicket)
+        return true;
+    return IoDeviceScheduler::instance()->checkpoint(
+            workData->ioTicket, [this] { return isStopped(); },
+            [this](int ahead, const QString &device) { emitIoQueueNotify(ahead, device); });
+}
+/*!
+ * \brief AbstractWorker::suspendIoDevices 暂停或等待用户处理时归还设备令牌，
+ * 否则同一机械盘上的其他任务会一直排队
+ */
+void AbstractWorker::suspendIoDevices()
+{
+    if (workData && workData->ioTicket)
+        IoDeviceScheduler::instance()->suspend(workData->ioTicket);
+}
+
+void AbstractWorker::emitIoQueueNotify(int ahead, const QString &device)
+{
+    JobInfoPointer info(new QMap<quint8, QVariant>);
+    info->insert(AbstractJobHandler::NotifyInfoKey::kJobtypeKey, QVariant::fromValue(jobType));
+    info->insert(AbstractJobHandler::NotifyInfoKey::kIoQueueKey, QVariant::fromValue(ahead));
+    info->insert(AbstractJobHandler::NotifyInfoKey::kIoDeviceKey, QVariant::fromValue(device));
+    emit speedUpdatedNotify(info);
+}
 /*!
  * \brief AbstractWorker::doWork task Thread execution
  * \return
@@ -539,6 +611,12 @@ bool AbstractWorker::doWork()
         endWork();
         return false;
     }
+    // 等待源和目标所在设备空闲
+    if (!acquireIoDevices()) {
+        fmInfo() << "Work stopped while queued for the devices";
+        endWork();
+        return false;
+    }
     // 统计文件总大小
     if (!statisticsFilesSize()) {
         fmWarning() << "Failed to calculate file statistics";
@@ -579,6 +657,7 @@ void AbstractWorker::startAsyncStatistics(const QList<QUrl> &urls)
 {
     // Reset stop flag
     statisticsStopFlag.storeRelaxed(0);
+    statisticsFinished = false;
 
     // Create thread that executes interruptible scan
     statisticsThread = QThread::create([this, urls]() {
@@ -595,7 +674,7 @@ void AbstractWorker::startAsyncStatistics(const QList<QUrl> &urls)
         // Call scanSyncWithCallback with progress callback
         auto result = DFMBASE_NAMESPACE::FileScanner::scanSyncWithCallback(
                 urls,
-                DFMBASE_NAMESPACE::FileScanner::ScanOption::IncludeSource,
+                DFMBASE_NAMESPACE::FileScanner::ScanOption::IncludeSource | DFMBASE_NAMESPACE::FileScanner::ScanOption::Parallel,
                 progressCallback);
 
         // Only update data if not stopped
@@ -604,6 +683,7 @@ void AbstractWorker::startAsyncStatistics(const QList<QUrl> &urls)
             sourceFilesTotalSize = result.progressSize;
             sourceFilesCount = result.fileCount;
             sourceDirsCount = result.directoryCount;
+            statisticsFinished = true;
 
             fmInfo() << "Asynchronous file statistics completed - total size:" << sourceFilesTotalSize
                      << "all files count:" << (sourceFilesCount + sourceDirsCount);
@@ -615,6 +695,15 @@ void AbstractWorker::startAsyncStatistics(const QList<QUrl> &urls)
     statisticsThread->start();
 }
 
+/*!
+ * \brief AbstractWorker::isStatisticsRunning Whether asynchronous statistics is still running
+ * \return true if total size and files count are not exact yet
+ */
+bool AbstractWorker::isStatisticsRunning() const
+{
+    return statisticsThread && !statisticsFinished && statisticsThread->isRunning();
+}
+
 AbstractWorker::AbstractWorker(QObject *parent)
     : QObject(parent)
 {
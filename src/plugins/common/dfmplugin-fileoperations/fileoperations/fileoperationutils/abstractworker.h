@@ -9,6 +9,7 @@
 #include "fileoperationsutils.h"
 #include "workerdata.h"
 #include "docopyfileworker.h"
+#include "iodevicescheduler.h"
 
 #include <dfm-base/interfaces/abstractjobhandler.h>
 #include <dfm-base/file/local/localfilehandler.h>
@@ -130,6 +131,9 @@ protected:
     virtual void performSync() { }
     virtual void performAsyncSync() { }
 
+    // Copy while source statistics still running on local devices
+    virtual bool supportStreamStatistics() const { return false; }
+
 protected slots:
     virtual bool doWork();
     virtual void onUpdateProgress() { }
@@ -153,11 +157,17 @@ protected:
     void getAction(AbstractJobHandler::SupportActions actions);
     QUrl parentUrl(const QUrl &url);
     void syncFilesToDevice();
+    // 按源和目标所在设备排队，取消时返回 false
+    bool acquireIoDevices();
+    bool ioCheckpoint();
+    void suspendIoDevices();
+    void emitIoQueueNotify(int ahead, const QString &device);
 
     static dfmbase::FileInfo::FileType fileType(const DFileInfoPointer &info);
 
     // 启动异步统计
     void startAsyncStatistics(const QList<QUrl> &urls);
+    bool isStatisticsRunning() const;
 
 public:
     virtual ~AbstractWorker();
@@ -165,6 +175,8 @@ public:
 public:
     QThread *statisticsThread { nullptr };   // file statistics thread (for async scanSync call)
     QAtomicInt statisticsStopFlag { 0 };     // stop flag for statistics thread (0=running, 1=should stop)
+    std::atomic_bool statisticsFinished { false };   // async statistics finished, total size is exact
+    std::atomic_bool streamStatistics { false };   // local files copied while statistics running
     QSharedPointer<UpdateProgressTimer> updateProgressTimer { nullptr };   // update progress timer
 
     JobHandlePointer handle { nullptr };   // handle
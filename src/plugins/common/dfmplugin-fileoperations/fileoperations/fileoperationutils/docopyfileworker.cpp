@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "docopyfileworker.h"
+#include "fileoperationsutils.h"
+#include "integrityverifier.h"
 
 #include <dfm-base/utils/fileutils.h>
 #include <dfm-base/base/device/deviceutils.h>
@@ -218,10 +220,116 @@ DoCopyFileWorker::NextDo DoCopyFileWorker::doCopyFilePractically(const DFileInfo
     if (useDirectMode) {
         // Use new O_DIRECT implementation for safe sync mode
         return doCopyFileWithDirectIO(fromInfo, toInfo, skip);
-    } else {
-        // Use traditional DFMIO implementation for other cases
-        return doCopyFileTraditional(fromInfo, toInfo, skip);
     }
+
+    // 网络和外接设备上多个块同时读写
+    if (!workData->isTargetFileLocal || !workData->isSourceFileLocal) {
+        NextDo nextDo = doCopyFileWithUring(fromInfo, toInfo, skip);
+        if (nextDo != NextDo::kDoCopyFallback)
+            return nextDo;
+    }
+
+    // Use traditional DFMIO implementation for other cases
+    return doCopyFileTraditional(fromInfo, toInfo, skip);
+}
+
+/*!
+ * \brief DoCopyFileWorker::doCopyFileWithUring Copy file with io_uring, several blocks in flight
+ * \param fromInfo Source file info
+ * \param toInfo Target file info
+ * \param skip Skip flag
+ * \return NextDo status, kDoCopyFallback when io_uring can not be used for this file
+ */
+DoCopyFileWorker::NextDo DoCopyFileWorker::doCopyFileWithUring(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo, bool *skip)
+{
+    if (!fromInfo->uri().isLocalFile() || !toInfo->uri().isLocalFile())
+        return NextDo::kDoCopyFallback;
+    if (!UringCopyEngine::isSupported() || !FileOperationsUtils::ioUringCopy())
+        return NextDo::kDoCopyFallback;
+    if (!uringEngine)
+        uringEngine.reset(new UringCopyEngine);
+    if (!uringEngine->isValid())
+        return NextDo::kDoCopyFallback;
+
+    int srcFd = openFileBySys(fromInfo, toInfo, O_RDONLY, skip);
+    if (srcFd < 0)
+        return NextDo::kDoCopyErrorAddCancel;
+    FinallyUtil releaseSrc([&] {
+        close(srcFd);
+    });
+    int dstFd = openFileBySys(fromInfo, toInfo, O_CREAT | O_WRONLY | O_TRUNC, skip, false);
+    if (dstFd < 0)
+        return NextDo::kDoCopyErrorAddCancel;
+    FinallyUtil releaseDst([&] {
+        if (dstFd >= 0)
+            close(dstFd);
+    });
+
+    const auto fromSize = fromInfo->attribute(DFileInfo::AttributeID::kStandardSize).toLongLong();
+    if (fromSize <= 0)
+        workData->zeroOrlinkOrDirWriteSize += FileUtils::getMemoryPageSize();
+
+    const bool checksum = workData->jobFlags.testFlag(AbstractJobHandler::JobFlag::kCopyIntegrityChecking);
+    UringCopyEngine::Progress progress;
+    Q_FOREVER {
+        // 提交失败后引擎不再可用，重试时交给同步读写
+        if (!uringEngine->isValid())
+            return NextDo::kDoCopyFallback;
+
+        int error = 0;
+        const auto result = uringEngine->copy(
+                srcFd, dstFd, fromSize, &progress, checksum,
+                [this] { return state != kNormal; },
+                [this](qint64 size) { workData->currentWriteSize += size; },
+                &error);
+        if (result == UringCopyEngine::Result::kFinished)
+            break;
+        // 暂停时等待恢复，从断点继续
+        if (result == UringCopyEngine::Result::kInterrupted) {
+            if (!stateCheck())
+                return NextDo::kDoCopyErrorAddCancel;
+            continue;
+        }
+
+        // 文件系统不支持时交给同步读写，目标文件由其重新截断
+        if (progress.copied == 0 && (error == EINVAL || error == EOPNOTSUPP || error == ENOSYS)) {
+            fmInfo() << "io_uring copy not supported, fallback - from:" << fromInfo->uri() << "error:" << strerror(error);
+            return NextDo::kDoCopyFallback;
+        }
+
+        const bool isWrite = result == UringCopyEngine::Result::kWriteError;
+        fmWarning() << "io_uring copy error - from:" << fromInfo->uri() << "to:" << toInfo->uri() << "error:" << strerror(error);
+        auto action = doHandleErrorAndWait(fromInfo->uri(), toInfo->uri(),
+                                           mapSystemErrorToJobError(error, isWrite), isWrite, strerror(error));
+        checkRetry();
+        if (action == AbstractJobHandler::SupportAction::kRetryAction && !isStopped())
+            continue;
+        if (!actionOperating(action, fromSize - progress.copied, skip))
+            return NextDo::kDoCopyErrorAddCancel;
+    }
+    close(dstFd);
+    dstFd = -1;
+
+    // 对文件加权
+    setTargetPermissions(fromInfo->uri(), toInfo->uri());
+    if (!stateCheck())
+        return NextDo::kDoCopyErrorAddCancel;
+
+    // 校验文件完整性
+    if (skip && checksum) {
+        QSharedPointer<DFMIO::DFile> checkDevice(new DFMIO::DFile(toInfo->uri()));
+        if (!openFile(fromInfo, toInfo, checkDevice, DFMIO::DFile::OpenFlag::kReadOnly, skip))
+            return NextDo::kDoCopyErrorAddCancel;
+        *skip = verifyFileIntegrity(uringEngine->blockSize(), progress.checksum, fromInfo, toInfo, checkDevice);
+    } else if (skip) {
+        *skip = true;
+    }
+    toInfo->refresh();
+
+    if (skip && *skip)
+        FileUtils::notifyFileChangeManual(DFMBASE_NAMESPACE::Global::FileNotifyType::kFileAdded, toInfo->uri());
+
+    return NextDo::kDoCopyNext;
 }
 
 /*!
@@ -454,6 +562,13 @@ DoCopyFileWorker::NextDo DoCopyFileWorker::doCopyFileTraditional(const DFileInfo
     uLong sourceCheckSum = adler32(0L, nullptr, 0);
     qint64 sizeRead = 0;
 
+    // 本地路径的目标边拷贝边校验，不再拷贝完成后重新读取整个文件
+    const bool integrityChecking = workData->jobFlags.testFlag(AbstractJobHandler::JobFlag::kCopyIntegrityChecking);
+    const int sampling = integrityChecking ? FileOperationsUtils::integrityVerifySampling() : 0;
+    QScopedPointer<IntegrityVerifier> verifier;
+    if (sampling > 0 && toInfo->uri().isLocalFile())
+        verifier.reset(new IntegrityVerifier(toInfo->uri().path(), sampling, &workData->verifiedSize));
+
     do {
         auto nextReadDo = doReadFile(fromInfo, toInfo, fromDevice, data, blockSize, sizeRead, skip);
         if (nextReadDo != NextDo::kDoCopyCurrentFile) {
@@ -466,7 +581,10 @@ DoCopyFileWorker::NextDo DoCopyFileWorker::doCopyFileTraditional(const DFileInfo
             return nextDo;
         }
 
-        if (Q_LIKELY(workData->jobFlags.testFlag(AbstractJobHandler::JobFlag::kCopyIntegrityChecking))) {
+        if (Q_UNLIKELY(verifier)) {
+            const qint64 pos = fromDevice->pos();
+            verifier->addBlock(pos - sizeRead, data, sizeRead, pos == fromSize);
+        } else if (Q_UNLIKELY(integrityChecking)) {
             sourceCheckSum = adler32(sourceCheckSum, reinterpret_cast<Bytef *>(data), static_cast<uInt>(sizeRead));
         }
 
@@ -480,7 +598,9 @@ DoCopyFileWorker::NextDo DoCopyFileWorker::doCopyFileTraditional(const DFileInfo
         return NextDo::kDoCopyErrorAddCancel;
 
     // 校验文件完整性
-    if (skip)
+    if (skip && verifier)
+        *skip = finishIntegrityVerify(verifier.data(), fromInfo, toInfo);
+    else if (skip)
         *skip = verifyFileIntegrity(blockSize, sourceCheckSum, fromInfo, toInfo, toDevice);
     toInfo->refresh();
 
@@ -600,8 +720,14 @@ bool DoCopyFileWorker::stateCheck()
 
 void DoCopyFileWorker::workerWait()
 {
-    QMutexLocker locker(mutex.data());
-    waitCondition->wait(mutex.data());
+    // 暂停或等待用户处理时不占用设备令牌，继续前重新排队
+    IoDeviceScheduler::instance()->suspend(workData->ioTicket);
+    {
+        QMutexLocker locker(mutex.data());
+        waitCondition->wait(mutex.data());
+    }
+    if (state == kNormal)
+        IoDeviceScheduler::instance()->acquire(workData->ioTicket, [this] { return isStopped(); }, nullptr);
 }
 
 bool DoCopyFileWorker::actionOperating(const AbstractJobHandler::SupportAction action, const qint64 size, bool *skip)
@@ -1055,6 +1181,26 @@ bool DoCopyFileWorker::verifyFileIntegrity(const qint64 &blockSize, const ulong
     return true;
 }
 
+/*!
+ * \brief DoCopyFileWorker::finishIntegrityVerify Wait for the blocks still being verified in background
+ * \return same as verifyFileIntegrity, false when the user did not skip a failed check
+ */
+bool DoCopyFileWorker::finishIntegrityVerify(IntegrityVerifier *verifier, const DFileInfoPointer &fromInfo, const DFileInfoPointer &toInfo)
+{
+    qint64 mismatchOffset = -1;
+    QString errorMsg;
+    if (verifier->finish(&mismatchOffset, &errorMsg))
+        return true;
+
+    fmWarning() << "Integrity check failed - offset:" << mismatchOffset << "file:" << toInfo->uri() << "error:" << errorMsg;
+    AbstractJobHandler::SupportAction actionForCheck = doHandleErrorAndWait(fromInfo->uri(),
+                                                                            toInfo->uri(),
+                                                                            AbstractJobHandler::JobErrorType::kIntegrityCheckingError,
+                                                                            true,
+                                                                            errorMsg);
+    return actionForCheck == AbstractJobHandler::SupportAction::kSkipAction;
+}
+
 void DoCopyFileWorker::checkRetry()
 {
     if (!workData->singleThread && retry && !isStopped()) {
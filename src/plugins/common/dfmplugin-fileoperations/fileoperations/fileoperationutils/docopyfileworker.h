@@ -7,6 +7,7 @@
 
 #include "dfmplugin_fileoperations_global.h"
 #include "workerdata.h"
+#include "uringcopyengine.h"
 
 #include <dfm-base/interfaces/fileinfo.h>
 #include <dfm-base/interfaces/abstractjobhandler.h>
@@ -16,6 +17,7 @@
 #include <dfm-io/doperator.h>
 
 #include <QObject>
+#include <QScopedPointer>
 
 #include <fcntl.h>
 
@@ -24,6 +26,7 @@ class QMutex;
 USING_IO_NAMESPACE
 DPFILEOPERATIONS_BEGIN_NAMESPACE
 DFMBASE_USE_NAMESPACE
+class IntegrityVerifier;
 class DoCopyFileWorker : public QObject
 {
     Q_OBJECT
@@ -78,6 +81,9 @@ public:
     // O_DIRECT copy for safe sync mode
     [[nodiscard]] NextDo doCopyFileWithDirectIO(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo,
                                                 bool *skip);
+    // io_uring copy for network and external targets, kDoCopyFallback when unavailable
+    [[nodiscard]] NextDo doCopyFileWithUring(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo,
+                                             bool *skip);
     // Traditional DFMIO copy
     [[nodiscard]] NextDo doCopyFileTraditional(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo,
                                                bool *skip);
@@ -135,6 +141,7 @@ private:   // file copy
     bool verifyFileIntegrity(const qint64 &blockSize, const ulong &sourceCheckSum,
                              const DFileInfoPointer &fromInfo, const DFileInfoPointer &toInfo,
                              QSharedPointer<DFMIO::DFile> &toFile);
+    bool finishIntegrityVerify(IntegrityVerifier *verifier, const DFileInfoPointer &fromInfo, const DFileInfoPointer &toInfo);
     void checkRetry();
     bool isStopped();
     int openFileBySys(const DFileInfoPointer &fromInfo, const DFileInfoPointer &toInfo,
@@ -163,6 +170,7 @@ private:
     int blockFileFd { -1 };
     QList<QUrl> skipUrls;
     DThreadList<QSharedPointer<dfmio::DOperator>> fileOps;
+    QScopedPointer<UringCopyEngine> uringEngine;   // created on the first io_uring copy, reused for later files
 };
 DPFILEOPERATIONS_END_NAMESPACE
 #endif   // DOCOPYFILEWORKER_H
@@ -38,6 +38,8 @@
 DPFILEOPERATIONS_USE_NAMESPACE
 USING_IO_NAMESPACE
 
+static constexpr int kMaxQueuedCopyPerThread { 64 };
+
 /*!
  * \brief 为文件操作准备替换目标
  *
@@ -161,7 +163,8 @@ AbstractJobHandler::SupportAction FileOperateBaseWorker::doHandleErrorAndWait(co
         QMutexLocker locker(&mutex);
         waitCondition.wait(&mutex);
     }
-    if (isStopped())
+    // 重试或跳过前重新取得等待时归还的设备令牌
+    if (isStopped() || !ioCheckpoint())
         return AbstractJobHandler::SupportAction::kCancelAction;
 
     return currentAction;
@@ -181,8 +184,20 @@ void FileOperateBaseWorker::emitSpeedUpdatedNotify(const qint64 &writSize)
             : 0;
     info->insert(AbstractJobHandler::NotifyInfoKey::kJobtypeKey, QVariant::fromValue(jobType));
     info->insert(AbstractJobHandler::NotifyInfoKey::kJobStateKey, QVariant::fromValue(currentState));
+    // 统计未完成时总大小不准确，剩余时间未知
+    const bool statisticsRunning = isStatisticsRunning();
     info->insert(AbstractJobHandler::NotifyInfoKey::kSpeedKey, QVariant::fromValue(speed));
-    info->insert(AbstractJobHandler::NotifyInfoKey::kRemindTimeKey, QVariant::fromValue(speed == 0 ? -1 : (sourceFilesTotalSize - writSize) / speed));
+    if (workData->jobFlags.testFlag(AbstractJobHandler::JobFlag::kCopyIntegrityChecking) && workData->verifiedSize > 0) {
+        const qint64 verifySpeed = currentState == AbstractJobHandler::JobState::kRunningState
+                ? workData->verifiedSize * 1000 / elTime
+                : 0;
+        info->insert(AbstractJobHandler::NotifyInfoKey::kVerifySpeedKey, QVariant::fromValue(verifySpeed));
+    }
+    info->insert(AbstractJobHandler::NotifyInfoKey::kRemindTimeKey,
+                 QVariant::fromValue((speed == 0 || statisticsRunning) ? -1 : (sourceFilesTotalSize - writSize) / speed));
+    info->insert(AbstractJobHandler::NotifyInfoKey::kStatisticStateKey,
+                 QVariant::fromValue(statisticsRunning ? AbstractJobHandler::StatisticState::kRunningState
+                                                       : AbstractJobHandler::StatisticState::kStopState));
 
     emit stateChangedNotify(info);
     emit speedUpdatedNotify(info);
@@ -255,16 +270,39 @@ bool FileOperateBaseWorker::checkFileSize(qint64 size, const QUrl &fromUrl,
 }
 
 bool FileOperateBaseWorker::checkTotalDiskSpaceAvailable(const QUrl &fromUrl, const QUrl &toUrl, bool *skip)
+{
+    return checkRequiredDiskSpaceAvailable(sourceFilesTotalSize, fromUrl, toUrl, skip);
+}
+
+/*!
+ * \brief FileOperateBaseWorker::checkStreamDiskSpaceAvailable Deferred total disk space check
+ * for streaming statistics. The total size is unknown when the copy starts, so the check runs
+ * once when statistics finished, against the data not written yet.
+ * \param fromUrl URL of the current source file
+ * \param toUrl URL of the current target file
+ * \param skip Output parameter: whether skip
+ * \return Is space available
+ */
+bool FileOperateBaseWorker::checkStreamDiskSpaceAvailable(const QUrl &fromUrl, const QUrl &toUrl, bool *skip)
+{
+    if (!streamStatistics || !statisticsFinished || streamDiskSpaceChecked.exchange(true))
+        return true;
+
+    const qint64 remainSize = sourceFilesTotalSize - getWriteDataSize();
+    return checkRequiredDiskSpaceAvailable(remainSize, fromUrl, targetOrgUrl.isValid() ? targetOrgUrl : toUrl, skip);
+}
+
+bool FileOperateBaseWorker::checkRequiredDiskSpaceAvailable(const qint64 requiredSize, const QUrl &fromUrl, const QUrl &toUrl, bool *skip)
 {
     AbstractJobHandler::SupportAction action = AbstractJobHandler::SupportAction::kNoAction;
 
     do {
         qint64 freeBytes = DeviceUtils::deviceBytesFree(toUrl);
-        fmInfo() << "Disk space check - available:" << freeBytes << "required:" << sourceFilesTotalSize;
+        fmInfo() << "Disk space check - available:" << freeBytes << "required:" << requiredSize;
 
         action = AbstractJobHandler::SupportAction::kNoAction;
-        if (sourceFilesTotalSize >= freeBytes) {
-            fmWarning() << "Insufficient disk space - required:" << sourceFilesTotalSize << "available:" << freeBytes;
+        if (requiredSize >= freeBytes) {
+            fmWarning() << "Insufficient disk space - required:" << requiredSize << "available:" << freeBytes;
             action = doHandleErrorAndWait(fromUrl, toUrl, AbstractJobHandler::JobErrorType::kNotEnoughSpaceError);
         }
     } while (action == AbstractJobHandler::SupportAction::kRetryAction && !isStopped());
@@ -681,6 +719,9 @@ DFileInfoPointer FileOperateBaseWorker::doCheckNewFile(const DFileInfoPointer &f
 
 bool FileOperateBaseWorker::checkAndCopyFile(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo, bool *skip)
 {
+    if (!checkStreamDiskSpaceAvailable(fromInfo->uri(), toInfo->uri(), skip))
+        return false;
+
     auto fromSize = fromInfo->attribute(DFileInfo::AttributeID::kStandardSize).toLongLong();
 
     // 追踪目标文件（文件创建时立即追踪）
@@ -929,9 +970,15 @@ void FileOperateBaseWorker::initCopyWay()
 {
     if (isSourceFileLocal && isTargetFileLocal) {
         countWriteType = CountWriteSizeType::kCustomizeType;
-        workData->singleThread = (sourceFilesCount > 1 || sourceFilesTotalSize > FileOperationsUtils::bigFileSize()) && FileUtils::getCpuProcessCount() > 4
+        // 边统计边拷贝时文件数量未知，按多文件处理
+        const bool manyFiles = isStatisticsRunning() || sourceFilesCount > 1
+                || sourceFilesTotalSize > FileOperationsUtils::bigFileSize();
+        workData->singleThread = manyFiles && FileUtils::getCpuProcessCount() > 4
                 ? false
                 : true;
+        // 机械盘上多线程读写只会增加寻道
+        if (workData->ioTicket && workData->ioTicket->hasRotational())
+            workData->singleThread = true;
         if (!workData->singleThread)
             threadCount = FileUtils::getCpuProcessCount() < 4 ? 2 : 4;
     }
@@ -1080,8 +1127,28 @@ bool FileOperateBaseWorker::doCopyLocalFile(const DFileInfoPointer fromInfo, con
     if (!stateCheck())
         return false;
 
+    // 遍历源目录的速度远快于拷贝，限制线程池中排队的任务数，避免大量文件信息堆积在内存中
+    // 停止时排队的任务很快返回并唤醒这里
+    const int maxQueuedCount = threadCount * kMaxQueuedCopyPerThread;
+    {
+        QMutexLocker lk(&copyQueueMutex);
+        while (queuedLocalCopyCount >= maxQueuedCount && !isStopped())
+            copyQueueNotFull.wait(&copyQueueMutex);
+        if (isStopped())
+            return false;
+        queuedLocalCopyCount++;
+    }
+    if (!stateCheck()) {
+        QMutexLocker lk(&copyQueueMutex);
+        queuedLocalCopyCount--;
+        return false;
+    }
+
     threadPool->start([this, fromInfo, toInfo]() {
         threadCopyWorker[threadCopyFileCount % threadCount]->doFileCopy(fromInfo, toInfo);
+        QMutexLocker lk(&copyQueueMutex);
+        queuedLocalCopyCount--;
+        copyQueueNotFull.wakeOne();
     });
 
     threadCopyFileCount++;
@@ -1258,6 +1325,10 @@ QVariant FileOperateBaseWorker::doActionMerge(const DFileInfoPointer &fromInfo,
 bool FileOperateBaseWorker::doCopyFile(const DFileInfoPointer &fromInfo, const DFileInfoPointer &toInfo, bool *skip)
 {
     bool result = false;
+    // 在文件边界让出机械盘
+    if (!ioCheckpoint())
+        return result;
+
     DFileInfoPointer newTargetInfo = doCheckFile(fromInfo, toInfo,
                                                  fromInfo->attribute(DFileInfo::AttributeID::kStandardFileName).toString(), skip);
     if (newTargetInfo.isNull())
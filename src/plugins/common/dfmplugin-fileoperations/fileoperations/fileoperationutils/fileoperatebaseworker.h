@@ -64,6 +64,7 @@ public:
                        const QUrl &toUrl, bool *skip);
     bool checkDiskSpaceAvailable(const QUrl &fromUrl, const QUrl &toUrl, bool *skip);
     bool checkTotalDiskSpaceAvailable(const QUrl &fromUrl, const QUrl &toUrl, bool *skip);
+    bool checkStreamDiskSpaceAvailable(const QUrl &fromUrl, const QUrl &toUrl, bool *skip);
     void setAllDirPermisson();
     void determineCountProcessType();
     qint64 getWriteDataSize();
@@ -115,6 +116,7 @@ private:
     bool doCopyOtherFile(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo, bool *skip);
     bool doCopyLocalByRange(const DFileInfoPointer fromInfo, const DFileInfoPointer toInfo, bool *skip);
     void setExpectedSizeForTarget(const QUrl &targetUrl, qint64 size);
+    bool checkRequiredDiskSpaceAvailable(const qint64 requiredSize, const QUrl &fromUrl, const QUrl &toUrl, bool *skip);
 
     // 延迟替换机制：批量应用所有待处理的替换
     bool applyAllPendingReplacements();
@@ -141,6 +143,11 @@ protected:
     FileCleanupManager cleanupManager;   // 管理不完整文件的清理
 
     std::atomic_int threadCopyFileCount { 0 };
+    // 已提交到线程池但未完成的拷贝数，限制队列长度，拷贝线程完成时唤醒等待的遍历线程
+    QMutex copyQueueMutex;
+    QWaitCondition copyQueueNotFull;
+    int queuedLocalCopyCount { 0 };
+    std::atomic_bool streamDiskSpaceChecked { false };   // 边统计边拷贝时，统计完成后的磁盘空间检查只做一次
     QList<DFileInfoPointer> cutAndDeleteFiles;
 
     // 延迟替换：待处理的替换上下文队列（主线程访问，无需锁）
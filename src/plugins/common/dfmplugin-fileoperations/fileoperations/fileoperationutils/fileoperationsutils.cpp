@@ -33,6 +33,10 @@ inline constexpr char kFileOperations[] { "org.deepin.dde.file-manager.operation
 inline constexpr char kFileBigSize[] { "file.operation.bigfilesize" };
 inline constexpr char kBlockEverySync[] { "file.operation.blockeverysync" };
 inline constexpr char kBroadcastPaste[] { "file.operation.broadcastpastevent" };
+inline constexpr char kStreamStatistics[] { "file.operation.streamstatistics" };
+inline constexpr char kIoDeviceScheduler[] { "file.operation.iodevicescheduler" };
+inline constexpr char kIoUringCopy[] { "file.operation.iouringcopy" };
+inline constexpr char kIntegrityVerifySampling[] { "file.operation.integrityverifysampling" };
 
 /*!
  * \brief FileOperationsUtils::statisticsFilesSize 使用c库统计文件大小
@@ -189,6 +193,41 @@ bool FileOperationsUtils::blockSync()
     return sync;
 }
 
+/*!
+ * \brief FileOperationsUtils::streamStatistics 本地拷贝是否边统计边拷贝
+ * 开启后源文件统计在后台线程进行，拷贝不再等待统计完成
+ */
+bool FileOperationsUtils::streamStatistics()
+{
+    return DConfigManager::instance()->value(kFileOperations, kStreamStatistics, true).toBool();
+}
+
+/*!
+ * \brief FileOperationsUtils::ioDeviceScheduler 文件操作是否按设备排队
+ */
+bool FileOperationsUtils::ioDeviceScheduler()
+{
+    return DConfigManager::instance()->value(kFileOperations, kIoDeviceScheduler, true).toBool();
+}
+
+/*!
+ * \brief FileOperationsUtils::ioUringCopy 网络和外接设备上的拷贝是否使用 io_uring
+ * 内核不支持时仍然使用同步读写
+ */
+bool FileOperationsUtils::ioUringCopy()
+{
+    return DConfigManager::instance()->value(kFileOperations, kIoUringCopy, true).toBool();
+}
+
+/*!
+ * \brief FileOperationsUtils::integrityVerifySampling 完整性校验时边拷贝边校验的采样间隔
+ * 0 表示拷贝完成后重新读取目标文件校验，1 表示校验每一块，N 表示每 N 块校验一块
+ */
+int FileOperationsUtils::integrityVerifySampling()
+{
+    return qMax(0, DConfigManager::instance()->value(kFileOperations, kIntegrityVerifySampling, 1).toInt());
+}
+
 QUrl FileOperationsUtils::parentUrl(const QUrl &url)
 {
     auto parent = url.adjusted(QUrl::StripTrailingSlash);
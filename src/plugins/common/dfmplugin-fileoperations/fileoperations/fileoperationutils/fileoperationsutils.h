@@ -73,6 +73,10 @@ private:
     static bool isFileOnDisk(const QUrl &url);
     static qint64 bigFileSize();
     static bool blockSync();
+    static bool streamStatistics();
+    static bool ioDeviceScheduler();
+    static bool ioUringCopy();
+    static int integrityVerifySampling();
     static QUrl parentUrl(const QUrl &url);
     static bool canBroadcastPaste();
 };
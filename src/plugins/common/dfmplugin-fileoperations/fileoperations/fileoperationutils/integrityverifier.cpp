@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "integrityverifier.h"
+
+#include <dfm-base/dfm_log_defines.h>
+
+#include <QFile>
+#include <QThread>
+
+#include <zlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+DPFILEOPERATIONS_USE_NAMESPACE
+
+namespace {
+constexpr qint64 kDirectAlignment = 4096;
+
+quint32 blockChecksum(const char *data, qint64 size)
+{
+    return static_cast<quint32>(crc32(crc32(0L, nullptr, 0), reinterpret_cast<const Bytef *>(data), static_cast<uInt>(size)));
+}
+}   // namespace
+
+IntegrityVerifier::IntegrityVerifier(const QString &targetPath, int sampling, std::atomic_int64_t *verifiedSize)
+    : targetPath(targetPath), sampling(qMax(1, sampling)), verifiedSize(verifiedSize)
+{
+}
+
+IntegrityVerifier::~IntegrityVerifier()
+{
+    {
+        QMutexLocker lk(&mutex);
+        pending.clear();
+        finishing = true;
+        changed.wakeAll();
+    }
+    if (thread) {
+        thread->wait();
+        delete thread;
+    }
+
+    if (fd >= 0)
+        close(fd);
+    free(buffer);
+}
+
+void IntegrityVerifier::addBlock(qint64 offset, const char *data, qint64 size, bool last)
+{
+    // 采样时跳过的块不计算校验值
+    const bool sampled = blockIndex++ % sampling == 0 || last;
+    if (!sampled || size <= 0)
+        return;
+
+    Block block { offset, size, blockChecksum(data, size) };
+    QMutexLocker lk(&mutex);
+    if (failed)
+        return;
+    pending.enqueue(block);
+    // 只有一块的文件在 finish 时直接校验，不创建线程
+    if (!thread && pending.size() > 1) {
+        thread = QThread::create([this] { run(); });
+        thread->start();
+    }
+    changed.wakeAll();
+}
+
+bool IntegrityVerifier::finish(qint64 *mismatchOffset, QString *errorMsg)
+{
+    {
+        QMutexLocker lk(&mutex);
+        finishing = true;
+        changed.wakeAll();
+    }
+    if (thread)
+        thread->wait();
+    else
+        run();   // 在拷贝线程中校验剩下的块
+
+    QList<Block> recheck;
+    {
+        QMutexLocker lk(&mutex);
+        recheck = suspects;
+        suspects.clear();
+    }
+
+    if (!lastError.isEmpty()) {
+        if (errorMsg)
+            *errorMsg = lastError;
+        return false;
+    }
+
+    // 读回时目标的写入可能尚未完成，写入结束后再确认一次
+    for (const Block &block : std::as_const(recheck)) {
+        quint32 checksum = 0;
+        if (!readBack(block, &checksum) || checksum != block.checksum) {
+            fmWarning() << "Integrity check failed - offset:" << block.offset << "size:" << block.size
+                        << "file:" << targetPath;
+            if (mismatchOffset)
+                *mismatchOffset = block.offset;
+            if (errorMsg)
+                *errorMsg = lastError;
+            return false;
+        }
+        if (verifiedSize)
+            *verifiedSize += block.size;
+    }
+    return true;
+}
+
+void IntegrityVerifier::run()
+{
+    Q_FOREVER {
+        Block block;
+        {
+            QMutexLocker lk(&mutex);
+            while (pending.isEmpty() && !finishing)
+                changed.wait(&mutex);
+            if (pending.isEmpty())
+                return;
+            block = pending.dequeue();
+        }
+
+        quint32 checksum = 0;
+        if (!readBack(block, &checksum)) {
+            // 读回失败是目标设备的错误，停止校验
+            QMutexLocker lk(&mutex);
+            pending.clear();
+            failed = true;
+            return;
+        }
+
+        if (checksum != block.checksum) {
+            QMutexLocker lk(&mutex);
+            suspects.append(block);
+        } else if (verifiedSize) {
+            *verifiedSize += block.size;
+        }
+    }
+}
+
+bool IntegrityVerifier::openTarget()
+{
+    if (fd >= 0)
+        return true;
+
+    const QByteArray &path = QFile::encodeName(targetPath);
+    // O_DIRECT 读回前内核会先把该范围的脏页写入设备，读到的是设备上的数据
+    fd = open(path.constData(), O_RDONLY | O_DIRECT);
+    directIO = fd >= 0;
+    if (!directIO) {
+        fmDebug() << "O_DIRECT read back not supported, read through page cache - file:" << targetPath;
+        fd = open(path.constData(), O_RDONLY);
+    }
+    if (fd < 0) {
+        lastError = QString::fromLocal8Bit(strerror(errno));
+        fmWarning() << "Open target for integrity check failed - file:" << targetPath << "error:" << lastError;
+        return false;
+    }
+    return true;
+}
+
+bool IntegrityVerifier::readBack(const Block &block, quint32 *checksum)
+{
+    if (!openTarget())
+        return false;
+
+    // O_DIRECT 要求偏移和长度对齐，读对齐后的范围再取出块
+    const qint64 alignment = directIO ? kDirectAlignment : 1;
+    const qint64 start = block.offset / alignment * alignment;
+    const qint64 end = (block.offset + block.size + alignment - 1) / alignment * alignment;
+    const qint64 length = end - start;
+    if (length > bufferSize) {
+        free(buffer);
+        buffer = nullptr;
+        bufferSize = 0;
+        void *memory = nullptr;
+        if (posix_memalign(&memory, kDirectAlignment, static_cast<size_t>(length)) != 0) {
+            lastError = QString::fromLocal8Bit(strerror(ENOMEM));
+            return false;
+        }
+        buffer = static_cast<char *>(memory);
+        bufferSize = length;
+    }
+
+    qint64 done = 0;
+    while (done < length) {
+        const ssize_t size = pread(fd, buffer + done, static_cast<size_t>(length - done), start + done);
+        if (size < 0 && errno == EINTR)
+            continue;
+        if (size < 0 && errno == EINVAL && directIO) {
+            // 个别文件系统打开时接受 O_DIRECT，读时才拒绝
+            close(fd);
+            fd = open(QFile::encodeName(targetPath).constData(), O_RDONLY);
+            directIO = false;
+            if (fd < 0)
+                break;
+            continue;
+        }
+        if (size < 0)
+            lastError = QString::fromLocal8Bit(strerror(errno));
+        if (size <= 0)
+            break;
+        done += size;
+    }
+
+    const qint64 skipped = block.offset - start;
+    if (done < skipped + block.size) {
+        // 读到的比写入的少，按不一致处理
+        if (fd < 0)
+            lastError = QString::fromLocal8Bit(strerror(errno));
+        *checksum = ~block.checksum;
+        return fd >= 0;
+    }
+
+    *checksum = blockChecksum(buffer + skipped, block.size);
+    return true;
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef INTEGRITYVERIFIER_H
+#define INTEGRITYVERIFIER_H
+
+#include "dfmplugin_fileoperations_global.h"
+
+#include <QString>
+#include <QQueue>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <atomic>
+
+class QThread;
+
+DPFILEOPERATIONS_BEGIN_NAMESPACE
+
+/*!
+ * \brief 拷贝时在后台线程校验已写入的块
+ *
+ * 拷贝线程在写完每块后调用 addBlock()，源数据的 crc32 在读路径上计算；
+ * 校验线程以 O_DIRECT 读回目标文件的同一范围并比较，拷贝结束时调用 finish()
+ * 等待剩余的块，不再重新读取整个目标文件。
+ * 校验线程在收到第二块时才创建，空文件和只有一块的文件在 finish() 中直接校验。
+ */
+class IntegrityVerifier
+{
+    Q_DISABLE_COPY(IntegrityVerifier)
+
+public:
+    // sampling 为 1 时校验每一块，为 N 时校验每 N 块中的一块和最后一块
+    IntegrityVerifier(const QString &targetPath, int sampling, std::atomic_int64_t *verifiedSize);
+    ~IntegrityVerifier();
+
+    void addBlock(qint64 offset, const char *data, qint64 size, bool last = false);
+    // 等待所有块校验完成，不一致时返回 false，mismatchOffset 为第一个不一致块的偏移
+    bool finish(qint64 *mismatchOffset = nullptr, QString *errorMsg = nullptr);
+
+private:
+    struct Block
+    {
+        qint64 offset { 0 };
+        qint64 size { 0 };
+        quint32 checksum { 0 };
+    };
+
+    void run();
+    bool openTarget();
+    // 读回目标文件的块，读取失败时返回 false
+    bool readBack(const Block &block, quint32 *checksum);
+
+    QString targetPath;
+    int sampling { 1 };
+    std::atomic_int64_t *verifiedSize { nullptr };
+    qint64 blockIndex { 0 };
+
+    QThread *thread { nullptr };
+    QMutex mutex;
+    QWaitCondition changed;
+    QQueue<Block> pending;
+    QList<Block> suspects;   // 不一致的块，结束时写入已完成再读一次
+    bool finishing { false };
+    bool failed { false };   // 读回目标失败，不再接收新的块
+    QString lastError;
+
+    int fd { -1 };
+    bool directIO { false };
+    char *buffer { nullptr };
+    qint64 bufferSize { 0 };
+};
+
+DPFILEOPERATIONS_END_NAMESPACE
+
+#endif   // INTEGRITYVERIFIER_H
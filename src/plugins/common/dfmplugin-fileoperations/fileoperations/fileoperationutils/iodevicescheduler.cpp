@@ -0,0 +1,310 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "iodevicescheduler.h"
+
+#include <dfm-base/dfm_log_defines.h>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QSet>
+#include <QDebug>
+
+#include <sys/vfs.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+
+DPFILEOPERATIONS_USE_NAMESPACE
+
+namespace {
+constexpr int kWaitInterval = 500;   // ms，排队时检查取消的间隔
+constexpr qint64 kRotationalSliceMs = 3000;   // 机械盘上连续读写的时间片
+
+// statfs f_type
+constexpr long kNfsMagic = 0x6969;
+constexpr long kSmbMagic = 0x517B;
+constexpr long kCifsMagic = 0xFF534D42;
+constexpr long kSmb2Magic = 0xFE534D42;
+constexpr long kFuseMagic = 0x65735546;
+
+QByteArray readSysfs(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+    return file.readAll().trimmed();
+}
+}   // namespace
+
+IoTicket::~IoTicket()
+{
+    IoDeviceScheduler::instance()->release(this);
+}
+
+IoDeviceScheduler *IoDeviceScheduler::instance()
+{
+    static IoDeviceScheduler ins;
+    return &ins;
+}
+
+IoDeviceScheduler::Device IoDeviceScheduler::classify(const QString &path)
+{
+    Device device;
+
+    // 目标可能尚未创建，向上找到存在的目录
+    QString existing = path;
+    struct statfs fsBuf;
+    while (statfs(existing.toLocal8Bit().constData(), &fsBuf) != 0) {
+        const QString &parent = QFileInfo(existing).path();
+        if (parent == existing)
+            return device;
+        existing = parent;
+    }
+
+    struct stat statBuf;
+    if (stat(existing.toLocal8Bit().constData(), &statBuf) != 0)
+        return device;
+    device.id = statBuf.st_dev;
+
+    const auto type = static_cast<long>(fsBuf.f_type);
+    if (type == kNfsMagic || type == kSmbMagic || type == kCifsMagic || type == kSmb2Magic) {
+        device.kind = DeviceKind::kNetwork;
+        device.name = QFileInfo(existing).fileName();
+        return device;
+    }
+    if (type == kFuseMagic) {
+        device.kind = DeviceKind::kFuse;
+        device.name = "fuse";
+        return device;
+    }
+
+    // tmpfs、btrfs 子卷等没有对应块设备的文件系统不调度
+    if (major(statBuf.st_dev) == 0)
+        return device;
+
+    QString sysPath = QFileInfo(QString("/sys/dev/block/%1:%2").arg(major(statBuf.st_dev)).arg(minor(statBuf.st_dev))).canonicalFilePath();
+    if (sysPath.isEmpty())
+        return device;
+    // 分区的令牌属于整块磁盘
+    if (QFile::exists(sysPath + "/partition"))
+        sysPath = QFileInfo(sysPath).path();
+
+    const QList<QByteArray> &devNumber = readSysfs(sysPath + "/dev").split(':');
+    if (devNumber.size() == 2)
+        device.id = makedev(devNumber.first().toUInt(), devNumber.last().toUInt());
+    device.name = QFileInfo(sysPath).fileName();
+    device.kind = readSysfs(sysPath + "/queue/rotational") == "1" ? DeviceKind::kRotational : DeviceKind::kSolidState;
+    return device;
+}
+
+int IoDeviceScheduler::tokenCount(DeviceKind kind)
+{
+    switch (kind) {
+    case DeviceKind::kRotational:
+        return 1;
+    case DeviceKind::kSolidState:
+        return 4;
+    case DeviceKind::kNetwork:
+    case DeviceKind::kFuse:
+        return 2;
+    case DeviceKind::kUnknown:
+        break;
+    }
+    return 0;
+}
+
+IoTicketPointer IoDeviceScheduler::createTicket(const QList<QUrl> &urls)
+{
+    IoTicketPointer ticket(new IoTicket);
+
+    QList<Device> devices;
+    QSet<QString> checkedDirs;
+    for (const QUrl &url : urls) {
+        if (!url.isLocalFile())
+            continue;
+        // 同一目录下的源只需识别一次
+        const QString &dir = QFileInfo(url.path()).path();
+        if (checkedDirs.contains(dir))
+            continue;
+        checkedDirs.insert(dir);
+
+        const Device &device = classify(url.path());
+        if (device.kind == DeviceKind::kUnknown || ticket->devices.contains(device.id))
+            continue;
+        ticket->devices.append(device.id);
+        ticket->rotational = ticket->rotational || device.kind == DeviceKind::kRotational;
+        devices.append(device);
+    }
+
+    QMutexLocker lk(&mutex);
+    for (const Device &device : devices) {
+        if (states.contains(device.id))
+            continue;
+        DeviceState state;
+        state.device = device;
+        state.tokens = tokenCount(device.kind);
+        states.insert(device.id, state);
+        fmInfo() << "IoDeviceScheduler: device" << device.name << "kind:" << static_cast<int>(device.kind)
+                 << "tokens:" << state.tokens;
+    }
+    return ticket;
+}
+
+bool IoDeviceScheduler::acquire(const IoTicketPointer &ticket, const CancelledCallback &cancelled, const WaitingCallback &waiting)
+{
+    if (!ticket || ticket->devices.isEmpty())
+        return true;
+
+    QMutexLocker lk(&mutex);
+    int lastAhead = -1;
+    while (!ticket->granted) {
+        // 已由同一任务的其他线程排队时，一起等待
+        if (!ticket->queued)
+            enqueue(ticket.data());
+        if (canGrant(ticket.data()))
+            break;
+
+        QString deviceName;
+        const int ahead = aheadOf(ticket.data(), &deviceName);
+        if (waiting && ahead != lastAhead) {
+            lastAhead = ahead;
+            lk.unlock();
+            waiting(ahead, deviceName);
+            lk.relock();
+        }
+
+        changed.wait(&mutex, kWaitInterval);
+
+        if (!ticket->granted && cancelled && cancelled()) {
+            if (ticket->queued)
+                dequeue(ticket.data());
+            changed.wakeAll();
+            return false;
+        }
+    }
+
+    if (!ticket->granted) {
+        dequeue(ticket.data());
+        for (quint64 id : std::as_const(ticket->devices))
+            states[id].active++;
+        ticket->granted = true;
+        ticket->slice.start();
+        // 令牌数大于 1 的设备上，后面的任务可能也能开始
+        changed.wakeAll();
+    }
+
+    if (lastAhead >= 0 && waiting) {
+        lk.unlock();
+        waiting(-1, QString());
+    }
+    return true;
+}
+
+bool IoDeviceScheduler::checkpoint(const IoTicketPointer &ticket, const CancelledCallback &cancelled, const WaitingCallback &waiting)
+{
+    if (!ticket || ticket->devices.isEmpty())
+        return true;
+
+    {
+        QMutexLocker lk(&mutex);
+        if (ticket->granted) {
+            if (!ticket->rotational || ticket->slice.elapsed() < kRotationalSliceMs)
+                return true;
+            if (!hasWaiters(ticket.data())) {
+                ticket->slice.restart();
+                return true;
+            }
+
+            fmInfo() << "IoDeviceScheduler: yield the device to the queued jobs";
+            revoke(ticket.data());
+        }
+    }
+
+    // 让出或挂起后排到队尾，轮到后继续
+    return acquire(ticket, cancelled, waiting);
+}
+
+void IoDeviceScheduler::suspend(const IoTicketPointer &ticket)
+{
+    if (!ticket || ticket->devices.isEmpty())
+        return;
+
+    QMutexLocker lk(&mutex);
+    if (ticket->granted)
+        revoke(ticket.data());
+}
+
+void IoDeviceScheduler::release(IoTicket *ticket)
+{
+    if (!ticket || ticket->devices.isEmpty())
+        return;
+
+    QMutexLocker lk(&mutex);
+    if (ticket->granted)
+        revoke(ticket);
+    else if (ticket->queued)
+        dequeue(ticket);
+    changed.wakeAll();
+}
+
+bool IoDeviceScheduler::canGrant(const IoTicket *ticket) const
+{
+    // 需要所有设备同时可用，且在每个设备上都没有更早排队的任务，
+    // 不持有部分令牌等待，避免多设备任务之间互相等待
+    for (quint64 id : ticket->devices) {
+        const DeviceState &state = *states.constFind(id);
+        if (state.active >= state.tokens)
+            return false;
+        if (!state.waiting.isEmpty() && state.waiting.first() != ticket)
+            return false;
+    }
+    return true;
+}
+
+int IoDeviceScheduler::aheadOf(const IoTicket *ticket, QString *deviceName) const
+{
+    int ahead = 0;
+    for (quint64 id : ticket->devices) {
+        const DeviceState &state = *states.constFind(id);
+        const int count = state.active + static_cast<int>(state.waiting.indexOf(const_cast<IoTicket *>(ticket)));
+        if (count >= ahead) {
+            ahead = count;
+            *deviceName = state.device.name;
+        }
+    }
+    return ahead;
+}
+
+bool IoDeviceScheduler::hasWaiters(const IoTicket *ticket) const
+{
+    for (quint64 id : ticket->devices) {
+        const DeviceState &state = *states.constFind(id);
+        if (state.device.kind == DeviceKind::kRotational && !state.waiting.isEmpty())
+            return true;
+    }
+    return false;
+}
+
+void IoDeviceScheduler::enqueue(IoTicket *ticket)
+{
+    ticket->sequence = nextSequence++;
+    ticket->queued = true;
+    for (quint64 id : std::as_const(ticket->devices))
+        states[id].waiting.append(ticket);
+}
+
+void IoDeviceScheduler::dequeue(IoTicket *ticket)
+{
+    ticket->queued = false;
+    for (quint64 id : std::as_const(ticket->devices))
+        states[id].waiting.removeOne(ticket);
+}
+
+void IoDeviceScheduler::revoke(IoTicket *ticket)
+{
+    for (quint64 id : std::as_const(ticket->devices))
+        states[id].active--;
+    ticket->granted = false;
+    changed.wakeAll();
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef IODEVICESCHEDULER_H
+#define IODEVICESCHEDULER_H
+
+#include "dfmplugin_fileoperations_global.h"
+
+#include <QUrl>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+#include <QHash>
+
+#include <functional>
+
+DPFILEOPERATIONS_BEGIN_NAMESPACE
+
+class IoDeviceScheduler;
+
+/*!
+ * \brief 文件操作任务在 IoDeviceScheduler 中的排队凭证
+ *
+ * 一个任务的源和目标所在的设备都需要取得令牌才能开始读写，
+ * 任务暂停或等待用户处理时归还令牌，继续时重新排队，凭证析构时归还所有令牌。
+ */
+class IoTicket
+{
+    friend class IoDeviceScheduler;
+
+public:
+    ~IoTicket();
+
+    bool isGranted() const { return granted; }
+    bool hasRotational() const { return rotational; }
+    bool isEmpty() const { return devices.isEmpty(); }
+
+private:
+    IoTicket() = default;
+
+    QList<quint64> devices;
+    quint64 sequence { 0 };
+    bool granted { false };
+    bool queued { false };   // 任务的多个线程可能同时重新排队，只排一次
+    bool rotational { false };
+    QElapsedTimer slice;   // 在机械盘上连续读写的时长
+};
+using IoTicketPointer = QSharedPointer<IoTicket>;
+
+/*!
+ * \brief 按设备调度文件操作任务的读写
+ *
+ * 设备按 statfs 和 sysfs 分为机械盘、固态盘、网络和 FUSE，每个设备有固定数量
+ * 的令牌：同一机械盘上的任务依次执行，并在大块读写后让给排队的任务，
+ * 不同设备上的任务互不影响。
+ */
+class IoDeviceScheduler
+{
+public:
+    enum class DeviceKind : uint8_t {
+        kUnknown,   // 虚拟文件系统等，不调度
+        kRotational,
+        kSolidState,
+        kNetwork,
+        kFuse
+    };
+
+    struct Device
+    {
+        quint64 id { 0 };
+        DeviceKind kind { DeviceKind::kUnknown };
+        QString name;
+    };
+
+    // 排队中回调，ahead 为前面的任务数
+    using WaitingCallback = std::function<void(int ahead, const QString &deviceName)>;
+    using CancelledCallback = std::function<bool()>;
+
+    static IoDeviceScheduler *instance();
+    static Device classify(const QString &path);
+    static int tokenCount(DeviceKind kind);
+
+    IoTicketPointer createTicket(const QList<QUrl> &urls);
+    // 阻塞直到取得所有设备的令牌，取消时返回 false，可由任务的多个线程同时调用
+    bool acquire(const IoTicketPointer &ticket, const CancelledCallback &cancelled, const WaitingCallback &waiting);
+    // 在文件边界调用：挂起后重新排队；机械盘上的时间片用完且有任务排队时，让出令牌并重新排队
+    bool checkpoint(const IoTicketPointer &ticket, const CancelledCallback &cancelled, const WaitingCallback &waiting);
+    // 暂停或等待用户处理前调用，归还令牌但保留凭证，不阻塞
+    void suspend(const IoTicketPointer &ticket);
+    void release(IoTicket *ticket);
+
+private:
+    struct DeviceState
+    {
+        Device device;
+        int tokens { 1 };
+        int active { 0 };
+        QList<IoTicket *> waiting;   // 按 sequence 排序
+    };
+
+    IoDeviceScheduler() = default;
+    bool canGrant(const IoTicket *ticket) const;
+    int aheadOf(const IoTicket *ticket, QString *deviceName) const;
+    bool hasWaiters(const IoTicket *ticket) const;
+    void enqueue(IoTicket *ticket);
+    void dequeue(IoTicket *ticket);
+    void revoke(IoTicket *ticket);
+
+    mutable QMutex mutex;
+    QWaitCondition changed;
+    QHash<quint64, DeviceState> states;
+    quint64 nextSequence { 0 };
+};
+
+DPFILEOPERATIONS_END_NAMESPACE
+
+#endif   // IODEVICESCHEDULER_H
@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "uringcopyengine.h"
+
+#include <dfm-base/dfm_log_defines.h>
+
+#include <QMap>
+
+#include <algorithm>
+
+#include <zlib.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef DFM_HAVE_LIBURING
+#    include <liburing.h>
+#    include <sys/uio.h>
+#    include <unistd.h>
+#endif
+
+DPFILEOPERATIONS_USE_NAMESPACE
+
+namespace {
+constexpr int kQueueDepth = 8;   // 每个文件同时进行的块数
+constexpr qint64 kBlockSize = 1024 * 1024;
+constexpr size_t kBufferAlignment = 4096;
+// 提交时连续返回 EAGAIN/EBUSY 的次数上限，超过后按读错误处理
+constexpr int kMaxBusyRetries = 1000;
+constexpr int kBusyRetryInterval = 1000;   // us
+}   // namespace
+
+#ifdef DFM_HAVE_LIBURING
+
+bool UringCopyEngine::isSupported()
+{
+    // 内核版本或 io_uring_disabled 都可能导致不可用，只探测一次
+    static const bool supported = [] {
+        struct io_uring probeRing;
+        if (io_uring_queue_init(2, &probeRing, 0) < 0) {
+            fmInfo() << "io_uring is not available, copy with read and write";
+            return false;
+        }
+        bool ok = false;
+        if (struct io_uring_probe *probe = io_uring_get_probe_ring(&probeRing)) {
+            ok = io_uring_opcode_supported(probe, IORING_OP_READ) && io_uring_opcode_supported(probe, IORING_OP_WRITE);
+            io_uring_free_probe(probe);
+        }
+        io_uring_queue_exit(&probeRing);
+        return ok;
+    }();
+    return supported;
+}
+
+UringCopyEngine::UringCopyEngine()
+{
+    if (!isSupported())
+        return;
+
+    void *memory = nullptr;
+    if (posix_memalign(&memory, kBufferAlignment, static_cast<size_t>(kQueueDepth * kBlockSize)) != 0)
+        return;
+    buffers = static_cast<char *>(memory);
+
+    ring = new io_uring;
+    if (io_uring_queue_init(kQueueDepth, ring, 0) < 0) {
+        delete ring;
+        ring = nullptr;
+        return;
+    }
+
+    blocks.resize(kQueueDepth);
+    struct iovec iovecs[kQueueDepth];
+    for (int i = 0; i < kQueueDepth; ++i) {
+        blocks[i].index = i;
+        iovecs[i].iov_base = buffers + i * kBlockSize;
+        iovecs[i].iov_len = static_cast<size_t>(kBlockSize);
+    }
+    // 注册失败（如 RLIMIT_MEMLOCK 过小）时用普通缓冲区
+    fixedBuffers = io_uring_register_buffers(ring, iovecs, kQueueDepth) == 0;
+    if (!fixedBuffers)
+        fmDebug() << "io_uring register buffers failed, use unregistered buffers";
+}
+
+UringCopyEngine::~UringCopyEngine()
+{
+    if (ring) {
+        if (fixedBuffers)
+            io_uring_unregister_buffers(ring);
+        io_uring_queue_exit(ring);
+        delete ring;
+    }
+    free(buffers);
+}
+
+bool UringCopyEngine::isValid() const
+{
+    return ring != nullptr && !broken;
+}
+
+void UringCopyEngine::submit(Block *block)
+{
+    struct io_uring_sqe *sqe = io_uring_get_sqe(ring);
+    char *buffer = buffers + block->index * kBlockSize + block->done;
+    const auto length = static_cast<unsigned>(block->length - block->done);
+    const auto offset = static_cast<__u64>(block->offset + block->done);
+
+    if (block->writing) {
+        if (fixedBuffers)
+            io_uring_prep_write_fixed(sqe, dstFd, buffer, length, offset, block->index);
+        else
+            io_uring_prep_write(sqe, dstFd, buffer, length, offset);
+    } else {
+        if (fixedBuffers)
+            io_uring_prep_read_fixed(sqe, srcFd, buffer, length, offset, block->index);
+        else
+            io_uring_prep_read(sqe, srcFd, buffer, length, offset);
+    }
+    io_uring_sqe_set_data(sqe, block);
+}
+
+UringCopyEngine::Result UringCopyEngine::copy(int srcFd, int dstFd, qint64 size, Progress *progress, bool checksum,
+                                              const InterruptedCallback &interrupted, const WrittenCallback &written, int *error)
+{
+    this->srcFd = srcFd;
+    this->dstFd = dstFd;
+    if (progress->copied == 0)
+        progress->checksum = adler32(0L, nullptr, 0);
+
+    // 写完的块可能乱序，按偏移接到断点上
+    QMap<qint64, Block> finished;
+    qint64 nextOffset = progress->copied;
+    int inFlight = 0;
+    int busyRetries = 0;
+    bool stopping = false;
+    Result result = Result::kFinished;
+    Q_ASSERT(!broken);
+
+    Q_FOREVER {
+        while (!stopping && inFlight < kQueueDepth && nextOffset < size) {
+            auto it = std::find_if(blocks.begin(), blocks.end(), [](const Block &block) { return !block.busy; });
+            it->busy = true;
+            it->writing = false;
+            it->offset = nextOffset;
+            it->length = qMin(kBlockSize, size - nextOffset);
+            it->done = 0;
+            nextOffset += it->length;
+            submit(&*it);
+            ++inFlight;
+        }
+        if (inFlight == 0)
+            break;
+
+        // 提交失败后不再提交，只等内核已接收的请求完成
+        struct io_uring_cqe *waited = nullptr;
+        int ret = broken ? io_uring_wait_cqe(ring, &waited) : io_uring_submit_and_wait(ring, 1);
+        if (broken) {
+            // 等待的错误只是中断，下一轮继续等
+        } else if ((ret == -EAGAIN || ret == -EBUSY) && busyRetries < kMaxBusyRetries) {
+            // 内核暂时没有资源或完成队列已满，收割完成的请求后重新提交
+            ++busyRetries;
+            if (inFlight > static_cast<int>(io_uring_sq_ready(ring)))
+                io_uring_wait_cqe(ring, &waited);
+            else
+                usleep(kBusyRetryInterval);   // 没有已提交的请求可等
+        } else if (ret < 0 && ret != -EINTR) {
+            // 未被内核接收的请求永远不会完成，不再计入；它们留在提交队列中，实例不再使用
+            fmWarning() << "io_uring submit failed:" << strerror(-ret);
+            if (result == Result::kFinished) {
+                result = Result::kReadError;
+                *error = -ret;
+            }
+            inFlight -= static_cast<int>(io_uring_sq_ready(ring));
+            broken = true;
+            stopping = true;
+        } else if (ret >= 0) {
+            busyRetries = 0;
+        }
+
+        struct io_uring_cqe *cqe = nullptr;
+        unsigned head = 0;
+        unsigned count = 0;
+        io_uring_for_each_cqe(ring, head, cqe)
+        {
+            ++count;
+            auto block = static_cast<Block *>(io_uring_cqe_get_data(cqe));
+            const int res = cqe->res;
+
+            if (stopping) {
+                block->busy = false;
+                --inFlight;
+                continue;
+            }
+            if (res == -EINTR || res == -EAGAIN) {
+                submit(block);
+                continue;
+            }
+            if (res < 0 || (res == 0 && !block->writing)) {
+                // 读到 0 说明源文件在拷贝时被截断
+                *error = res < 0 ? -res : EIO;
+                result = block->writing ? Result::kWriteError : Result::kReadError;
+                stopping = true;
+                block->busy = false;
+                --inFlight;
+                continue;
+            }
+
+            block->done += res;
+            if (block->done < block->length) {
+                submit(block);
+                continue;
+            }
+
+            if (!block->writing) {
+                if (checksum)
+                    block->checksum = adler32(0L, reinterpret_cast<Bytef *>(buffers + block->index * kBlockSize),
+                                              static_cast<uInt>(block->length));
+                block->writing = true;
+                block->done = 0;
+                submit(block);
+                continue;
+            }
+
+            finished.insert(block->offset, *block);
+            block->busy = false;
+            --inFlight;
+            while (!finished.isEmpty() && finished.firstKey() == progress->copied) {
+                const Block done = finished.take(progress->copied);
+                if (checksum)
+                    progress->checksum = adler32_combine(progress->checksum, done.checksum, done.length);
+                progress->copied += done.length;
+                if (written)
+                    written(done.length);
+            }
+        }
+        io_uring_cq_advance(ring, count);
+
+        if (!stopping && interrupted && interrupted()) {
+            result = Result::kInterrupted;
+            stopping = true;
+        }
+    }
+
+    // 断点之后已写的块在继续时重写
+    return result;
+}
+
+#else
+
+bool UringCopyEngine::isSupported()
+{
+    return false;
+}
+
+UringCopyEngine::UringCopyEngine()
+{
+}
+
+UringCopyEngine::~UringCopyEngine()
+{
+}
+
+bool UringCopyEngine::isValid() const
+{
+    return false;
+}
+
+void UringCopyEngine::submit(Block *)
+{
+}
+
+UringCopyEngine::Result UringCopyEngine::copy(int, int, qint64, Progress *, bool,
+                                              const InterruptedCallback &, const WrittenCallback &, int *error)
+{
+    *error = ENOSYS;
+    return Result::kReadError;
+}
+
+#endif
+
+qint64 UringCopyEngine::blockSize() const
+{
+    return kBlockSize;
+}
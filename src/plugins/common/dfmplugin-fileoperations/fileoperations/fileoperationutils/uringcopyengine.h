@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef URINGCOPYENGINE_H
+#define URINGCOPYENGINE_H
+
+#include "dfmplugin_fileoperations_global.h"
+
+#include <QVector>
+
+#include <functional>
+
+struct io_uring;
+
+DPFILEOPERATIONS_BEGIN_NAMESPACE
+
+/*!
+ * \brief 基于 io_uring 的单文件拷贝
+ *
+ * 同一文件的多个块同时读写，读完一块立即提交写，网络和 USB 等延迟高的目标
+ * 不再受每次读写往返时间的限制。缓冲区在构造时注册，同一个实例可以依次拷贝多个文件。
+ * 未编译 liburing、内核不支持或提交失败后 isValid() 返回 false，由调用者回退到同步读写。
+ */
+class UringCopyEngine
+{
+    Q_DISABLE_COPY(UringCopyEngine)
+
+public:
+    enum class Result : uint8_t {
+        kFinished,
+        kInterrupted,   // interrupted() 返回 true，已排空正在进行的读写
+        kReadError,
+        kWriteError,
+    };
+
+    // 断点：[0, copied) 已写入目标，checksum 为这部分源数据的 adler32
+    struct Progress
+    {
+        qint64 copied { 0 };
+        ulong checksum { 0 };
+    };
+
+    using InterruptedCallback = std::function<bool()>;
+    using WrittenCallback = std::function<void(qint64 size)>;
+
+    static bool isSupported();
+
+    UringCopyEngine();
+    ~UringCopyEngine();
+
+    bool isValid() const;
+    qint64 blockSize() const;
+
+    // 从 progress->copied 处继续拷贝，出错时 error 为 errno
+    Result copy(int srcFd, int dstFd, qint64 size, Progress *progress, bool checksum,
+                const InterruptedCallback &interrupted, const WrittenCallback &written, int *error);
+
+private:
+    // 一个缓冲区上正在进行的块：先读满，再写完
+    struct Block
+    {
+        int index { 0 };
+        qint64 offset { 0 };
+        qint64 length { 0 };
+        qint64 done { 0 };
+        bool busy { false };
+        bool writing { false };
+        ulong checksum { 0 };
+    };
+    void submit(Block *block);
+
+    io_uring *ring { nullptr };
+    char *buffers { nullptr };
+    bool fixedBuffers { false };
+    bool broken { false };   // 提交失败后队列中留有未提交的请求
+    QVector<Block> blocks;
+    int srcFd { -1 };
+    int dstFd { -1 };
+};
+
+DPFILEOPERATIONS_END_NAMESPACE
+
+#endif   // URINGCOPYENGINE_H
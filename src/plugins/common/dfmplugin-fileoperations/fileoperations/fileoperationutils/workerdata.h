@@ -5,6 +5,7 @@
 #ifndef WORKERDATA_H
 #define WORKERDATA_H
 #include "dfmplugin_fileoperations_global.h"
+#include "iodevicescheduler.h"
 #include <dfm-base/interfaces/abstractjobhandler.h>
 #include <dfm-base/interfaces/fileinfo.h>
 #include <dfm-base/utils/threadcontainer.h>
@@ -60,11 +61,13 @@ public:
     std::atomic_bool isSourceFileLocal { false };   // source file on local device
     std::atomic_bool isTargetFileLocal { false };   // target file on local device
     std::atomic_int64_t currentWriteSize { 0 };
+    std::atomic_int64_t verifiedSize { 0 };   // bytes read back and verified while copying
     QAtomicInteger<qint64> zeroOrlinkOrDirWriteSize { 0 };   // The copy size is 0. The write statistics size of the linked file and directory
     QAtomicInteger<qint64> blockRenameWriteSize { 0 };   // The copy size is 0. The write statistics size of the linked file and directory
     QAtomicInteger<qint64> skipWriteSize { 0 };   // 跳过的文件大
     QAtomicInteger<qint64> completeFileCount { 0 };   // copy complete file count
     std::atomic_bool singleThread { true };
+    IoTicketPointer ioTicket { nullptr };   // tokens of the devices this job reads and writes, shared by the copy threads
     DThreadMap<QUrl, qint64> everyFileWriteSize;
     DThreadList<QSharedPointer<DPFILEOPERATIONS_NAMESPACE::WorkerData::BlockFileCopyInfo>> blockCopyInfoQueue;
 };
@@ -6,6 +6,7 @@
 #include <dfm-base/base/schemefactory.h>
 
 #include <QDir>
+#include <QSet>
 
 using namespace dfmplugin_menu;
 DFMBASE_USE_NAMESPACE
@@ -213,7 +214,12 @@ QList<DCustomActionEntry> DCustomActionBuilder::matchActions(const QList<QUrl> &
      */
 
     // 具体配置过滤
+    // 过滤结果只取决于协议、类型、后缀和是否目录，同类文件只需过滤一次
+    QSet<QString> checkedKinds;
     for (auto &singleUrl : selects) {
+        if (oriActions.isEmpty())
+            break;
+
         // 协议、后缀
         QString errString;
         const FileInfoPointer &fileInfo = DFMBASE_NAMESPACE::InfoFactory::create<FileInfo>(singleUrl, Global::CreateFileInfoType::kCreateFileInfoAuto, &errString);
@@ -222,6 +228,12 @@ QList<DCustomActionEntry> DCustomActionBuilder::matchActions(const QList<QUrl> &
             continue;
         }
 
+        const bool isDir = fileInfo->isAttributes(OptInfoType::kIsDir);
+        const QString kind = QString("%1\n%2\n%3\n%4").arg(singleUrl.scheme(), fileInfo->fileMimeType().name(), isDir ? QString() : fileInfo->nameOf(NameInfoType::kCompleteSuffix)).arg(isDir);
+        if (checkedKinds.contains(kind))
+            continue;
+        checkedKinds.insert(kind);
+
         /*
          * 选中文件类型过滤：
          * fileMimeTypes:包括所有父类型的全量类型集合
@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "oemactionmatcher.h"
+
+#include <dfm-base/utils/protocolutils.h>
+
+#include <QSet>
+
+using namespace dfmplugin_menu;
+DFMBASE_USE_NAMESPACE
+
+// keep in sync with the keys read by OemMenu::loadDesktopFile
+static const char *const kMimeType = "MimeType";
+static const char *const kMimeTypeExcludeKey = "X-DDE-FileManager-ExcludeMimeTypes";
+static const char *const kMimeTypeExcludeAliasKey = "X-DFM-ExcludeMimeTypes";
+static const char *const kMenuHiddenKey = "X-DDE-FileManager-NotShowIn";
+static const char *const kMenuHiddenAliasKey = "X-DFM-NotShowIn";
+static const char *const kSupportSchemesKey = "X-DDE-FileManager-SupportSchemes";
+static const char *const kSupportSchemesAliasKey = "X-DFM-SupportSchemes";
+static const char *const kSupportSuffixKey = "X-DDE-FileManager-SupportSuffix";
+static const char *const kSupportSuffixAliasKey = "X-DFM-SupportSuffix";
+static const char *const kDesktop = "Desktop";
+static const char *const kFilemanager = "Filemanager";
+static const char *const kOctetStream = "application/octet-stream";
+
+static QStringList propertyValues(const QAction *action, const char *key, const char *aliasKey = nullptr)
+{
+    QStringList values = action->property(key).toStringList();
+    if (aliasKey)
+        values << action->property(aliasKey).toStringList();
+    values.removeAll({});
+    return values;
+}
+
+static bool hasProperty(const QAction *action, const char *key, const char *aliasKey = nullptr)
+{
+    return action->property(key).isValid() || (aliasKey && action->property(aliasKey).isValid());
+}
+
+QString OemActionMatcher::FileKey::id() const
+{
+    return QString("%1\n%2\n%3\n%4%5%6").arg(mimeType, suffix, scheme).arg(isDir).arg(isFtp).arg(isMtp);
+}
+
+void OemActionMatcher::clear()
+{
+    rules.clear();
+    ruleIndex.clear();
+    hasSuffixRules = false;
+    supportByMime.clear();
+    supportWildcards.clear();
+    excludeByMime.clear();
+    excludeWildcards.clear();
+    withoutMimeRule.clear();
+    mimeTypeNames.clear();
+    mimeTypeClosures.clear();
+    suffixes.clear();
+}
+
+void OemActionMatcher::compile(const QList<QAction *> &actions)
+{
+    clear();
+
+    for (QAction *action : actions) {
+        if (!action || ruleIndex.contains(action))
+            continue;
+
+        Rule rule;
+        rule.action = action;
+
+        const QStringList &notShowIn = propertyValues(action, kMenuHiddenKey, kMenuHiddenAliasKey);
+        rule.hiddenOnDesktop = notShowIn.contains(kDesktop, Qt::CaseInsensitive);
+        rule.hiddenInFileManager = notShowIn.contains(kFilemanager, Qt::CaseInsensitive);
+
+        if (hasProperty(action, kSupportSchemesKey, kSupportSchemesAliasKey)) {
+            for (const QString &scheme : propertyValues(action, kSupportSchemesKey, kSupportSchemesAliasKey))
+                rule.schemes.append(scheme.toLower());
+            // present but empty, nothing is supported
+            if (rule.schemes.isEmpty())
+                rule.schemes.append(QString());
+        }
+
+        rule.hasSuffixRule = hasProperty(action, kSupportSuffixKey, kSupportSuffixAliasKey);
+        rule.suffixes = action->property(kSupportSuffixKey).toStringList();
+        rule.suffixes << action->property(kSupportSuffixAliasKey).toStringList();
+        hasSuffixRules |= rule.hasSuffixRule;
+
+        rule.hasMimeRule = hasProperty(action, kMimeType);
+        rule.isCompress = action->text() == QObject::tr("Compress");
+
+        ruleIndex.insert(action, rules.size());
+        rules.append(rule);
+    }
+
+    withoutMimeRule.resize(rules.size());
+    for (int i = 0; i < rules.size(); ++i) {
+        const QAction *action = rules.at(i).action;
+        if (rules.at(i).hasMimeRule) {
+            const QStringList &supports = propertyValues(action, kMimeType);
+            rules[i].supportOctetStream = supports.contains(kOctetStream);
+            indexMimeTypes(i, supports, &supportByMime, &supportWildcards);
+        } else {
+            // MimeType not exist == MimeType=*
+            withoutMimeRule.setBit(i);
+        }
+
+        indexMimeTypes(i, propertyValues(action, kMimeTypeExcludeKey, kMimeTypeExcludeAliasKey),
+                       &excludeByMime, &excludeWildcards);
+    }
+}
+
+OemActionMatcher::FileKey OemActionMatcher::fileKey(const QUrl &url, const FileInfoPointer &fileInfo)
+{
+    FileKey key;
+    key.mimeType = fileInfo->fileMimeType().name();
+    key.scheme = fileInfo->urlOf(UrlInfoType::kUrl).scheme().toLower();
+    key.isDir = fileInfo->isAttributes(OptInfoType::kIsDir);
+    key.isFtp = ProtocolUtils::isFTPFile(url);
+    key.isMtp = url.path().contains("/mtp:host");
+    if (hasSuffixRules && !key.isDir)
+        key.suffix = primarySuffix(fileInfo->nameOf(NameInfoType::kFileName),
+                                   fileInfo->nameOf(NameInfoType::kCompleteSuffix));
+    return key;
+}
+
+QBitArray OemActionMatcher::allActions() const
+{
+    return QBitArray(rules.size(), true);
+}
+
+QBitArray OemActionMatcher::evaluate(const FileKey &key, bool onDesktop, bool allEx7z)
+{
+    const QStringList direct = mimeTypes(key.mimeType);
+    const QStringList closure = mimeTypeClosure(key.mimeType);
+
+    // e.g. xlsx parentMimeTypes is application/zip, only the type itself is excluded
+    const QBitArray &excluded = matchMimeTypes(direct, excludeByMime, excludeWildcards);
+    const QBitArray supported = withoutMimeRule | matchMimeTypes(closure, supportByMime, supportWildcards);
+    const bool octetStream = closure.contains(kOctetStream);
+
+    QBitArray valid(rules.size());
+    for (int i = 0; i < rules.size(); ++i) {
+        if (!supported.testBit(i) || excluded.testBit(i))
+            continue;
+
+        const Rule &rule = rules.at(i);
+        if (onDesktop ? rule.hiddenOnDesktop : rule.hiddenInFileManager)
+            continue;
+        if (!rule.schemes.isEmpty() && !rule.schemes.contains(key.scheme))
+            continue;
+
+        // directories and actions without suffix filter are hidden for a 7z volume selection
+        const bool suffixOk = (key.isDir || !rule.hasSuffixRule) ? !allEx7z : isSuffixMatch(rule, key.suffix);
+        if (!suffixOk)
+            continue;
+
+        // compression is not supported on FTP
+        if (rule.isCompress && key.isFtp)
+            continue;
+
+        // The file attributes of some MTP mounted device directories do not meet the specifications
+        //(the ordinary directory mimeType is considered octet stream), so special treatment is required
+        if (key.isMtp && rule.hasMimeRule && rule.supportOctetStream && octetStream)
+            continue;
+
+        valid.setBit(i);
+    }
+
+    return valid;
+}
+
+QList<QAction *> OemActionMatcher::filter(const QList<QAction *> &actions, const QBitArray &valid) const
+{
+    QList<QAction *> rets;
+    for (QAction *action : actions) {
+        const int index = ruleIndex.value(action, -1);
+        if (index >= 0 && index < valid.size() && valid.testBit(index))
+            rets.append(action);
+    }
+    return rets;
+}
+
+void OemActionMatcher::indexMimeTypes(int index, const QStringList &mimeTypes, QHash<QString, QBitArray> *exact,
+                                      QList<QPair<QString, int>> *wildcards)
+{
+    for (const QString &mt : mimeTypes) {
+        QBitArray &bits = (*exact)[mt.toLower()];
+        if (bits.size() != rules.size())
+            bits.resize(rules.size());
+        bits.setBit(index);
+
+        int star = mt.indexOf("*");
+        if (star >= 0)
+            wildcards->append({ mt.left(star), index });
+    }
+}
+
+QBitArray OemActionMatcher::matchMimeTypes(const QStringList &mimeTypes, const QHash<QString, QBitArray> &exact,
+                                           const QList<QPair<QString, int>> &wildcards) const
+{
+    QBitArray bits(rules.size());
+    if (mimeTypes.isEmpty())
+        return bits;
+
+    for (const QString &mt : mimeTypes) {
+        auto it = exact.constFind(mt.toLower());
+        if (it != exact.cend())
+            bits |= it.value();
+    }
+
+    for (const auto &wildcard : wildcards) {
+        if (bits.testBit(wildcard.second))
+            continue;
+        for (const QString &mt : mimeTypes) {
+            if (mt.contains(wildcard.first, Qt::CaseInsensitive)) {
+                bits.setBit(wildcard.second);
+                break;
+            }
+        }
+    }
+
+    return bits;
+}
+
+const QStringList &OemActionMatcher::mimeTypes(const QString &name)
+{
+    auto it = mimeTypeNames.find(name);
+    if (it != mimeTypeNames.end())
+        return it.value();
+
+    QStringList names;
+    if (!name.isEmpty()) {
+        names.append(name);
+        names.append(mimeDatabase.mimeTypeForName(name).aliases());
+        names.removeAll({});
+    }
+    return mimeTypeNames.insert(name, names).value();
+}
+
+const QStringList &OemActionMatcher::mimeTypeClosure(const QString &name)
+{
+    auto it = mimeTypeClosures.find(name);
+    if (it != mimeTypeClosures.end())
+        return it.value();
+
+    QStringList closure = mimeTypes(name);
+    QSet<QString> visited { name };
+    QStringList pending = mimeDatabase.mimeTypeForName(name).parentMimeTypes();
+    while (!pending.isEmpty()) {
+        const QString parent = pending.takeFirst();
+        if (visited.contains(parent))
+            continue;
+        visited.insert(parent);
+
+        const QMimeType &mt = mimeDatabase.mimeTypeForName(parent);
+        closure.append(mt.name());
+        closure.append(mt.aliases());
+        pending.append(mt.parentMimeTypes());
+    }
+    closure.removeAll({});
+    return mimeTypeClosures.insert(name, closure).value();
+}
+
+QString OemActionMatcher::primarySuffix(const QString &fileName, const QString &completeSuffix)
+{
+    auto it = suffixes.constFind(completeSuffix);
+    if (it != suffixes.cend())
+        return it.value();
+
+    // only the trailing glob of the name matters, files sharing the complete suffix share the result
+    QString suffix = mimeDatabase.suffixForFileName(fileName);
+    // 处理分卷等特殊格式（如 7z.001），QMimeDatabase 对此类可能返回 7z.*
+    // 此时需要回退到完整的完整后缀字符串
+    if (suffix.isEmpty() || suffix.contains('*'))
+        suffix = completeSuffix;
+
+    suffixes.insert(completeSuffix, suffix);
+    return suffix;
+}
+
+bool OemActionMatcher::isSuffixMatch(const Rule &rule, const QString &suffix)
+{
+    if (rule.suffixes.contains(suffix, Qt::CaseInsensitive))
+        return true;
+
+    for (const QString &support : rule.suffixes) {
+        int endPos = support.lastIndexOf("*");   // 7z.*
+        if (endPos >= 0 && suffix.length() > endPos && support.left(endPos) == suffix.left(endPos))
+            return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef OEMACTIONMATCHER_H
+#define OEMACTIONMATCHER_H
+
+#include "dfmplugin_menu_global.h"
+
+#include <dfm-base/interfaces/fileinfo.h>
+#include <dfm-base/mimetype/dmimedatabase.h>
+
+#include <QAction>
+#include <QBitArray>
+#include <QHash>
+
+namespace dfmplugin_menu {
+
+/*!
+ * \brief The conditions of the loaded OEM actions, compiled once per load
+ *
+ * The MimeType, exclude MimeType, scheme, suffix and NotShowIn values are read
+ * from the action properties a single time and indexed by mime type, so checking
+ * a file is a few hash lookups and bit operations instead of walking every action.
+ * A selection is first reduced to its distinct FileKeys, the results of the keys
+ * are intersected.
+ */
+class OemActionMatcher
+{
+public:
+    struct FileKey
+    {
+        QString mimeType;
+        QString suffix;   // empty if no action filters by suffix or for directories
+        QString scheme;
+        bool isDir { false };
+        bool isFtp { false };
+        bool isMtp { false };
+
+        QString id() const;
+    };
+
+    void compile(const QList<QAction *> &actions);
+    void clear();
+
+    FileKey fileKey(const QUrl &url, const DFMBASE_NAMESPACE::FileInfoPointer &fileInfo);
+
+    // all bits set, the start value of an intersection
+    QBitArray allActions() const;
+    QBitArray evaluate(const FileKey &key, bool onDesktop, bool allEx7z);
+    QList<QAction *> filter(const QList<QAction *> &actions, const QBitArray &valid) const;
+
+private:
+    struct Rule
+    {
+        QAction *action { nullptr };
+        bool hiddenOnDesktop { false };
+        bool hiddenInFileManager { false };
+        QStringList schemes;   // empty means any scheme
+        bool hasSuffixRule { false };
+        QStringList suffixes;
+        bool hasMimeRule { false };
+        bool supportOctetStream { false };
+        bool isCompress { false };
+    };
+
+    void indexMimeTypes(int index, const QStringList &mimeTypes, QHash<QString, QBitArray> *exact,
+                        QList<QPair<QString, int>> *wildcards);
+    QBitArray matchMimeTypes(const QStringList &mimeTypes, const QHash<QString, QBitArray> &exact,
+                             const QList<QPair<QString, int>> &wildcards) const;
+    const QStringList &mimeTypes(const QString &name);
+    const QStringList &mimeTypeClosure(const QString &name);
+    QString primarySuffix(const QString &fileName, const QString &completeSuffix);
+    static bool isSuffixMatch(const Rule &rule, const QString &suffix);
+
+    QVector<Rule> rules;
+    QHash<QAction *, int> ruleIndex;
+    bool hasSuffixRules { false };
+
+    // lower case mime type -> actions listing it
+    QHash<QString, QBitArray> supportByMime;
+    QList<QPair<QString, int>> supportWildcards;   // "image/*" -> ("image/", action)
+    QHash<QString, QBitArray> excludeByMime;
+    QList<QPair<QString, int>> excludeWildcards;
+    QBitArray withoutMimeRule;
+
+    // memoized per mime type name, kept until the next compile
+    QHash<QString, QStringList> mimeTypeNames;   // name and aliases
+    QHash<QString, QStringList> mimeTypeClosures;   // and all the parents
+    QHash<QString, QString> suffixes;   // complete suffix -> primary suffix
+    DFMBASE_NAMESPACE::DMimeDatabase mimeDatabase;
+};
+
+}
+
+#endif   // OEMACTIONMATCHER_H
@@ -17,6 +17,7 @@
 #include <QIcon>
 #include <QMenu>
 #include <QDebug>
+#include <QElapsedTimer>
 
 using namespace dfmplugin_menu;
 DFMBASE_USE_NAMESPACE
@@ -127,30 +128,6 @@ QStringList OemMenuPrivate::getValues(const DDesktopEntry &entry, const QString
     return values;
 }
 
-bool OemMenuPrivate::isMimeTypeSupport(const QString &mt, const QStringList &fileMimeTypes) const
-{
-    for (auto fmt : fileMimeTypes) {
-        if (fmt.contains(mt, Qt::CaseInsensitive))
-            return true;
-    }
-
-    return false;
-}
-
-bool OemMenuPrivate::isMimeTypeMatch(const QStringList &fileMimeTypes, const QStringList &supportMimeTypes) const
-{
-    for (auto mt : supportMimeTypes) {
-        if (fileMimeTypes.contains(mt, Qt::CaseInsensitive))
-            return true;
-
-        int index = mt.indexOf("*");
-        if (index >= 0 && isMimeTypeSupport(mt.left(index), fileMimeTypes))
-            return true;
-    }
-
-    return false;
-}
-
 bool OemMenuPrivate::isActionShouldShow(const QAction *action, bool onDesktop) const
 {
     if (!action)
@@ -219,31 +196,6 @@ bool OemMenuPrivate::isSuffixSupport(const QAction *action, FileInfoPointer file
     return false;
 }
 
-bool OemMenuPrivate::isAllEx7zFile(const QList<QUrl> &files) const
-{
-    if (files.size() <= 1) {
-        return false;
-    }
-
-    QString errString;
-    for (const QUrl &f : files) {
-
-        auto fileInfo = DFMBASE_NAMESPACE::InfoFactory::create<FileInfo>(f, Global::CreateFileInfoType::kCreateFileInfoAuto, &errString);
-        if (fileInfo.isNull()) {
-            fmDebug() << errString;
-            return false;
-        }
-
-        // 7z.001,7z.002, 7z.003 ... 7z.xxx
-        QString cs = fileInfo->nameOf(NameInfoType::kCompleteSuffix);
-        if (!cs.startsWith(QString("7z."))) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
 bool OemMenuPrivate::isValid(const QAction *action, FileInfoPointer fileInfo, const bool onDesktop, const bool allEx7z) const
 {
     if (!action)
@@ -401,36 +353,6 @@ QStringList OemMenuPrivate::urlListToString(const QList<QUrl> &files) const
     return rets;
 }
 
-void OemMenuPrivate::appendParentMineType(const QStringList &parentmimeTypes, QStringList &mimeTypes) const
-{
-    if (parentmimeTypes.isEmpty())
-        return;
-
-    DFMBASE_NAMESPACE::DMimeDatabase db;
-    QSet<QString> mimeTypeNames;
-    QStringList allparentmimeTypes = parentmimeTypes;
-    int count = 0;
-    while (!allparentmimeTypes.isEmpty()) {
-        if (count > 10000)   // 预防死循环
-            break;
-        const QString &mtName = allparentmimeTypes.takeFirst();
-        if (mimeTypeNames.contains(mtName))
-            continue;
-        mimeTypeNames.insert(mtName);
-        count++;
-        QMimeType mt = db.mimeTypeForName(mtName);
-        mimeTypes.append(mt.name());
-        mimeTypes.append(mt.aliases());
-        QStringList parentMimeTypes = mt.parentMimeTypes();
-
-        for (const auto &type : parentMimeTypes) {
-            if (mimeTypeNames.contains(type))
-                continue;
-            allparentmimeTypes.push_back(type);
-        }
-    }
-}
-
 QStringList OemMenuPrivate::applyDynamicArg(const QStringList &args, ArgType type, const QUrl &dir, const QUrl &focus, const QList<QUrl> &files) const
 {
     QStringList cmdArgs = args;
@@ -523,6 +445,11 @@ void OemMenu::loadDesktopFile()
             }
         }
     }
+
+    QList<QAction *> allActions;
+    for (const QString &type : d->menuTypes)
+        allActions.append(d->actionListByType.value(type));
+    d->matcher.compile(allActions);
 }
 
 QList<QAction *> OemMenu::emptyActions(const QUrl &currentDir, bool onDesktop)
@@ -546,6 +473,8 @@ QList<QAction *> OemMenu::emptyActions(const QUrl &currentDir, bool onDesktop)
 
 QList<QAction *> OemMenu::normalActions(const QList<QUrl> &files, bool onDesktop)
 {
+    QElapsedTimer timer;
+    timer.start();
     QString menuType;
 
     QString errString;
@@ -565,78 +494,34 @@ QList<QAction *> OemMenu::normalActions(const QList<QUrl> &files, bool onDesktop
     if (actions.isEmpty())
         return actions;
 
-    QStringList filePaths;
-    bool bex7z = d->isAllEx7zFile(files);
+    // a big selection usually has only a few kinds of files, check each kind once
+    QHash<QString, OemActionMatcher::FileKey> fileKeys;
+    bool allEx7z = files.size() > 1;
     for (const QUrl &file : files) {
-
         auto fileInfo = DFMBASE_NAMESPACE::InfoFactory::create<FileInfo>(file, Global::CreateFileInfoType::kCreateFileInfoAuto, &errString);
-
         if (!fileInfo) {
             fmWarning() << "createFileInfo failed: " << file;
+            allEx7z = false;
             continue;
         }
-        filePaths << file.path();
-
-        QStringList fileMimeTypes, fmts;
-        fileMimeTypes.append(fileInfo->fileMimeType().name());
-        fileMimeTypes.append(fileInfo->fileMimeType().aliases());
-        const QMimeType &mt = fileInfo->fileMimeType();
-        fmts = fileMimeTypes;
-        d->appendParentMineType(mt.parentMimeTypes(), fileMimeTypes);
-        fileMimeTypes.removeAll({});
-        fmts.removeAll({});
-
-        for (auto it = actions.begin(); it != actions.end();) {
-            QAction *action = *it;
-            if (!d->isValid(action, fileInfo, onDesktop, bex7z)) {
-                it = actions.erase(it);
-                continue;
-            }
 
-            // compression is not supported on FTP
-            if (action->text() == QObject::tr("Compress") && ProtocolUtils::isFTPFile(file)) {
-                it = actions.erase(it);
-                continue;
-            }
-
-            // match exclude mime types
-            QStringList excludeMimeTypes = action->property(kMimeTypeExcludeKey).toStringList();
-            excludeMimeTypes << action->property(kMimeTypeExcludeAliasKey).toStringList();
-
-            excludeMimeTypes.removeAll({});
-            // e.g. xlsx parentMimeTypes is application/zip
-            bool match = d->isMimeTypeMatch(fmts, excludeMimeTypes);
-            if (match) {
-                it = actions.erase(it);
-                continue;
-            }
-
-            // MimeType not exist == MimeType=*
-            if (!action->property(kMimeType).isValid()) {
-                ++it;
-                continue;
-            }
-
-            // match support mime types
-            QStringList supportMimeTypes = action->property(kMimeType).toStringList();
-            supportMimeTypes.removeAll({});
-            match = d->isMimeTypeMatch(fileMimeTypes, supportMimeTypes);
-
-            // The file attributes of some MTP mounted device directories do not meet the specifications
-            //(the ordinary directory mimeType is considered octet stream), so special treatment is required
-            if (file.path().contains("/mtp:host") && supportMimeTypes.contains("application/octet-stream") && fileMimeTypes.contains("application/octet-stream")) {
-                match = false;
-            }
-
-            if (!match) {
-                it = actions.erase(it);
-                continue;
-            }
+        // 7z.001,7z.002, 7z.003 ... 7z.xxx
+        if (allEx7z && !fileInfo->nameOf(NameInfoType::kCompleteSuffix).startsWith(QString("7z.")))
+            allEx7z = false;
 
-            ++it;
-        }
+        const OemActionMatcher::FileKey &key = d->matcher.fileKey(file, fileInfo);
+        fileKeys.insert(key.id(), key);
     }
 
+    QBitArray valid = d->matcher.allActions();
+    for (const OemActionMatcher::FileKey &key : fileKeys)
+        valid &= d->matcher.evaluate(key, onDesktop, allEx7z);
+    // files failed to create info are skipped
+    if (!fileKeys.isEmpty())
+        actions = d->matcher.filter(actions, valid);
+
+    fmDebug() << "[OEM Menu Support]" << actions.size() << "actions for" << files.size() << "files of"
+              << fileKeys.size() << "kinds, cost" << timer.elapsed() << "ms";
     return actions;
 }
 
@@ -662,76 +547,9 @@ QList<QAction *> OemMenu::focusNormalActions(const QUrl &foucs, const QList<QUrl
     if (actions.isEmpty())
         return actions;
 
-    // get foucs file mimetype
-    QStringList mimeTypes;
-    QStringList siblingMimeTypes;
-    {
-        // get normal mimetype
-        mimeTypes.append(fileInfo->fileMimeType().name());
-        mimeTypes.append(fileInfo->fileMimeType().aliases());
-        mimeTypes.removeAll(QString(""));
-
-        // get parent mimetype
-        const QMimeType &mt = fileInfo->fileMimeType();
-        siblingMimeTypes = mimeTypes;
-        d->appendParentMineType(mt.parentMimeTypes(), siblingMimeTypes);
-        siblingMimeTypes.removeAll(QString(""));
-    }
-
-    // check each actons
-    for (auto it = actions.begin(); it != actions.end();) {
-        QAction *action = *it;
-        // check Desktop, Scheme, Suffix
-        if (!d->isValid(action, fileInfo, onDesktop, false)) {
-            it = actions.erase(it);
-            continue;
-        }
-
-        // compression is not supported on FTP
-        if (action->text() == QObject::tr("Compress") && ProtocolUtils::isFTPFile(foucs)) {
-            it = actions.erase(it);
-            continue;
-        }
-
-        // match exclude mime types
-        QStringList excludeMimeTypes = action->property(kMimeTypeExcludeKey).toStringList();
-        excludeMimeTypes << action->property(kMimeTypeExcludeAliasKey).toStringList();
-
-        excludeMimeTypes.removeAll({});
-        // e.g. xlsx parentMimeTypes is application/zip
-        bool match = d->isMimeTypeMatch(mimeTypes, excludeMimeTypes);
-        if (match) {
-            it = actions.erase(it);
-            continue;
-        }
-
-        // MimeType not exist == MimeType=*
-        if (!action->property(kMimeType).isValid()) {
-            ++it;
-            continue;
-        }
-
-        // match support mime types
-        QStringList supportMimeTypes = action->property(kMimeType).toStringList();
-        supportMimeTypes.removeAll({});
-        match = d->isMimeTypeMatch(siblingMimeTypes, supportMimeTypes);
-
-        // The file attributes of some MTP mounted device directories do not meet the specifications
-        //(the ordinary directory mimeType is considered octet stream), so special treatment is required
-        if (foucs.path().contains("/mtp:host") && supportMimeTypes.contains("application/octet-stream")
-            && siblingMimeTypes.contains("application/octet-stream")) {
-            match = false;
-        }
-
-        if (!match) {
-            it = actions.erase(it);
-            continue;
-        }
-
-        ++it;
-    }
-
-    return actions;
+    // only the focus file is checked
+    const QBitArray &valid = d->matcher.evaluate(d->matcher.fileKey(foucs, fileInfo), onDesktop, false);
+    return d->matcher.filter(actions, valid);
 }
 
 QPair<QString, QStringList> OemMenu::makeCommand(const QAction *action, const QUrl &dir, const QUrl &focus, const QList<QUrl> &files)
@@ -6,6 +6,7 @@
 #define OEMMENU_P_H
 
 #include "dfmplugin_menu_global.h"
+#include "oemmenuscene/oemactionmatcher.h"
 
 #include <dfm-base/interfaces/fileinfo.h>
 #include <dfm-base/mimetype/dmimedatabase.h>
@@ -38,12 +39,9 @@ public:
 
     QStringList getValues(const Dtk::Core::DDesktopEntry &entry, const QString &key, const QString &aliasKey, const QString &section = "Desktop Entry", const QStringList &whiteList = {}) const;
 
-    bool isMimeTypeSupport(const QString &mt, const QStringList &fileMimeTypes) const;
-    bool isMimeTypeMatch(const QStringList &fileMimeTypes, const QStringList &supportMimeTypes) const;
     bool isActionShouldShow(const QAction *action, bool onDesktop) const;
     bool isSchemeSupport(const QAction *action, const QUrl &url) const;
     bool isSuffixSupport(const QAction *action, FileInfoPointer fileInfo, const bool allEx7z = false) const;
-    bool isAllEx7zFile(const QList<QUrl> &files) const;
     bool isValid(const QAction *action, FileInfoPointer fileInfo, const bool onDesktop, const bool allEx7z = false) const;
 
     void clearSubMenus();
@@ -55,7 +53,6 @@ public:
     QStringList urlListToLocalFile(const QList<QUrl> &files) const;
     QString urlToString(const QUrl &file) const;
     QStringList urlListToString(const QList<QUrl> &files) const;
-    void appendParentMineType(const QStringList &parentmimeTypes, QStringList &mimeTypes) const;
     QStringList applyDynamicArg(const QStringList &args, ArgType type, const QUrl &dir, const QUrl &focus, const QList<QUrl> &files) const;
 
 public:
@@ -64,6 +61,7 @@ public:
     QMap<QString, QList<QAction *>> actionListByType;
     QList<QMenu *> subMenus;
     dfmbase::DMimeDatabase mimeDatabase;
+    OemActionMatcher matcher;
 
     QStringList oemMenuPath;
     QStringList menuTypes;
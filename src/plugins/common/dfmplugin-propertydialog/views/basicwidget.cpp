@@ -53,6 +53,7 @@ BasicWidget::BasicWidget(QWidget *parent)
 {
     initUI();
     fileCalculationUtils = new FileScanner(this);
+    fileCalculationUtils->setOptions(FileScanner::ScanOption::Parallel | FileScanner::ScanOption::UseSizeCache);
 
     connect(&fetchThread, &QThread::finished, infoFetchWorker, &QObject::deleteLater);
     infoFetchWorker->moveToThread(&fetchThread);
@@ -23,7 +23,8 @@ MultiFilePropertyDialog::MultiFilePropertyDialog(const QList<QUrl> &urls, QWidge
     initHeadUi();
     setFixedSize(300, 360);
     fileCalculationUtils = new FileScanner(this);
-    fileCalculationUtils->setOptions(FileScanner::ScanOption::IncludeSource);
+    fileCalculationUtils->setOptions(FileScanner::ScanOption::IncludeSource | FileScanner::ScanOption::Parallel
+                                     | FileScanner::ScanOption::UseSizeCache);
     connect(fileCalculationUtils, &FileScanner::progressChanged, this, &MultiFilePropertyDialog::updateFolderSizeLabel);
     QList<QUrl> targets;
     UniversalUtils::urlsTransformToLocal(urlList, &targets);
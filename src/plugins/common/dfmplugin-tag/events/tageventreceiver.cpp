@@ -95,6 +95,7 @@ void TagEventReceiver::handleFileRemoveResult(const QList<QUrl> &srcUrls, bool o
         const auto &tags = TagManager::instance()->getTagsByUrls({ url });
         if (!tags.isEmpty())
             TagManager::instance()->removeTagsOfFiles(tags, { url });
+        TagManager::instance()->removeChildrenCache(path);
     }
 }
 
@@ -257,12 +258,12 @@ TagEventReceiver::TagEventReceiver(QObject *parent)
 {
 }
 
-void TagEventReceiver::addTagsToUrl(const QUrl &url, const QStringList &tags)
+bool TagEventReceiver::addTagsToUrl(const QUrl &url, const QStringList &tags)
 {
     if (tags.isEmpty() || !TagManager::instance()->canTagFile(url))
-        return;
+        return false;
 
-    TagManager::instance()->addTagsForFiles(tags, { url });
+    return TagManager::instance()->addTagsForFiles(tags, { url });
 }
 
 void TagEventReceiver::processDirectoryTags(const QUrl &srcUrl, const QUrl &destUrl, bool shouldRemoveSource)
@@ -276,16 +277,22 @@ void TagEventReceiver::processDirectoryTags(const QUrl &srcUrl, const QUrl &dest
     QString destPath = destInfo->pathOf(FileInfo::FilePathInfoType::kAbsoluteFilePath);
 
     const auto &children = TagManager::instance()->findChildren(srcPath);
+    bool allRetagged = true;
     for (auto it = children.cbegin(); it != children.cend(); ++it) {
         QString srcTagFile = it.key();
         QString destFile = srcTagFile.replace(0, srcPath.length(), destPath);
 
-        if (std::filesystem::exists(destFile.toLocal8Bit().data()))
-            addTagsToUrl(QUrl::fromLocalFile(destFile), it.value());
+        if (!std::filesystem::exists(destFile.toLocal8Bit().data())
+            || !addTagsToUrl(QUrl::fromLocalFile(destFile), it.value()))
+            allRetagged = false;
 
         if (shouldRemoveSource)
             TagManager::instance()->removeTagsOfFiles(it.value(), { QUrl::fromLocalFile(it.key()) });
     }
+
+    // 只有服务给每个目标都加了标记时才整体移动缓存，否则等服务的逐个文件通知
+    if (shouldRemoveSource && allRetagged && !children.isEmpty())
+        TagManager::instance()->moveChildrenCache(srcPath, destPath);
 }
 
 void TagEventReceiver::processFileTags(const QUrl &srcUrl, const QUrl &destUrl, bool shouldRemoveSource)
@@ -36,7 +36,7 @@ public slots:
 private:
     explicit TagEventReceiver(QObject *parent = nullptr);
 
-    void addTagsToUrl(const QUrl &url, const QStringList &tags);
+    bool addTagsToUrl(const QUrl &url, const QStringList &tags);
     void processDirectoryTags(const QUrl &srcUrl, const QUrl &destUrl, bool shouldRemoveSource);
     void processFileTags(const QUrl &srcUrl, const QUrl &destUrl, bool shouldRemoveSource);
 };
@@ -81,6 +81,28 @@ FileTagCachePrivate::~FileTagCachePrivate()
 {
 }
 
+void FileTagCachePrivate::tagFile(const QString &path, const QStringList &tags)
+{
+    QStringList cacheLst = fileTags.tags(path);
+    for (const QString &tag : tags)
+        if (!cacheLst.contains(tag))
+            cacheLst.append(tag);
+
+    fileTags.setTags(path, cacheLst);
+}
+
+void FileTagCachePrivate::untagFile(const QString &path, const QStringList &tags)
+{
+    QStringList cacheLst = fileTags.tags(path);
+    if (cacheLst.isEmpty())
+        return;
+
+    for (const QString &tag : tags)
+        cacheLst.removeOne(tag);
+
+    fileTags.setTags(path, cacheLst);
+}
+
 FileTagCache::FileTagCache(QObject *parent)
     : QObject(parent), d(new FileTagCachePrivate(this))
 {
@@ -96,20 +118,30 @@ void FileTagCache::loadFileTagsFromDatabase()
 {
     fmInfo() << "Start initilize FileTagCache";
     // 加载数据库所有文件标记,和标记属性到缓存
-    if (!TagProxyHandle::instance()->isValid())
+    const bool serviceValid = TagProxyHandle::instance()->isValid();
+    if (!serviceValid)
         fmWarning() << "tagService is inValid";
-    d->fileTagsCache = TagProxyHandle::instance()->getAllFileWithTags();
+    const auto &fileWithTags = TagProxyHandle::instance()->getAllFileWithTags();
     const auto &tagsColor = TagProxyHandle::instance()->getAllTags();
+    const auto &trashFileTags = TagProxyHandle::instance()->getAllTrashFileTags();
+
+    QWriteLocker locker(&d->lock);
+    d->fileTags.clear();
+    for (auto it = fileWithTags.cbegin(); it != fileWithTags.cend(); ++it)
+        d->fileTags.setTags(it.key(), it.value().toStringList());
     auto it = tagsColor.begin();
     for (; it != tagsColor.end(); ++it)
         d->tagProperty.insert(it.key(), QColor(it.value().toString()));
 
     // 加载回收站标记数据
-    d->trashFileTagsCache = TagProxyHandle::instance()->getAllTrashFileTags();
+    d->trashFileTagsCache = trashFileTags;
+    d->loaded = serviceValid;
+    fmInfo() << "FileTagCache initialized, tagged files:" << d->fileTags.fileCount();
 }
 
 void FileTagCache::addTags(const QVariantMap &tags)
 {
+    QWriteLocker locker(&d->lock);
     auto it = tags.begin();
     for (; it != tags.end(); ++it) {
         if (d->tagProperty.contains(it.key()))
@@ -120,28 +152,20 @@ void FileTagCache::addTags(const QVariantMap &tags)
 
 void FileTagCache::deleteTags(const QStringList &tags)
 {
-    QVariantMap map {};
+    QWriteLocker locker(&d->lock);
     for (const QString &tag : tags) {
         d->tagProperty.remove(tag);
 
-        auto iter = d->fileTagsCache.begin();
-        while (iter != d->fileTagsCache.end()) {
-            if (iter.value().toStringList().contains(tag)) {
-                QStringList fileTags = map[iter.key()].toStringList();
-                fileTags.append(tag);
-                map[iter.key()] = fileTags;
-            }
-
-            ++iter;
-        }
+        // 倒排表直接给出带该标记的文件
+        const QStringList &files = d->fileTags.filesWithTag(tag);
+        for (const QString &file : files)
+            d->untagFile(file, { tag });
     }
-
-    if (!map.isEmpty())
-        untaggeFiles(map);
 }
 
 void FileTagCache::changeTagColor(const QVariantMap &tagAndColorName)
 {
+    QWriteLocker locker(&d->lock);
     auto it = tagAndColorName.begin();
     for (; it != tagAndColorName.end(); ++it) {
         if (d->tagProperty.contains(it.key()))
@@ -151,6 +175,7 @@ void FileTagCache::changeTagColor(const QVariantMap &tagAndColorName)
 
 void FileTagCache::changeTagName(const QVariantMap &oldAndNew)
 {
+    QWriteLocker locker(&d->lock);
     auto it = oldAndNew.begin();
     for (; it != oldAndNew.end(); ++it) {
         const QString &oldName { it.key() };
@@ -165,33 +190,28 @@ void FileTagCache::changeTagName(const QVariantMap &oldAndNew)
 
 void FileTagCache::changeFilesTagName(const QString &oldName, const QString &newName)
 {
-    std::for_each(d->fileTagsCache.begin(), d->fileTagsCache.end(), [oldName, newName](QVariant &var) {
-        QStringList tagNames { var.toStringList() };
-        auto result { std::find(tagNames.begin(), tagNames.end(), oldName) };
-        if (result != tagNames.end()) {
-            int index { result - tagNames.begin() };
-            tagNames.replace(index, newName);
-            var.setValue(tagNames);
-        }
-    });
+    QWriteLocker locker(&d->lock);
+    d->fileTags.renameTag(oldName, newName);
 }
 
 void FileTagCache::taggeFiles(const QVariantMap &fileAndTags)
 {
+    QWriteLocker locker(&d->lock);
     auto it = fileAndTags.begin();
-    for (; it != fileAndTags.end(); ++it) {
-        if (!d->fileTagsCache.contains(it.key())) {
-            d->fileTagsCache.insert(it.key(), it.value().toStringList());
-        } else {
-            const auto &lst = it.value().toStringList();
-            auto cacheLst = d->fileTagsCache.value(it.key()).toStringList();
-            for (const QString &tag : lst)
-                if (!cacheLst.contains(tag))
-                    cacheLst.append(tag);
-
-            d->fileTagsCache[it.key()] = cacheLst;
-        }
-    }
+    for (; it != fileAndTags.end(); ++it)
+        d->tagFile(it.key(), it.value().toStringList());
+}
+
+void FileTagCache::moveFiles(const QString &fromPath, const QString &toPath)
+{
+    QWriteLocker locker(&d->lock);
+    d->fileTags.moveSubtree(fromPath, toPath);
+}
+
+void FileTagCache::removeFiles(const QString &path)
+{
+    QWriteLocker locker(&d->lock);
+    d->fileTags.removeSubtree(path);
 }
 
 QStringList FileTagCache::getTrashTags(const QString &path, qint64 inode) const
@@ -209,22 +229,10 @@ void FileTagCache::reloadTrashFileTagsCache()
 
 void FileTagCache::untaggeFiles(const QVariantMap &fileAndTags)
 {
+    QWriteLocker locker(&d->lock);
     auto it = fileAndTags.begin();
-    for (; it != fileAndTags.end(); ++it) {
-        if (d->fileTagsCache.contains(it.key())) {
-            const auto &lst = it.value().toStringList();
-            auto cacheLst = d->fileTagsCache.value(it.key()).toStringList();
-            for (const QString &tag : lst)
-                if (cacheLst.contains(tag))
-                    cacheLst.removeOne(tag);
-
-            if (cacheLst.isEmpty()) {
-                d->fileTagsCache.remove(it.key());
-            } else {
-                d->fileTagsCache[it.key()] = cacheLst;
-            }
-        }
-    }
+    for (; it != fileAndTags.end(); ++it)
+        d->untagFile(it.key(), it.value().toStringList());
 }
 
 FileTagCache::~FileTagCache()
@@ -242,10 +250,10 @@ QStringList FileTagCache::getTagsByFiles(const QStringList &paths) const
         return {};
 
     QReadLocker wlk(&d->lock);
-    QStringList intersectionTags = d->fileTagsCache.value(paths.first()).toStringList();
+    QStringList intersectionTags = d->fileTags.tags(paths.first());
 
     for (const QString &path : paths) {
-        QStringList tags = d->fileTagsCache.value(path).toStringList();
+        QStringList tags = d->fileTags.tags(path);
 #if (QT_VERSION < QT_VERSION_CHECK(6, 0, 0))
         intersectionTags = intersectionTags.toSet().intersect(tags.toSet()).values();
 #else
@@ -261,19 +269,18 @@ QStringList FileTagCache::getTagsByFiles(const QStringList &paths) const
 
 QHash<QString, QStringList> FileTagCache::findChildren(const QString &parentPath) const
 {
-    QHash<QString, QStringList> children;
-    QString normalizedParent = parentPath;
-    if (!normalizedParent.endsWith('/'))
-        normalizedParent += '/';
+    QReadLocker wlk(&d->lock);
+    return d->fileTags.children(parentPath);
+}
 
+bool FileTagCache::getFilesByTag(const QString &tag, QStringList *files) const
+{
     QReadLocker wlk(&d->lock);
-    for (auto it = d->fileTagsCache.cbegin(); it != d->fileTagsCache.cend(); ++it) {
-        const QString &filePath = it.key();
-        if (filePath.startsWith(normalizedParent))
-            children.insert(filePath, it.value().toStringList());
-    }
+    if (!d->loaded)
+        return false;
 
-    return children;
+    *files = d->fileTags.filesWithTag(tag);
+    return true;
 }
 
 FileTagCache::TagColorMap FileTagCache::getTagsColor(const QStringList &tags) const
@@ -317,6 +324,21 @@ QHash<QString, QStringList> FileTagCacheController::findChildren(const QString &
     return FileTagCache::instance().findChildren(parentPath);
 }
 
+bool FileTagCacheController::getFilesByTag(const QString &tag, QStringList *files) const
+{
+    return FileTagCache::instance().getFilesByTag(tag, files);
+}
+
+void FileTagCacheController::moveTaggedFiles(const QString &fromPath, const QString &toPath)
+{
+    FileTagCache::instance().moveFiles(fromPath, toPath);
+}
+
+void FileTagCacheController::removeTaggedFiles(const QString &path)
+{
+    FileTagCache::instance().removeFiles(path);
+}
+
 QStringList FileTagCacheController::getTrashFileTags(const QString &path, qint64 inode)
 {
     return FileTagCache::instance().getTrashTags(path, inode);
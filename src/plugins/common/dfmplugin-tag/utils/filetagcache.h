@@ -52,6 +52,8 @@ public:
     QStringList getTagsByFiles(const QStringList &paths) const;
     TagColorMap getTagsColor(const QStringList &tags) const;
     QHash<QString, QStringList> findChildren(const QString &parentPath) const;
+    // 缓存未加载时返回 false
+    bool getFilesByTag(const QString &tag, QStringList *files) const;
 
 private:
     explicit FileTagCache(QObject *parent = nullptr);
@@ -65,6 +67,8 @@ private:
     void changeFilesTagName(const QString &oldName, const QString &newName);
     void taggeFiles(const QVariantMap &fileAndTags);
     void untaggeFiles(const QVariantMap &fileAndTags);
+    void moveFiles(const QString &fromPath, const QString &toPath);
+    void removeFiles(const QString &path);
 
     QStringList getTrashTags(const QString &path, qint64 inode) const;
     void reloadTrashFileTagsCache();
@@ -86,6 +90,10 @@ public:
     QStringList getTagsByFile(const QString &path);
     QMap<QString, QColor> getCacheTagsColor(const QStringList &tags);
     QHash<QString, QStringList> findChildren(const QString &parentPath) const;
+    bool getFilesByTag(const QString &tag, QStringList *files) const;
+
+    void moveTaggedFiles(const QString &fromPath, const QString &toPath);
+    void removeTaggedFiles(const QString &path);
 
     QStringList getTrashFileTags(const QString &path, qint64 inode);
 
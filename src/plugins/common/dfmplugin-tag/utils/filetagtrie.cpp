@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "filetagtrie.h"
+
+#include <algorithm>
+
+DPTAG_USE_NAMESPACE
+
+namespace {
+QStringList pathComponents(const QString &path)
+{
+    return path.split('/', Qt::SkipEmptyParts);
+}
+
+bool isSameOrAncestor(const QStringList &ancestor, const QStringList &path)
+{
+    if (ancestor.size() > path.size())
+        return false;
+    return std::equal(ancestor.cbegin(), ancestor.cend(), path.cbegin());
+}
+}   // namespace
+
+FileTagTrie::FileTagTrie()
+{
+}
+
+FileTagTrie::~FileTagTrie()
+{
+    clear();
+}
+
+void FileTagTrie::clear()
+{
+    for (Node *child : std::as_const(root.children))
+        destroy(child);
+    root.children.clear();
+    root.tags.clear();
+    postings.clear();
+    taggedCount = 0;
+}
+
+int FileTagTrie::fileCount() const
+{
+    return taggedCount;
+}
+
+QStringList FileTagTrie::tags(const QString &path) const
+{
+    const Node *node = find(path);
+    return node ? node->tags : QStringList();
+}
+
+void FileTagTrie::setTags(const QString &path, const QStringList &tags)
+{
+    if (tags.isEmpty()) {
+        Node *node = find(path);
+        if (!node)
+            return;
+        setNodeTags(node, {});
+        prune(node);
+        return;
+    }
+
+    setNodeTags(findOrCreate(pathComponents(path)), tags);
+}
+
+QHash<QString, QStringList> FileTagTrie::children(const QString &parentPath) const
+{
+    QHash<QString, QStringList> result;
+    const Node *node = find(parentPath);
+    if (!node)
+        return result;
+
+    const QString &prefix = pathOf(node);
+    for (auto it = node->children.cbegin(); it != node->children.cend(); ++it)
+        collect(it.value(), prefix.endsWith('/') ? prefix + it.key() : prefix + '/' + it.key(), &result);
+    return result;
+}
+
+QStringList FileTagTrie::filesWithTag(const QString &tag) const
+{
+    QStringList files;
+    const auto &nodes = postings.value(tag);
+    files.reserve(nodes.size());
+    for (const Node *node : nodes)
+        files.append(pathOf(node));
+    return files;
+}
+
+void FileTagTrie::renameTag(const QString &oldName, const QString &newName)
+{
+    if (oldName == newName)
+        return;
+
+    const QSet<Node *> nodes = postings.take(oldName);
+    auto &renamed = postings[newName];
+    for (Node *node : nodes) {
+        const int index = node->tags.indexOf(oldName);
+        if (node->tags.contains(newName))
+            node->tags.removeAt(index);
+        else
+            node->tags.replace(index, newName);
+        renamed.insert(node);
+    }
+    if (renamed.isEmpty())
+        postings.remove(newName);
+}
+
+void FileTagTrie::moveSubtree(const QString &from, const QString &to)
+{
+    const QStringList &fromComponents = pathComponents(from);
+    const QStringList &toComponents = pathComponents(to);
+    // 不能移动到自身或自身的子目录下
+    if (fromComponents.isEmpty() || isSameOrAncestor(fromComponents, toComponents))
+        return;
+
+    Node *node = find(from);
+    if (!node)
+        return;
+
+    Node *oldParent = node->parent;
+    oldParent->children.remove(node->name);
+    node->parent = nullptr;
+
+    if (Node *target = find(to)) {
+        merge(node, target);
+        delete node;
+    } else {
+        Node *newParent = findOrCreate(toComponents.mid(0, toComponents.size() - 1));
+        node->name = toComponents.last();
+        node->parent = newParent;
+        newParent->children.insert(node->name, node);
+    }
+
+    prune(oldParent);
+}
+
+void FileTagTrie::removeSubtree(const QString &path)
+{
+    Node *node = find(path);
+    if (!node)
+        return;
+
+    if (node == &root) {
+        clear();
+        return;
+    }
+
+    Node *parent = node->parent;
+    parent->children.remove(node->name);
+    destroy(node);
+    prune(parent);
+}
+
+FileTagTrie::Node *FileTagTrie::find(const QString &path) const
+{
+    const Node *node = &root;
+    for (const QString &name : pathComponents(path)) {
+        node = node->children.value(name);
+        if (!node)
+            return nullptr;
+    }
+    return const_cast<Node *>(node);
+}
+
+FileTagTrie::Node *FileTagTrie::findOrCreate(const QStringList &components)
+{
+    Node *node = &root;
+    for (const QString &name : components) {
+        Node *&child = node->children[name];
+        if (!child) {
+            child = new Node;
+            child->name = name;
+            child->parent = node;
+        }
+        node = child;
+    }
+    return node;
+}
+
+QString FileTagTrie::pathOf(const Node *node) const
+{
+    if (node == &root)
+        return QStringLiteral("/");
+
+    QStringList names;
+    for (; node != &root; node = node->parent)
+        names.prepend(node->name);
+    return '/' + names.join('/');
+}
+
+void FileTagTrie::collect(const Node *node, const QString &path, QHash<QString, QStringList> *result) const
+{
+    if (!node->tags.isEmpty())
+        result->insert(path, node->tags);
+    for (auto it = node->children.cbegin(); it != node->children.cend(); ++it)
+        collect(it.value(), path + '/' + it.key(), result);
+}
+
+void FileTagTrie::setNodeTags(Node *node, const QStringList &tags)
+{
+    if (node->tags.isEmpty() != tags.isEmpty())
+        taggedCount += tags.isEmpty() ? -1 : 1;
+
+    for (const QString &tag : std::as_const(node->tags)) {
+        auto it = postings.find(tag);
+        if (it == postings.end())
+            continue;
+        it->remove(node);
+        if (it->isEmpty())
+            postings.erase(it);
+    }
+
+    node->tags = tags;
+    for (const QString &tag : tags)
+        postings[tag].insert(node);
+}
+
+void FileTagTrie::merge(Node *from, Node *to)
+{
+    if (!from->tags.isEmpty()) {
+        QStringList tags = to->tags;
+        for (const QString &tag : std::as_const(from->tags)) {
+            if (!tags.contains(tag))
+                tags.append(tag);
+        }
+        setNodeTags(from, {});
+        setNodeTags(to, tags);
+    }
+
+    for (auto it = from->children.begin(); it != from->children.end(); ++it) {
+        Node *child = it.value();
+        if (Node *existing = to->children.value(it.key())) {
+            merge(child, existing);
+            delete child;
+        } else {
+            child->parent = to;
+            to->children.insert(it.key(), child);
+        }
+    }
+    from->children.clear();
+}
+
+void FileTagTrie::destroy(Node *node)
+{
+    for (Node *child : std::as_const(node->children))
+        destroy(child);
+    setNodeTags(node, {});
+    delete node;
+}
+
+void FileTagTrie::prune(Node *node)
+{
+    // 删除不再带标记的空分支
+    while (node != &root && node->tags.isEmpty() && node->children.isEmpty()) {
+        Node *parent = node->parent;
+        parent->children.remove(node->name);
+        delete node;
+        node = parent;
+    }
+}
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FILETAGTRIE_H
+#define FILETAGTRIE_H
+
+#include "dfmplugin_tag_global.h"
+
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+
+namespace dfmplugin_tag {
+
+/*!
+ * \brief 按路径分量组织的文件标记树
+ *
+ * 查找和修改一个文件的标记是 O(路径深度)，目录下的标记文件只遍历该子树，
+ * 目录移动和删除只摘下并挂接子树。另维护标记名到节点的倒排表，
+ * 按标记查询文件不需要扫描全部文件。不是线程安全的，由调用方加锁。
+ */
+class FileTagTrie
+{
+    Q_DISABLE_COPY(FileTagTrie)
+
+public:
+    FileTagTrie();
+    ~FileTagTrie();
+
+    void clear();
+    int fileCount() const;
+
+    QStringList tags(const QString &path) const;
+    // tags 为空时移除该文件
+    void setTags(const QString &path, const QStringList &tags);
+
+    // parentPath 下所有带标记的文件（不含 parentPath 本身）
+    QHash<QString, QStringList> children(const QString &parentPath) const;
+    QStringList filesWithTag(const QString &tag) const;
+    void renameTag(const QString &oldName, const QString &newName);
+
+    // 移动 from 及其下所有文件的标记到 to，to 已有标记时合并
+    void moveSubtree(const QString &from, const QString &to);
+    void removeSubtree(const QString &path);
+
+private:
+    struct Node
+    {
+        QString name;
+        Node *parent { nullptr };
+        QHash<QString, Node *> children;
+        QStringList tags;
+    };
+
+    Node *find(const QString &path) const;
+    Node *findOrCreate(const QStringList &components);
+    QString pathOf(const Node *node) const;
+    void collect(const Node *node, const QString &path, QHash<QString, QStringList> *result) const;
+    void setNodeTags(Node *node, const QStringList &tags);
+    void merge(Node *from, Node *to);
+    void destroy(Node *node);
+    void prune(Node *node);
+
+    Node root;
+    QHash<QString, QSet<Node *>> postings;   // tag name -> tagged nodes
+    int taggedCount { 0 };
+};
+
+}
+
+#endif   // FILETAGTRIE_H
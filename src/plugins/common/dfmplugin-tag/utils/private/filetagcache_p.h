@@ -6,6 +6,7 @@
 #define FILETAGCACHE_P_H
 
 #include "utils/filetagcache.h"
+#include "utils/filetagtrie.h"
 
 #include <QReadWriteLock>
 #include <QMutex>
@@ -17,7 +18,8 @@ class FileTagCachePrivate
     friend class FileTagCache;
     FileTagCache *const q;
 
-    QHash<QString, QVariant> fileTagsCache;   // file path ->  tag name list
+    FileTagTrie fileTags;   // file path ->  tag name list
+    bool loaded { false };
     QHash<QString, QColor> tagProperty;   // tag name -> QColor
     QHash<QString, QVariant> trashFileTagsCache;   // "path:inode" -> tag name list
     QReadWriteLock lock;
@@ -25,6 +27,10 @@ class FileTagCachePrivate
 public:
     explicit FileTagCachePrivate(FileTagCache *qq);
     virtual ~FileTagCachePrivate();
+
+    // 调用方持有写锁
+    void tagFile(const QString &path, const QStringList &tags);
+    void untagFile(const QString &path, const QStringList &tags);
 };
 }
 
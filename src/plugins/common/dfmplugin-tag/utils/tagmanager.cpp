@@ -294,6 +294,11 @@ QStringList TagManager::getFilesByTag(const QString &tag)
     if (tag.isEmpty())
         return {};
 
+    // 缓存已加载时由倒排表回答，不再查询服务
+    QStringList files;
+    if (FileTagCacheIns.getFilesByTag(tag, &files))
+        return files;
+
     const auto &dataMap = TagProxyHandleIns->getFilesThroughTag({ tag });
     if (dataMap.isEmpty())
         return {};
@@ -483,6 +488,19 @@ bool TagManager::removeChildren(const QString &parentPath)
     return ret;
 }
 
+void TagManager::moveChildrenCache(const QString &fromPath, const QString &toPath)
+{
+    const auto &fromUrl = FileUtils::bindUrlTransform(QUrl::fromLocalFile(fromPath));
+    const auto &toUrl = FileUtils::bindUrlTransform(QUrl::fromLocalFile(toPath));
+    FileTagCacheIns.moveTaggedFiles(fromUrl.path(), toUrl.path());
+}
+
+void TagManager::removeChildrenCache(const QString &parentPath)
+{
+    const auto &url = FileUtils::bindUrlTransform(QUrl::fromLocalFile(parentPath));
+    FileTagCacheIns.removeTaggedFiles(url.path());
+}
+
 bool TagManager::saveTrashFileTags(const QString &originalPath, qint64 fileInode, const QStringList &tagNames)
 {
     if (originalPath.isEmpty() || fileInode <= 0 || tagNames.isEmpty())
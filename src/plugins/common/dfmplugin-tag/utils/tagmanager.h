@@ -62,6 +62,9 @@ public:
     bool changeTagColor(const QString &tagName, const QString &newTagColor);
     bool changeTagName(const QString &tagName, const QString &newName);
     bool removeChildren(const QString &parentPath);
+    // 目录移动或删除后直接更新缓存中的子树，服务随后的逐个文件通知不再改变缓存
+    void moveChildrenCache(const QString &fromPath, const QString &toPath);
+    void removeChildrenCache(const QString &parentPath);
 
     // tag trash
     bool saveTrashFileTags(const QString &originalPath, qint64 fileInode, const QStringList &tagNames);
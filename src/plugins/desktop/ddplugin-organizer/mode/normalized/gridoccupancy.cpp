@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gridoccupancy.h"
+
+#include <algorithm>
+
+using namespace ddplugin_organizer;
+
+GridOccupancy::GridOccupancy(const QSize &table)
+    : table(table.expandedTo({ 0, 0 })),
+      cells(this->table.width() * this->table.height(), 0)
+{
+}
+
+QSize GridOccupancy::tableSize() const
+{
+    return table;
+}
+
+void GridOccupancy::occupy(const QRect &rect)
+{
+    // the parts out of the table can never be hit by a candidate
+    const QRect clipped = rect.intersected({ QPoint(0, 0), table });
+    if (clipped.isEmpty())
+        return;
+
+    for (int y = clipped.top(); y <= clipped.bottom(); ++y) {
+        quint8 *row = cells.data() + y * table.width();
+        std::fill(row + clipped.left(), row + clipped.right() + 1, quint8(1));
+    }
+    dirty = true;
+}
+
+bool GridOccupancy::isFree(const QRect &rect) const
+{
+    const QRect clipped = rect.intersected({ QPoint(0, 0), table });
+    if (clipped.isEmpty())
+        return true;
+
+    updateSums();
+    const int x1 = clipped.left();
+    const int y1 = clipped.top();
+    const int x2 = clipped.right() + 1;
+    const int y2 = clipped.bottom() + 1;
+    return sumAt(x2, y2) - sumAt(x1, y2) - sumAt(x2, y1) + sumAt(x1, y1) == 0;
+}
+
+bool GridOccupancy::findFree(QRect &item) const
+{
+    // from UP to DOWN, RIGHT to LEFT, as the collections are placed by default
+    for (int x = table.width() - item.width(); x >= 0; --x) {
+        for (int y = 0; y <= table.height() - item.height(); ++y) {
+            item.moveTopLeft({ x, y });
+            if (isFree(item))
+                return true;
+        }
+    }
+    return false;
+}
+
+int GridOccupancy::sumAt(int x, int y) const
+{
+    return sums.at(y * (table.width() + 1) + x);
+}
+
+void GridOccupancy::updateSums() const
+{
+    if (!dirty)
+        return;
+
+    const int stride = table.width() + 1;
+    sums.fill(0, stride * (table.height() + 1));
+    for (int y = 0; y < table.height(); ++y) {
+        int rowSum = 0;
+        for (int x = 0; x < table.width(); ++x) {
+            rowSum += cells.at(y * table.width() + x);
+            sums[(y + 1) * stride + x + 1] = sums.at(y * stride + x + 1) + rowSum;
+        }
+    }
+    dirty = false;
+}
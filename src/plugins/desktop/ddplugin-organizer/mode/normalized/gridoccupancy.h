@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef GRIDOCCUPANCY_H
+#define GRIDOCCUPANCY_H
+
+#include "ddplugin_organizer_global.h"
+
+#include <QRect>
+#include <QVector>
+
+namespace ddplugin_organizer {
+
+/*!
+ * \brief The occupied cells of a surface grid, to place collections
+ *
+ * The occupied rects are rasterized once, then a summed-area table answers
+ * whether a rect is free in constant time, whatever the count of collections.
+ */
+class GridOccupancy
+{
+public:
+    explicit GridOccupancy(const QSize &table);
+    QSize tableSize() const;
+    void occupy(const QRect &rect);
+    bool isFree(const QRect &rect) const;
+    bool findFree(QRect &item) const;
+
+private:
+    int sumAt(int x, int y) const;
+    void updateSums() const;
+
+    QSize table;
+    QVector<quint8> cells;
+    mutable QVector<int> sums;   // (width + 1) * (height + 1), row and column 0 are zero
+    mutable bool dirty { true };
+};
+
+}
+
+#endif   // GRIDOCCUPANCY_H
@@ -9,6 +9,7 @@
 #include "fileclassifier.h"
 #include "collection/collectionholder.h"
 #include "normalizedmodebroker.h"
+#include "gridoccupancy.h"
 #include "models/itemselectionmodel.h"
 #include "mode/selectionsynchelper.h"
 
@@ -32,6 +33,7 @@ public:
     void connectCollectionSignals(CollectionHolderPointer collection);
 
     bool tryPlaceRect(QRect &item, const QList<QRect> &inSeats, const QSize &table);
+    GridOccupancy surfaceOccupancy(Surface *surface) const;
 
     QString generateScreenConfigId();
 
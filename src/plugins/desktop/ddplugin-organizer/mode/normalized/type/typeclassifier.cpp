@@ -139,6 +139,10 @@ QStringList TypeClassifier::classes() const
 
 QString TypeClassifier::classify(const QUrl &url) const
 {
+    auto cached = d->categoryCache.constFind(url);
+    if (cached != d->categoryCache.cend())
+        return cached.value();
+
     auto itemInfo = InfoFactory::create<FileInfo>(url);
     if (!itemInfo)
         return QString();   // must return null string to represent the file is not existed.
@@ -207,6 +211,7 @@ QString TypeClassifier::classify(const QUrl &url) const
         key = kTypeKeyOth;
     }
 
+    d->categoryCache.insert(url, key);
     return key;
 }
 
@@ -215,6 +220,20 @@ QString TypeClassifier::className(const QString &key) const
     return d->keyNames.value(key);
 }
 
+void TypeClassifier::reset(const QList<QUrl> &urls)
+{
+    // drop the files that are gone, the others keep their category
+    const QSet<QUrl> current(urls.cbegin(), urls.cend());
+    for (auto it = d->categoryCache.begin(); it != d->categoryCache.end();) {
+        if (current.contains(it.key()))
+            ++it;
+        else
+            it = d->categoryCache.erase(it);
+    }
+
+    FileClassifier::reset(urls);
+}
+
 bool TypeClassifier::updateClassifier()
 {
     const auto tmp = d->categories;
@@ -224,6 +243,9 @@ bool TypeClassifier::updateClassifier()
 
 QString TypeClassifier::replace(const QUrl &oldUrl, const QUrl &newUrl)
 {
+    // the name is changed, so may the type
+    d->categoryCache.remove(oldUrl);
+    d->categoryCache.remove(newUrl);
     if (!classes().contains(classify(newUrl)))
         return classify(newUrl);
     return FileClassifier::replace(oldUrl, newUrl);
@@ -231,6 +253,8 @@ QString TypeClassifier::replace(const QUrl &oldUrl, const QUrl &newUrl)
 
 QString TypeClassifier::append(const QUrl &url)
 {
+    // a new file may reuse the url of a deleted one
+    d->categoryCache.remove(url);
     if (!classes().contains(classify(url)))
         return classify(url);
     return FileClassifier::append(url);
@@ -238,6 +262,7 @@ QString TypeClassifier::append(const QUrl &url)
 
 QString TypeClassifier::prepend(const QUrl &url)
 {
+    d->categoryCache.remove(url);
     if (!classes().contains(classify(url)))
         return classify(url);
     return FileClassifier::prepend(url);
@@ -247,11 +272,14 @@ QString TypeClassifier::remove(const QUrl &url)
 {
     // 当此接口被调用时，文件可能已经被真正的移除了
     // 因此无法通过创建文件信息判断类型
+    d->categoryCache.remove(url);
     return FileClassifier::remove(url);
 }
 
 QString TypeClassifier::change(const QUrl &url)
 {
+    // the content is changed, the MIME type may be different
+    d->categoryCache.remove(url);
     if (!classes().contains(classify(url)))
         return classify(url);
     return FileClassifier::change(url);
@@ -26,6 +26,7 @@ public:
     QString classify(const QUrl &) const override;
     QString className(const QString &key) const override;
     bool updateClassifier() override;
+    void reset(const QList<QUrl> &) override;
 
 public:
     QString replace(const QUrl &oldUrl, const QUrl &newUrl) override;
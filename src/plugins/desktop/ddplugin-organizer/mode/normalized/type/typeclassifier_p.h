@@ -24,6 +24,8 @@ public:
     const QSet<QString> vidSuffix;
     const QSet<QString> appSuffix;
     //const QSet<QString> appMimeType;
+    // 文件类型只随文件名或内容（MIME）变化，缓存后重排时无需再次查询文件信息
+    mutable QHash<QUrl, QString> categoryCache;
 private:
     TypeClassifier *q;
 };
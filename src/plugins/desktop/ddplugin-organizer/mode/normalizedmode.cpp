@@ -54,14 +54,13 @@ QPoint NormalizedModePrivate::findValidPos(int &currentIndex, const int width, c
     Q_ASSERT(sur);
 
     auto gridSize = sur->gridSize();
+    const GridOccupancy occupancy = surfaceOccupancy(sur.data());
 
     QPoint pos(-1, -1);
     // from UP to DOWN, RIGHT to LEFT, search an area to place the collection
     for (int x = gridSize.width() - width; x >= 0; --x) {
         for (int y = 0; y < gridSize.height() - height; ++y) {
-            QRect gridR { x, y, width, height };
-            auto screenR = sur->mapToPixelSize(gridR);
-            if (sur->isIntersected(screenR, nullptr))
+            if (!occupancy.isFree({ x, y, width, height }))
                 continue;
             pos = { x, y };
             x = -1;   // break outside loop.
@@ -245,22 +244,35 @@ void NormalizedModePrivate::connectCollectionSignals(CollectionHolderPointer col
 
 bool NormalizedModePrivate::tryPlaceRect(QRect &item, const QList<QRect> &inSeats, const QSize &table)
 {
-    auto isIntersects = [](const QRect &item, const QList<QRect> &items) -> bool {
-        for (auto rect : items) {
-            if (rect.intersects(item))
-                return true;
-        }
-        return false;
+    GridOccupancy occupancy(table);
+    for (const QRect &seat : inSeats)
+        occupancy.occupy(seat);
+    return occupancy.findFree(item);
+}
+
+GridOccupancy NormalizedModePrivate::surfaceOccupancy(Surface *surface) const
+{
+    GridOccupancy occupancy(surface->gridSize());
+    const int cell = Surface::cellWidth();
+    const QPoint offset = surface->gridOffset();
+    // a grid cell is hit if any of its pixels is covered by a frame, see Surface::isIntersected
+    auto toCell = [cell](int pixel) {
+        return pixel >= 0 ? pixel / cell : -((-pixel + cell - 1) / cell);
     };
 
-    for (int x = table.width() - item.width(); x >= 0; --x) {
-        for (int y = 0; y <= table.height() - item.height(); ++y) {
-            item.moveTopLeft({ x, y });
-            if (!isIntersects(item, inSeats))
-                return true;
-        }
+    for (QObject *child : surface->children()) {
+        auto frame = dynamic_cast<QWidget *>(child);
+        if (!frame || frame->property("ignore_collision").toBool())
+            continue;
+
+        const QRect geo = frame->geometry();
+        if (geo.isEmpty())
+            continue;
+        const QPoint topLeft(toCell(geo.left() - offset.x()), toCell(geo.top() - offset.y()));
+        const QPoint bottomRight(toCell(geo.right() - offset.x()), toCell(geo.bottom() - offset.y()));
+        occupancy.occupy(QRect(topLeft, bottomRight));
     }
-    return false;
+    return occupancy;
 }
 
 void NormalizedModePrivate::onSelectFile(QList<QUrl> &urls, int flag)
@@ -664,12 +676,15 @@ void NormalizedMode::layout()
 
     //      1.2 make sure all orphan rects can be placed on surface 0
     if (orphanRects.count() > 0 && surfaces.count() > 0 && !surfaceRelayout.contains(0)) {
+        GridOccupancy occupancy(surfaces[0]->gridSize());
+        for (const QRect &seat : rectsOnSurface0)
+            occupancy.occupy(seat);
         for (auto &orphan : orphanRects) {
-            if (!d->tryPlaceRect(orphan, rectsOnSurface0, surfaces[0]->gridSize())) {
+            if (!occupancy.findFree(orphan)) {
                 surfaceRelayout.insert(0, true);
                 break;
             }
-            rectsOnSurface0.append(orphan);
+            occupancy.occupy(orphan);
         }
     }
 
@@ -687,6 +702,7 @@ void NormalizedMode::layout()
     // screen num is start with 1
     static constexpr char kPropertyReLayout[] = "re-layout";
     int screenIdx = 1;
+    bool styleChanged = false;
     QList<CollectionStyle> toSave;
     for (int i = 0; i < holders.count(); ++i) {
         const CollectionHolderPointer &holder = holders.at(i);
@@ -737,13 +753,20 @@ void NormalizedMode::layout()
                      << "offset:" << offset << "rect changed from" << oldRect << "to" << style.rect;
         }
 
-        holder->setSurface(surfaces.at(style.screenIndex - 1).data());
-        holder->setStyle(style);
-        holder->show();
+        // reparenting and resizing a collection is the expensive part, skip those already in place
+        Surface *surface = surfaces.at(style.screenIndex - 1).data();
+        const CollectionStyle current = holder->style();
+        if (holder->surface() != surface || current.screenIndex != style.screenIndex
+            || current.rect != style.rect || current.sizeMode != style.sizeMode) {
+            holder->setSurface(surface);
+            holder->setStyle(style);
+            holder->show();
+            styleChanged = true;
+        }
         toSave << style;
     }
 
-    if (!toSave.isEmpty()) {
+    if (!toSave.isEmpty() && (styleChanged || !CfgPresenter->hasConfigId(configId))) {
         CfgPresenter->writeNormalStyle(configId, toSave);
     }
     // save new screen resolutions.
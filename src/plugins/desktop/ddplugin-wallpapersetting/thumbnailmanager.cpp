@@ -12,6 +12,10 @@
 #include <QDir>
 #include <QtConcurrent>
 #include <QImageReader>
+#include <QCryptographicHash>
+#include <QDateTime>
+
+#include <algorithm>
 
 using namespace ddplugin_wallpapersetting;
 
@@ -25,15 +29,18 @@ ThumbnailManager::ThumbnailManager(qreal _scale, QObject *parent)
     cacheDir = DFMIO::DFMUtils::buildFilePath(cacheDir.toStdString().c_str(),
                                               "wallpaperthumbnail", QString::number(scale).toStdString().c_str(), nullptr);
 
-    connect(&futureWatcher, &QFutureWatcher<QPixmap>::finished, this, &ThumbnailManager::onProcessFinished, Qt::QueuedConnection);
+    // decoding is mostly cpu bound, leave some cores for the ui and the rest of the desktop
+    maxRunning = qBound(2, QThread::idealThreadCount() / 2, 4);
 
     QDir::root().mkpath(cacheDir);
 }
 
 ThumbnailManager::~ThumbnailManager()
 {
-    if (!queuedRequests.isEmpty())
-        emit findAborted(queuedRequests);
+    QQueue<QString> aborted;
+    aborted << runningRequests.keys() << queuedRequests;
+    if (!aborted.isEmpty())
+        emit findAborted(aborted);
 }
 
 ThumbnailManager *ThumbnailManager::instance(qreal scale)
@@ -53,36 +60,65 @@ ThumbnailManager *ThumbnailManager::instance(qreal scale)
 
 void ThumbnailManager::find(const QString &key)
 {
-    QString file = QDir(cacheDir).absoluteFilePath(key);
-    const QPixmap pixmap(file);
+    const QPixmap pixmap(cacheFile(key));
     if (!pixmap.isNull()) {
         emit thumbnailFounded(key, pixmap);
         return;
     }
 
+    // the result is broadcast to every item, one request per key is enough
+    if (runningRequests.contains(key) || queuedRequests.contains(key))
+        return;
+
     queuedRequests << key;
+    processNextReq();
+}
 
-    // first item, start
-    if (queuedRequests.size() == 1)
-        processNextReq();
+void ThumbnailManager::prioritize(const QStringList &keys)
+{
+    // move to the front keeping their order, e.g. the items scrolled into view
+    for (auto it = keys.crbegin(); it != keys.crend(); ++it) {
+        if (queuedRequests.removeOne(*it))
+            queuedRequests.prepend(*it);
+    }
 }
 
 void ThumbnailManager::stop()
 {
-    futureWatcher.cancel();
+    // a running decode cannot be interrupted, drop its result
+    for (QFutureWatcher<QPixmap> *watcher : runningRequests) {
+        disconnect(watcher, nullptr, this, nullptr);
+        if (watcher->isFinished())
+            watcher->deleteLater();
+        else
+            connect(watcher, &QFutureWatcher<QPixmap>::finished, watcher, &QObject::deleteLater);
+    }
+    runningRequests.clear();
     queuedRequests.clear();
 }
 
 bool ThumbnailManager::replace(const QString &key, const QPixmap &pixmap)
 {
-    QString file = QDir(cacheDir).absoluteFilePath(key);
-    if (QFile::exists(file)) {
-        QFile(file).remove();
-    }
+    const QString file = cacheFile(key);
+
+    // thumbnails of the older versions of the source
+    const QString prefix = QFileInfo(file).fileName().section('-', 0, 0);
+    QDir dir(cacheDir);
+    for (const QString &old : dir.entryList({ prefix + "-*" }, QDir::Files))
+        dir.remove(old);
 
     return pixmap.save(file);
 }
 
+QString ThumbnailManager::cacheFile(const QString &key) const
+{
+    // cacheDir is per scale, the name changes with the source mtime so an edited wallpaper is regenerated
+    const QString realPath = QUrl(QUrl::fromPercentEncoding(key.toUtf8())).toLocalFile();
+    const qint64 mtime = QFileInfo(realPath).lastModified().toSecsSinceEpoch();
+    const QByteArray hash = QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Md5).toHex();
+    return QDir(cacheDir).absoluteFilePath(QString("%1-%2.png").arg(QString::fromLatin1(hash)).arg(mtime));
+}
+
 QPixmap ThumbnailManager::thumbnailImage(const QString &key, qreal scale)
 {
     ThumbnailManager *tnm = ThumbnailManager::instance(scale);
@@ -90,19 +126,9 @@ QPixmap ThumbnailManager::thumbnailImage(const QString &key, qreal scale)
     const QString realPath = QUrl(QUrl::fromPercentEncoding(key.toUtf8())).toLocalFile();
     const qreal ratio = scale;
 
-    QImageReader imageReader(realPath);
-    imageReader.setDecideFormatFromContent(true);
-    QImage image = imageReader.read();
     const int itemWidth = static_cast<int>(WallpaperList::kItemWidth * ratio);
     const int itemHeight = static_cast<int>(WallpaperList::kItemHeight * ratio);
-    QPixmap pix = QPixmap::fromImage(image.scaled(QSize(itemWidth, itemHeight), Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation));
-
-    const QRect r(0, 0, itemWidth, itemHeight);
-    const QSize size(itemWidth, itemHeight);
-
-    if (pix.width() > itemWidth || pix.height() > itemHeight)
-        pix = pix.copy(QRect(pix.rect().center() - r.center(), size));
-
+    QPixmap pix = QPixmap::fromImage(decodeThumbnail(realPath, QSize(itemWidth, itemHeight)));
     pix.setDevicePixelRatio(ratio);
 
     tnm->replace(key, pix);
@@ -110,25 +136,55 @@ QPixmap ThumbnailManager::thumbnailImage(const QString &key, qreal scale)
     return pix;
 }
 
+QImage ThumbnailManager::decodeThumbnail(const QString &path, const QSize &size)
+{
+    QImageReader imageReader(path);
+    imageReader.setDecideFormatFromContent(true);
+
+    // let the decoder downscale, a 8K jpeg is decoded at 1/8 instead of fully and scaled afterwards
+    const QSize sourceSize = imageReader.size();
+    if (sourceSize.isValid() && (sourceSize.width() > size.width() || sourceSize.height() > size.height()))
+        imageReader.setScaledSize(sourceSize.scaled(size, Qt::KeepAspectRatioByExpanding));
+
+    QImage image = imageReader.read();
+    if (image.isNull())
+        return image;
+
+    if (image.size() != size)
+        image = image.scaled(size, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+
+    const QRect r(0, 0, size.width(), size.height());
+    if (image.width() > size.width() || image.height() > size.height())
+        image = image.copy(QRect(image.rect().center() - r.center(), size));
+
+    return image;
+}
+
 void ThumbnailManager::onProcessFinished()
 {
-    if (futureWatcher.isCanceled())
+    auto watcher = static_cast<QFutureWatcher<QPixmap> *>(sender());
+    auto it = std::find(runningRequests.begin(), runningRequests.end(), watcher);
+    // stopped while the notification was queued
+    if (it == runningRequests.end())
         return;
 
-    emit thumbnailFounded(queuedRequests.front(), futureWatcher.result());
+    const QString key = it.key();
+    runningRequests.erase(it);
+    watcher->deleteLater();
 
-    queuedRequests.pop_front();
+    emit thumbnailFounded(key, watcher->result());
 
-    if (!queuedRequests.isEmpty())
-        processNextReq();
+    processNextReq();
 }
 
 void ThumbnailManager::processNextReq()
 {
-    Q_ASSERT(futureWatcher.isFinished());
-
-    const QString &item = queuedRequests.front();
+    while (runningRequests.size() < maxRunning && !queuedRequests.isEmpty()) {
+        const QString key = queuedRequests.dequeue();
 
-    QFuture<QPixmap> future = QtConcurrent::run(ThumbnailManager::thumbnailImage, item, scale);
-    futureWatcher.setFuture(future);
+        auto watcher = new QFutureWatcher<QPixmap>(this);
+        connect(watcher, &QFutureWatcher<QPixmap>::finished, this, &ThumbnailManager::onProcessFinished, Qt::QueuedConnection);
+        runningRequests.insert(key, watcher);
+        watcher->setFuture(QtConcurrent::run(ThumbnailManager::thumbnailImage, key, scale));
+    }
 }
@@ -11,6 +11,7 @@
 #include <QQueue>
 #include <QFutureWatcher>
 #include <QPixmap>
+#include <QHash>
 
 namespace ddplugin_wallpapersetting {
 
@@ -22,10 +23,13 @@ public:
     ~ThumbnailManager();
     static ThumbnailManager* instance(qreal scale);
     void find(const QString & key);
+    void prioritize(const QStringList &keys);
     void stop();
 protected:
     bool replace(const QString & key, const QPixmap & pixmap);
+    QString cacheFile(const QString &key) const;
     static QPixmap thumbnailImage(const QString &key, qreal scale);
+    static QImage decodeThumbnail(const QString &path, const QSize &size);
 signals:
     void thumbnailFounded(const QString &key, const QPixmap &pixmap);
     void findAborted(QQueue<QString> queue);
@@ -38,7 +42,8 @@ private:
 private:
     qreal scale;
     QString cacheDir;
-    QFutureWatcher<QPixmap> futureWatcher;
+    int maxRunning = 1;
+    QHash<QString, QFutureWatcher<QPixmap> *> runningRequests;
     QQueue<QString> queuedRequests;
 };
 
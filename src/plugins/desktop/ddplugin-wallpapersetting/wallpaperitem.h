@@ -71,6 +71,7 @@ public:
     QRect contentGeometry() const;
     QPushButton *addButton(const QString &id, const QString &text, const int btnWidth, int row, int column, int rowSpan, int columnSpan);
     void setEntranceIconOfSettings(const QString &id);
+    QString thumbnailKey() const;
 signals:
     void pressed(WallpaperItem *self);
     void hoverIn(WallpaperItem *self);
@@ -94,7 +95,6 @@ protected:
     void refindPixmap();
     void focusOnLastButton();
     void focusOnFirstButton();
-    QString thumbnailKey() const;
 
 private:
     void init();
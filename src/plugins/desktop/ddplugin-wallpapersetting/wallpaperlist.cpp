@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "wallpaperlist.h"
+#include "thumbnailmanager.h"
 
 #include <QScrollBar>
 #include <QToolButton>
@@ -387,12 +388,20 @@ void WallpaperList::updateItemThumb()
     showDeleteButtonForItem(static_cast<WallpaperItem *>(itemAt(mapFromGlobal(QCursor::pos()))));
     QRect r = rect();
     QRect cacheRect(r.x() - r.width(), r.y(), r.width() * 3, r.height());
+    QStringList visibleKeys;
     for (WallpaperItem *item : items) {
-        if (cacheRect.intersects(QRect(item->mapTo(this, QPoint()), item->size()))) {
+        const QRect itemRect(item->mapTo(this, QPoint()), item->size());
+        if (cacheRect.intersects(itemRect)) {
             item->renderPixmap();
+            if (item->enableThumbnail() && r.intersects(itemRect))
+                visibleKeys << item->thumbnailKey();
         }
     }
 
+    // the pages beside are prepared too, but after what the user is looking at
+    if (!visibleKeys.isEmpty())
+        ThumbnailManager::instance(devicePixelRatioF())->prioritize(visibleKeys);
+
     updateBothEndsItem();
 }
 
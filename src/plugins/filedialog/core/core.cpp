@@ -13,6 +13,7 @@
 #include <dfm-base/widgets/filemanagerwindowsmanager.h>
 #include <dfm-base/base/application/application.h>
 #include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 
 #include <QDBusError>
 #include <QDBusConnection>
@@ -86,6 +87,7 @@ void Core::onAllPluginsStarted()
 
     DFMBASE_NAMESPACE::Application::instance()->appSetting()->setReadOnly(true);
     DFMBASE_NAMESPACE::Application::instance()->appObtuselySetting()->setReadOnly(true);
+    DFMBASE_NAMESPACE::Application::fileViewStateStore()->setReadOnly(true);
 
     dfmplugin_menu_util::menuSceneRegisterScene(FileDialogMenuCreator::name(), new FileDialogMenuCreator);
     bindScene("WorkspaceMenu");
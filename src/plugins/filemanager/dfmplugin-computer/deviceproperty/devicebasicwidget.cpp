@@ -16,6 +16,7 @@ DeviceBasicWidget::DeviceBasicWidget(QWidget *parent)
 {
     initUI();
     fileCalculationUtils = new FileScanner;
+    fileCalculationUtils->setOptions(FileScanner::ScanOption::Parallel | FileScanner::ScanOption::UseSizeCache);
     connect(fileCalculationUtils, &FileScanner::progressChanged, this, &DeviceBasicWidget::slotFileDirSizeChange);
 }
 
@@ -16,13 +16,22 @@
 #include <dfm-base/mimetype/mimetypedisplaymanager.h>
 
 #include <QUuid>
+#include <QElapsedTimer>
+#include <QtConcurrent>
 
 #include <sys/stat.h>
 #include <algorithm>
+#include <utility>
 
 DFMBASE_USE_NAMESPACE
 DPSEARCH_USE_NAMESPACE
 
+// 每次交给排序的结果数，大量结果时视图可以尽早开始排序
+static constexpr int kResultChunkSize { 2000 };
+// 少量结果直接在当前线程stat
+static constexpr int kParallelStatThreshold { 64 };
+static constexpr int kMaxStatThreads { 4 };
+
 namespace dfmplugin_search {
 
 SearchDirIteratorPrivate::SearchDirIteratorPrivate(const QUrl &url, SearchDirIterator *qq)
@@ -86,6 +95,7 @@ void SearchDirIteratorPrivate::onMatched(const QString &id)
     if (taskId == id) {
         // 直接在主线程更新结果，但使用高效的双缓冲机制
         const auto &results = SearchManager::instance()->matchedResults(taskId);
+        withdrawResults(results);
         if (!results.isEmpty()) {
             resultBuffer.updateResults(results);
             hasConsumedResults.store(false, std::memory_order_release);   // 标记有新数据
@@ -97,6 +107,26 @@ void SearchDirIteratorPrivate::onMatched(const QString &id)
     }
 }
 
+void SearchDirIteratorPrivate::withdrawResults(const DFMSearchResultMap &results)
+{
+    // 每次通知都是全量结果，上次有而这次没有的被细化后的关键词过滤掉了
+    QList<QUrl> withdrawn;
+    for (const QUrl &url : std::as_const(matchedUrls)) {
+        if (!results.contains(url))
+            withdrawn.append(url);
+    }
+
+    matchedUrls.clear();
+    matchedUrls.reserve(results.size());
+    for (auto it = results.cbegin(); it != results.cend(); ++it)
+        matchedUrls.insert(it.key());
+
+    if (!withdrawn.isEmpty()) {
+        fmDebug() << "Search results withdrawn:" << withdrawn.size() << "taskId:" << taskId;
+        emit SearchManager::instance()->resultsWithdrawn(fileUrl, withdrawn);
+    }
+}
+
 void SearchDirIteratorPrivate::onSearchCompleted(const QString &id)
 {
     if (taskId == id) {
@@ -127,6 +157,7 @@ SearchDirIterator::SearchDirIterator(const QUrl &url,
       d(new SearchDirIteratorPrivate(url, this))
 {
     setProperty(IteratorProperty::kKeepOrder, true);
+    d->statPool.setMaxThreadCount(kMaxStatThreads);
 }
 
 SearchDirIterator::~SearchDirIterator()
@@ -165,52 +196,106 @@ QUrl SearchDirIterator::url() const
 
 QList<QSharedPointer<SortFileInfo>> SearchDirIterator::sortFileInfoList()
 {
-    QList<QSharedPointer<SortFileInfo>> result;
-
     // 确保搜索已经开始
     std::call_once(d->searchOnceFlag, [this]() {
         d->searchStoped.store(false, std::memory_order_release);
         emit this->sigSearch();
     });
 
-    // 等待搜索结果或搜索完成/停止
-    {
-        QMutexLocker lk(&d->waitMutex);
-        while ((d->resultBuffer.isEmpty() || d->hasConsumedResults.load(std::memory_order_acquire)) && !d->searchStoped.load(std::memory_order_acquire)) {
-            if (d->searchFinished.load(std::memory_order_acquire))
-                break;
-            d->resultWaitCond.wait(&d->waitMutex);
+    // 上一次补全的结果尚未发送完时直接发送下一批
+    if (d->pendingInfos.isEmpty()) {
+        // 等待搜索结果或搜索完成/停止
+        {
+            QMutexLocker lk(&d->waitMutex);
+            while ((d->resultBuffer.isEmpty() || d->hasConsumedResults.load(std::memory_order_acquire)) && !d->searchStoped.load(std::memory_order_acquire)) {
+                if (d->searchFinished.load(std::memory_order_acquire))
+                    break;
+                d->resultWaitCond.wait(&d->waitMutex);
+            }
         }
-    }
 
-    // 修复：搜索完成时，仍需检查是否有未消费的结果
-    // 只有在搜索完成且缓冲区为空且已消费过结果的情况下才返回空
-    if (d->searchFinished.load(std::memory_order_acquire) && d->resultBuffer.isEmpty() && d->hasConsumedResults.load(std::memory_order_acquire))
-        return {};
+        // 修复：搜索完成时，仍需检查是否有未消费的结果
+        // 只有在搜索完成且缓冲区为空且已消费过结果的情况下才返回空
+        if (d->searchFinished.load(std::memory_order_acquire) && d->resultBuffer.isEmpty() && d->hasConsumedResults.load(std::memory_order_acquire))
+            return {};
+
+        const auto results = d->resultBuffer.consumeResults();
+        // 标记结果已被消费，避免重复处理；补全期间到达的新结果不会被覆盖
+        d->hasConsumedResults.store(true, std::memory_order_release);
+
+        // 如果没有新结果且搜索已完成，返回空
+        if (results.isEmpty() && d->searchFinished.load(std::memory_order_acquire))
+            return {};
 
-    const auto results = d->resultBuffer.consumeResults();
+        d->pendingInfos = createSortInfos(results);
+    }
+
+    if (d->pendingInfos.size() <= kResultChunkSize)
+        return std::exchange(d->pendingInfos, {});
 
-    // 如果没有新结果且搜索已完成，返回空
-    if (results.isEmpty() && d->searchFinished.load(std::memory_order_acquire))
-        return {};
+    QList<SortInfoPointer> chunk = d->pendingInfos.mid(0, kResultChunkSize);
+    d->pendingInfos.remove(0, kResultChunkSize);
+    return chunk;
+}
 
-    QList<QSharedPointer<SortFileInfo>> files;
-    // 预分配空间以提高性能
-    files.reserve(results.size());
+QList<SortInfoPointer> SearchDirIterator::createSortInfos(const DFMSearchResultMap &results)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QList<SortInfoPointer> infos;
+    QList<SortInfoPointer> incomplete;
+    infos.reserve(results.size());
+    // 只记录本次全量结果中的条目，被撤回的结果不再占用，再次出现时重新发送
+    QHash<QUrl, QString> delivered;
+    delivered.reserve(results.size());
     for (auto it = results.begin(); it != results.end(); ++it) {
+        delivered.insert(it.key(), it->highlightedContent());
+
+        // 每次通知都是全量结果，已发送且未变化的不再重复补全
+        auto previous = d->deliveredResults.constFind(it.key());
+        if (previous != d->deliveredResults.cend() && previous.value() == it->highlightedContent())
+            continue;
+
         auto sortInfo = QSharedPointer<SortFileInfo>(new SortFileInfo());
         sortInfo->setUrl(it.key());
         sortInfo->setHighlightContent(it->highlightedContent());
-        doCompleteSortInfo(sortInfo);
-        files.append(sortInfo);
-    }
 
-    result.append(files);
+        if (it->hasMetadata()) {
+            const DFMSearchFileMetadata &metadata = it->metadata();
+            sortInfo->setSize(metadata.size);
+            sortInfo->setFile(metadata.isFile);
+            sortInfo->setDir(metadata.isDir);
+            sortInfo->setSymlink(metadata.isSymlink);
+            sortInfo->setHide(metadata.isHidden);
+            sortInfo->setReadable(metadata.readable);
+            sortInfo->setWriteable(metadata.writable);
+            sortInfo->setExecutable(metadata.executable);
+            sortInfo->setLastReadTime(metadata.lastRead);
+            sortInfo->setLastModifiedTime(metadata.lastModified);
+            sortInfo->setCreateTime(metadata.created);
+            sortInfo->setInfoCompleted(true);
+        } else {
+            incomplete.append(sortInfo);
+        }
+
+        infos.append(sortInfo);
+    }
+    d->deliveredResults.swap(delivered);
 
-    // 标记结果已被消费，避免重复处理
-    d->hasConsumedResults.store(true, std::memory_order_release);
+    // 只stat后端没有提供元数据的结果
+    if (incomplete.size() > kParallelStatThreshold) {
+        QtConcurrent::blockingMap(&d->statPool, incomplete, [this](SortInfoPointer &sortInfo) {
+            doCompleteSortInfo(sortInfo);
+        });
+    } else {
+        for (auto &sortInfo : incomplete)
+            doCompleteSortInfo(sortInfo);
+    }
 
-    return result;
+    fmDebug() << "Search results completed - new:" << infos.size() << "of" << results.size()
+              << "stat:" << incomplete.size() << "cost:" << timer.elapsed() << "ms";
+    return infos;
 }
 
 void SearchDirIterator::close()
@@ -233,7 +318,7 @@ bool SearchDirIterator::isWaitingForUpdates() const
 
     // We are waiting for updates if the search is not finished yet,
     // OR if the search is finished but there are still results in the buffer.
-    const bool hasPendingResults = !d->resultBuffer.isEmpty();
+    const bool hasPendingResults = !d->resultBuffer.isEmpty() || !d->pendingInfos.isEmpty();
     const bool isSearchInProgress = !d->searchFinished.load(std::memory_order_acquire);
     return !d->taskId.isEmpty()
             && (isSearchInProgress || hasPendingResults)
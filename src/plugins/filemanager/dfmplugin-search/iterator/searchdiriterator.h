@@ -6,6 +6,7 @@
 #define SEARCHDIRITERATOR_H
 
 #include "dfmplugin_search_global.h"
+#include "searchmanager/searcher/searchresult_define.h"
 
 #include <dfm-base/interfaces/abstractdiriterator.h>
 
@@ -41,6 +42,7 @@ signals:
 
 private:
     SearchDirIteratorPrivate *const d { nullptr };
+    QList<SortInfoPointer> createSortInfos(const DFMSearchResultMap &results);
     void doCompleteSortInfo(SortInfoPointer sortInfo);
 };
 
@@ -17,6 +17,9 @@
 #include <QMutex>
 #include <QScopedPointer>
 #include <QWaitCondition>
+#include <QThreadPool>
+#include <QHash>
+#include <QSet>
 #include <atomic>
 #include <mutex>
 
@@ -60,6 +63,7 @@ public:
 
 private:
     void initConnect();
+    void withdrawResults(const DFMSearchResultMap &results);
 
 public Q_SLOTS:
     void doSearch();
@@ -84,6 +88,12 @@ public:
     QWaitCondition resultWaitCond;
     mutable QMutex waitMutex;   // 只用于等待条件的轻量级锁
     std::atomic<bool> hasConsumedResults { false };   // 标记结果是否已被消费(原子操作保证线程安全)
+    QSet<QUrl> matchedUrls;   // 主线程：上一次通知的全量结果
+
+    // 以下只在遍历线程中访问
+    QList<SortInfoPointer> pendingInfos;   // 已补全但尚未发送的结果，分批发送
+    QHash<QUrl, QString> deliveredResults;   // 已发送且仍在全量结果中的结果及其高亮内容
+    QThreadPool statPool;   // 补全缺少元数据的结果，限制并发避免压垮慢速设备
 };
 
 }
@@ -63,6 +63,30 @@ void MainController::stop(QString taskId)
     }
 }
 
+bool MainController::refineTask(const QString &oldTaskId, const QString &taskId, const QString &keyword)
+{
+    auto task = taskManager.value(oldTaskId);
+    if (!task || taskManager.contains(taskId) || !task->refine(taskId, keyword))
+        return false;
+
+    fmInfo() << "refine task: " << oldTaskId << "->" << taskId << "keyword:" << keyword;
+    taskManager.remove(oldTaskId);
+    taskManager.insert(taskId, task);
+    return true;
+}
+
+bool MainController::isRefinable(const QString &taskId) const
+{
+    auto task = taskManager.value(taskId);
+    return task && task->isRefinable();
+}
+
+bool MainController::pauseTask(const QString &taskId)
+{
+    auto task = taskManager.value(taskId);
+    return task && task->pause();
+}
+
 DFMSearchResultMap MainController::getResults(QString taskId)
 {
     if (taskManager.contains(taskId))
@@ -23,6 +23,10 @@ private:
 
     bool doSearchTask(QString taskId, const QUrl &url, const QString &keyword);
     void stop(QString taskId);
+    // 将 oldTaskId 的搜索细化为新关键词并以 taskId 继续，不可细化时返回false
+    bool refineTask(const QString &oldTaskId, const QString &taskId, const QString &keyword);
+    bool isRefinable(const QString &taskId) const;
+    bool pauseTask(const QString &taskId);
     
     // 获取统一的搜索结果
     DFMSearchResultMap getResults(QString taskId);
@@ -51,6 +51,12 @@ void SimplifiedSearchWorker::startSearch()
     // 重置状态
     isRunning = true;
     finishedSearcherCount = 0;
+    refinable = false;
+    pausable = false;
+    refineRegex = QRegularExpression();
+    refined = false;
+    firstResultReported = false;
+    firstResultTimer.start();
 
     {
         QWriteLocker locker(&rwLock);
@@ -59,18 +65,78 @@ void SimplifiedSearchWorker::startSearch()
 
     // 创建搜索器并启动搜索
     createSearchers();
+    updatePausable();
 }
 
 void SimplifiedSearchWorker::stopSearch()
 {
     isRunning = false;
+    pausable = false;
 
     cleanupSearchers();
 }
 
+void SimplifiedSearchWorker::refineSearch(const QString &id, const QString &keyword)
+{
+    taskId = id;
+    searchKeyword = keyword;
+    refined = true;
+    firstResultReported = false;
+    firstResultTimer.start();
+
+    // 仍在运行的搜索器继续使用原关键词（结果是新关键词的超集），合并时再过滤
+    refineRegex = QRegularExpression(SearchHelper::instance()->checkWildcardAndToRegularExpression(keyword),
+                                     QRegularExpression::CaseInsensitiveOption);
+    for (auto searcher : searchers) {
+        if (auto iteratorSearcher = qobject_cast<IteratorSearcher *>(searcher)) {
+            iteratorSearcher->refine(keyword);
+            iteratorSearcher->resume();
+        }
+    }
+
+    int count = 0;
+    int removed = 0;
+    {
+        QWriteLocker locker(&rwLock);
+        removed = resultMap.size();
+        for (auto it = resultMap.begin(); it != resultMap.end();) {
+            if (refineRegex.match(it->matchedName()).hasMatch())
+                ++it;
+            else
+                it = resultMap.erase(it);
+        }
+        count = resultMap.size();
+        removed -= count;
+    }
+
+    fmInfo() << "Refine search task:" << taskId << "keyword:" << keyword << "kept results:" << count
+             << "still searching:" << !searchers.isEmpty();
+
+    // 结果全部被过滤时也要通知，视图据此撤回已显示的结果
+    if (count > 0 || removed > 0)
+        notifyResults();
+
+    // 原搜索已完成，过滤后的结果就是最终结果
+    if (searchers.isEmpty())
+        emit searchCompleted(taskId);
+}
+
+void SimplifiedSearchWorker::pauseSearch()
+{
+    for (auto searcher : searchers) {
+        if (auto iteratorSearcher = qobject_cast<IteratorSearcher *>(searcher))
+            iteratorSearcher->pause();
+    }
+
+    fmDebug() << "Pause search task:" << taskId << "searchers:" << searchers.size();
+}
+
 void SimplifiedSearchWorker::createSearchers()
 {
     if (DFMSearcher::supportUrl(searchUrl)) {
+        // 由 createSearchersForUrl 根据实际的搜索方式确定
+        refinable = true;
+
         const QString &searchPath = DFMSearcher::realSearchPath(searchUrl);
         const QStringList &indexedPaths = DFMSEARCH::Global::defaultIndexedDirectory();
 
@@ -113,6 +179,7 @@ void SimplifiedSearchWorker::createSearchers()
     connect(searcher, &AbstractSearcher::finished, this, &SimplifiedSearchWorker::onSearcherFinished);
 
     searchers.append(searcher);
+    refinable = true;
 
     // 启动搜索
     searcher->search();
@@ -152,7 +219,7 @@ void SimplifiedSearchWorker::createSearchersForUrl(const QUrl &url)
     // 为每种搜索类型创建搜索器
     for (auto type : searchTypes) {
         // 使用DFMSearcher作为默认搜索器
-        AbstractSearcher *searcher = new DFMSearcher(url, searchKeyword, this, type);
+        DFMSearcher *searcher = new DFMSearcher(url, searchKeyword, this, type);
 
         // 连接信号
         connect(searcher, &AbstractSearcher::unearthed, this, &SimplifiedSearchWorker::onSearcherUnearthed);
@@ -162,6 +229,10 @@ void SimplifiedSearchWorker::createSearchersForUrl(const QUrl &url)
 
         // 启动搜索
         searcher->search();
+
+        // 索引和内容搜索的匹配规则无法在本地重现
+        if (!searcher->isRealtimeFileNameSearch())
+            refinable = false;
     }
 }
 
@@ -188,7 +259,7 @@ void SimplifiedSearchWorker::onSearcherUnearthed()
         mergeResults(searcher);
 
         // 通知UI更新结果
-        emit resultsUpdated(taskId);
+        notifyResults();
     }
 }
 
@@ -200,6 +271,16 @@ void SimplifiedSearchWorker::mergeResults(AbstractSearcher *searcher)
     // 获取新结果
     DFMSearchResultMap newResults = searcher->takeAll();
 
+    // 细化后运行中的搜索器仍按原关键词匹配
+    if (!refineRegex.pattern().isEmpty()) {
+        for (auto it = newResults.begin(); it != newResults.end();) {
+            if (refineRegex.match(it->matchedName()).hasMatch())
+                ++it;
+            else
+                it = newResults.erase(it);
+        }
+    }
+
     if (newResults.isEmpty())
         return;
 
@@ -240,12 +321,13 @@ void SimplifiedSearchWorker::onSearcherFinished()
     // 最后一次检查是否有新结果
     if (searcher->hasItem() && isRunning) {
         mergeResults(searcher);
-        emit resultsUpdated(taskId);
+        notifyResults();
     }
 
     // 移除完成的搜索器
     searchers.removeAll(searcher);
     searcher->deleteLater();
+    updatePausable();
 
     // 所有搜索器完成时通知搜索完成
     if (searchers.isEmpty() && isRunning) {
@@ -257,6 +339,31 @@ void SimplifiedSearchWorker::onSearcherFinished()
     }
 }
 
+void SimplifiedSearchWorker::notifyResults()
+{
+    if (!firstResultReported) {
+        QReadLocker locker(&rwLock);
+        if (!resultMap.isEmpty()) {
+            firstResultReported = true;
+            fmInfo() << "Search task:" << taskId << (refined ? "refined" : "fresh")
+                     << "first results after" << firstResultTimer.elapsed() << "ms";
+        }
+    }
+
+    emit resultsUpdated(taskId);
+}
+
+void SimplifiedSearchWorker::updatePausable()
+{
+    // DFMSearcher 无法暂停，只能等它完成
+    bool all = refinable.loadAcquire();
+    for (auto searcher : std::as_const(searchers)) {
+        if (!qobject_cast<IteratorSearcher *>(searcher))
+            all = false;
+    }
+    pausable = all;
+}
+
 // ======== TaskCommanderPrivate 实现 ========
 
 TaskCommanderPrivate::TaskCommanderPrivate(TaskCommander *parent)
@@ -369,6 +476,32 @@ bool TaskCommander::start()
     return true;
 }
 
+bool TaskCommander::isRefinable() const
+{
+    return d->searchWorker && d->searchWorker->isRefinable();
+}
+
+bool TaskCommander::pause()
+{
+    if (!d->searchWorker || !d->searchWorker->isPausable())
+        return false;
+
+    QMetaObject::invokeMethod(d->searchWorker, "pauseSearch", Qt::QueuedConnection);
+    return true;
+}
+
+bool TaskCommander::refine(const QString &taskId, const QString &keyword)
+{
+    if (!isRefinable())
+        return false;
+
+    // 工作线程切换前发出的旧taskId通知会被忽略
+    d->taskId = taskId;
+    QMetaObject::invokeMethod(d->searchWorker, "refineSearch", Qt::QueuedConnection,
+                              Q_ARG(QString, taskId), Q_ARG(QString, keyword));
+    return true;
+}
+
 void TaskCommander::stop()
 {
     if (!d->searchWorker)
@@ -33,6 +33,11 @@ private:
     // 控制搜索流程
     bool start();
     void stop();
+    // 以更长的关键词接管本任务，结果以新的taskId通知
+    bool refine(const QString &taskId, const QString &keyword);
+    bool isRefinable() const;
+    // 暂停遍历，保留任务等待细化；不能暂停时返回 false
+    bool pause();
     // void deleteSelf();
     
     // 准备销毁任务，非阻塞方式停止线程
@@ -20,6 +20,8 @@
 #include <QThread>
 #include <QMutex>
 #include <QTimer>
+#include <QElapsedTimer>
+#include <QRegularExpression>
 
 DPSEARCH_BEGIN_NAMESPACE
 
@@ -43,6 +45,15 @@ public:
     // 控制搜索流程
     Q_INVOKABLE void startSearch();
     Q_INVOKABLE void stopSearch();
+    // 以更长的关键词继续当前搜索：过滤已有结果，未完成的遍历从停下的位置继续
+    Q_INVOKABLE void refineSearch(const QString &id, const QString &keyword);
+    // 暂停遍历等待细化，已有结果保留
+    Q_INVOKABLE void pauseSearch();
+
+    // 所有搜索器都是按名称匹配的遍历搜索时才可细化，可在任意线程调用
+    bool isRefinable() const { return refinable.loadAcquire(); }
+    // 剩余的搜索器都能暂停时才可暂停，可在任意线程调用
+    bool isPausable() const { return pausable.loadAcquire(); }
 
 signals:
     void resultsUpdated(const QString &taskId);
@@ -61,6 +72,8 @@ private:
     void createSearchersForUrl(const QUrl &url);
     void cleanupSearchers();
     void mergeResults(AbstractSearcher *searcher);
+    void notifyResults();
+    void updatePausable();
 
     QString taskId;
     QUrl searchUrl;
@@ -74,6 +87,15 @@ private:
 
     bool isRunning { false };
     int finishedSearcherCount { 0 };
+
+    QAtomicInteger<bool> refinable { false };
+    QAtomicInteger<bool> pausable { false };
+    QRegularExpression refineRegex;   // 细化后的关键词，无效时不过滤
+
+    // 首个结果的耗时，区分全新搜索和细化搜索
+    QElapsedTimer firstResultTimer;
+    bool firstResultReported { false };
+    bool refined { false };
 };
 
 class TaskCommanderPrivate : public QObject
@@ -74,6 +74,7 @@ bool DFMSearcher::search()
     fmDebug() << "Using transformed search path:" << transformedPath;
 
     SearchOptions options = configureSearchOptions(transformedPath);
+    realtimeMethod = options.method() == SearchMethod::Realtime;
 
     if (!validateSearchType(transformedPath, options)) {
         fmWarning() << "Search type validation failed for path:" << transformedPath;
@@ -109,6 +110,11 @@ DFMSearchResultMap DFMSearcher::takeAll()
     return result;
 }
 
+bool DFMSearcher::isRealtimeFileNameSearch() const
+{
+    return realtimeMethod && getSearchType() == SearchType::FileName;
+}
+
 SearchType DFMSearcher::getSearchType() const
 {
     return engine ? engine->searchType() : SearchType::FileName;
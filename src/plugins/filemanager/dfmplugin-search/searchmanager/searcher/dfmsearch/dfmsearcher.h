@@ -36,6 +36,9 @@ public:
     bool hasItem() const override;
     DFMSearchResultMap takeAll() override;
 
+    // 实时遍历的文件名搜索，结果可按细化后的关键词直接过滤
+    bool isRealtimeFileNameSearch() const;
+
 private:
     DFMSEARCH::SearchQuery createSearchQuery() const;
     void processSearchResult(const DFMSEARCH::SearchResult &result);
@@ -64,6 +67,7 @@ private:
     DFMSEARCH::SearchEngine *engine = nullptr;
     mutable QMutex mutex;
     DFMSearchResultMap allResults;
+    bool realtimeMethod { false };
 
     // 查询类型选择器，负责根据关键词和搜索类型选择合适的策略
     QueryTypeSelector querySelector;
@@ -10,6 +10,7 @@
 
 #include <QDebug>
 #include <QDirIterator>
+#include <QDateTime>
 #include <QFileInfo>
 #include <QApplication>
 #include <QMetaObject>
@@ -141,6 +142,43 @@ void IteratorSearcher::stop()
     }
 }
 
+void IteratorSearcher::refine(const QString &key)
+{
+    keyword = SearchHelper::instance()->checkWildcardAndToRegularExpression(key);
+    regex = QRegularExpression(keyword, QRegularExpression::CaseInsensitiveOption);
+
+    // 尚未取走的结果同样按新关键词过滤
+    QMutexLocker lk(&mutex);
+    for (auto it = resultMap.begin(); it != resultMap.end();) {
+        if (regex.match(it->matchedName()).hasMatch())
+            ++it;
+        else
+            it = resultMap.erase(it);
+    }
+    for (auto it = batchedResults.begin(); it != batchedResults.end();) {
+        if (resultMap.contains(it.key()))
+            ++it;
+        else
+            it = batchedResults.erase(it);
+    }
+}
+
+void IteratorSearcher::pause()
+{
+    paused = true;
+}
+
+void IteratorSearcher::resume()
+{
+    if (!paused)
+        return;
+
+    paused = false;
+    // 等待中的迭代器返回后会继续处理，不能再发起一次
+    if (!iteratorPending)
+        requestNextDirectory();
+}
+
 bool IteratorSearcher::hasItem() const
 {
     QMutexLocker lk(&mutex);
@@ -177,6 +215,9 @@ void IteratorSearcher::processDirectory()
         return;
     }
 
+    if (paused)
+        return;
+
     // 如果队列为空且状态为运行中，标记为完成
     if (pendingDirs.isEmpty()) {
         status.storeRelease(kCompleted);
@@ -186,20 +227,29 @@ void IteratorSearcher::processDirectory()
     }
 
     // 从队列获取下一个目录
-    QUrl currentUrl = pendingDirs.dequeue();
+    currentDir = pendingDirs.dequeue();
+    iteratorPending = true;
 
     // 在主线程中请求创建迭代器
-    emit requestCreateIterator(currentUrl);
+    emit requestCreateIterator(currentDir);
 }
 
 void IteratorSearcher::onIteratorCreated(QSharedPointer<DFMBASE_NAMESPACE::AbstractDirIterator> iterator)
 {
+    iteratorPending = false;
+
     // 检查状态
     if (status.loadAcquire() != kRuning) {
         fmDebug() << "Iterator creation callback ignored - not in running state";
         return;
     }
 
+    // 暂停期间不读取，目录放回队首
+    if (paused) {
+        pendingDirs.prepend(currentDir);
+        return;
+    }
+
     // 处理迭代器结果
     if (iterator) {
         processIteratorResults(iterator);
@@ -236,8 +286,9 @@ void IteratorSearcher::processIteratorResults(QSharedPointer<DFMBASE_NAMESPACE::
         }
 
         // The keyword check (the regex)
-        if (regex.match(info->displayOf(DisPlayInfoType::kFileDisplayName)).hasMatch())
-            addResultToMap(fileUrl, newResults);
+        const QString &displayName = info->displayOf(DisPlayInfoType::kFileDisplayName);
+        if (regex.match(displayName).hasMatch())
+            addResultToMap(fileUrl, newResults, displayName, info);
     }
 
     // 将子目录添加到队列
@@ -250,12 +301,33 @@ void IteratorSearcher::processIteratorResults(QSharedPointer<DFMBASE_NAMESPACE::
         addResults(newResults);
 }
 
-void IteratorSearcher::addResultToMap(const QUrl &fileUrl, DFMSearchResultMap &results)
+void IteratorSearcher::addResultToMap(const QUrl &fileUrl, DFMSearchResultMap &results, const QString &name,
+                                      const FileInfoPointer &info)
 {
     // 创建搜索结果
     DFMSearchResult result;
     result.setUrl(fileUrl);
     result.setMatchScore(1.0);  // 默认匹配分数
+    // 显示名与文件名不同时（如desktop文件）保留，细化搜索时据此重新过滤
+    if (!name.isEmpty() && name != fileUrl.fileName())
+        result.setMatchedName(name);
+
+    // 迭代器已按QueryAttributes查询过这些属性，随结果带出，排序时不必再逐个获取
+    if (info) {
+        DFMSearchFileMetadata metadata;
+        metadata.size = info->size();
+        metadata.isDir = info->isAttributes(OptInfoType::kIsDir);
+        metadata.isFile = !metadata.isDir;
+        metadata.isSymlink = info->isAttributes(OptInfoType::kIsSymLink);
+        metadata.isHidden = info->isAttributes(OptInfoType::kIsHidden);
+        metadata.readable = info->isAttributes(OptInfoType::kIsReadable);
+        metadata.writable = info->isAttributes(OptInfoType::kIsWritable);
+        metadata.executable = info->isAttributes(OptInfoType::kIsExecutable);
+        metadata.lastRead = info->timeOf(TimeInfoType::kLastRead).value<QDateTime>().toSecsSinceEpoch();
+        metadata.lastModified = info->timeOf(TimeInfoType::kLastModified).value<QDateTime>().toSecsSinceEpoch();
+        metadata.created = info->timeOf(TimeInfoType::kCreateTime).value<QDateTime>().toSecsSinceEpoch();
+        result.setMetadata(metadata);
+    }
 
     // 添加到结果
     results.insert(fileUrl, result);
@@ -6,6 +6,7 @@
 #define ITERATORSEARCHER_H
 
 #include "dfm-base/dfm_base_global.h"
+#include <dfm-base/interfaces/fileinfo.h>
 #include "searchmanager/searcher/abstractsearcher.h"
 
 #include <QMutex>
@@ -44,6 +45,12 @@ public:
     DFMSearchResultMap takeAll() override;
     QList<QUrl> takeAllUrls() override;
 
+    // 关键词被细化时只收集同时匹配新关键词的结果，已遍历的目录不再重复
+    void refine(const QString &key);
+    // 暂停时不再读取目录，待处理的目录保留到 resume 后继续
+    void pause();
+    void resume();
+
     // Static method to check if a URL is supported
     static bool isSupportSearch(const QUrl &url) { return true; }
 
@@ -64,7 +71,8 @@ private:
     void processIteratorResults(QSharedPointer<DFMBASE_NAMESPACE::AbstractDirIterator> iterator);
     
     // 添加单个结果到结果映射
-    void addResultToMap(const QUrl &fileUrl, DFMSearchResultMap &results);
+    void addResultToMap(const QUrl &fileUrl, DFMSearchResultMap &results, const QString &name = QString(),
+                        const DFMBASE_NAMESPACE::FileInfoPointer &info = nullptr);
     
     // 添加多个结果并发出信号
     void addResults(const DFMSearchResultMap &newResults);
@@ -81,6 +89,9 @@ private:
     mutable QMutex mutex;
     QRegularExpression regex;
     QQueue<QUrl> pendingDirs;
+    QUrl currentDir;   // 正在等待迭代器的目录
+    bool iteratorPending { false };
+    bool paused { false };
     
     // 用于主线程与工作线程间通信的桥接对象
     QSharedPointer<IteratorSearcherBridge> bridge;
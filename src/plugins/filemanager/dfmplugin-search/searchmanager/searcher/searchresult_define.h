@@ -13,6 +13,22 @@
 
 DPSEARCH_BEGIN_NAMESPACE
 
+// 搜索后端已经获取到的文件元数据，排序时无需再stat
+struct DFMSearchFileMetadata
+{
+    qint64 size { 0 };
+    qint64 lastRead { 0 };   // 秒
+    qint64 lastModified { 0 };   // 秒
+    qint64 created { 0 };   // 秒
+    bool isFile { false };
+    bool isDir { false };
+    bool isSymlink { false };
+    bool isHidden { false };
+    bool readable { false };
+    bool writable { false };
+    bool executable { false };
+};
+
 // 统一的搜索结果数据结构，使用隐式共享提高性能
 class DFMSearchResultData : public QSharedData
 {
@@ -25,6 +41,9 @@ public:
     QString highlightedContent {};  // 高亮的内容片段（全文搜索时使用）
     bool isContentMatch { false };  // 是否是内容匹配（区分文件名匹配和内容匹配）
     double matchScore { 0.0 };      // 匹配分数，用于排序
+    QString matchedName {};         // 匹配到关键词的名称，为空时即文件名
+    bool hasMetadata { false };     // 后端是否提供了元数据
+    DFMSearchFileMetadata metadata {};
 };
 
 // 使用隐式共享的搜索结果，提高拷贝和传递效率
@@ -47,6 +66,17 @@ public:
     inline double matchScore() const { return d->matchScore; }
     inline void setMatchScore(double score) { d->matchScore = score; }
 
+    inline QString matchedName() const { return d->matchedName.isEmpty() ? d->url.fileName() : d->matchedName; }
+    inline void setMatchedName(const QString &name) { d->matchedName = name; }
+
+    inline bool hasMetadata() const { return d->hasMetadata; }
+    inline const DFMSearchFileMetadata &metadata() const { return d->metadata; }
+    inline void setMetadata(const DFMSearchFileMetadata &metadata)
+    {
+        d->metadata = metadata;
+        d->hasMetadata = true;
+    }
+
 private:
     QSharedDataPointer<DFMSearchResultData> d;
 };
@@ -7,16 +7,22 @@
 #include "utils/searchhelper.h"
 
 #include <dfm-base/base/urlroute.h>
+#include <dfm-base/utils/universalutils.h>
 #include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 #include "plugins/common/dfmplugin-utils/reportlog/datas/searchreportdata.h"
 
 #include <dfm-framework/dpf.h>
 
+#include <QTimer>
+
 Q_DECLARE_METATYPE(const char *)
 
 DFMBASE_USE_NAMESPACE
 using namespace dfmplugin_search;
 
+// 停止的可细化任务的保留时间，覆盖连续输入的间隔
+static constexpr int kParkedTaskTimeout { 3000 };
+
 SearchManager *SearchManager::instance()
 {
     static SearchManager instance;
@@ -35,8 +41,10 @@ bool SearchManager::search(quint64 winId, const QString &taskId, const QUrl &url
 
     // Perform search
     if (mainController) {
+        // The new keyword narrows the previous one, continue the previous search
+        const bool refined = refineSearch(winId, taskId, url, keyword);
         taskIdMap[winId] = taskId;
-        return mainController->doSearchTask(taskId, url, keyword);
+        return refined || mainController->doSearchTask(taskId, url, keyword);
     }
 
     fmWarning() << "MainController not available, cannot start search task:" << taskId;
@@ -65,14 +73,31 @@ QList<QUrl> SearchManager::matchedResultUrls(const QString &taskId)
 
 void SearchManager::stop(const QString &taskId)
 {
-    if (mainController)
-        mainController->stop(taskId);
+    // Taken over by a refined search, which owns the task now
+    if (refinedTaskIds.remove(taskId)) {
+        emit searchStoped(taskId);
+        return;
+    }
+
+    if (mainController) {
+        // Keep a refinable task for a moment, the next keystroke usually narrows it.
+        // Its traversal is paused meanwhile, a task that cannot pause is stopped
+        const quint64 winId = winTasksMap.key(taskId);
+        if (winId != 0 && mainController->pauseTask(taskId))
+            parkTask(winId, taskId);
+        else
+            mainController->stop(taskId);
+    }
 
     emit searchStoped(taskId);
 }
 
 void SearchManager::stop(quint64 winId)
 {
+    const QString &parked = parkedTaskMap.take(winId);
+    if (!parked.isEmpty() && mainController)
+        mainController->stop(parked);
+
     if (taskIdMap.contains(winId)) {
         QString taskId = taskIdMap[winId];
 
@@ -109,6 +134,47 @@ void SearchManager::onDConfigValueChanged(const QString &config, const QString &
     }
 }
 
+bool SearchManager::refineSearch(quint64 winId, const QString &taskId, const QUrl &url, const QString &keyword)
+{
+    // A stopped task parked for this window, or the one still running
+    QString previous = parkedTaskMap.take(winId);
+    const bool parked = !previous.isEmpty();
+    if (!parked)
+        previous = taskIdMap.value(winId);
+    if (previous.isEmpty() || previous == taskId)
+        return false;
+
+    const auto &info = taskInfoMap.value(previous);
+    if (UniversalUtils::urlEquals(info.first, url)
+        && SearchHelper::isRefinedKeyword(info.second, keyword)
+        && mainController->refineTask(previous, taskId, keyword)) {
+        if (!parked)
+            refinedTaskIds.insert(previous);
+        return true;
+    }
+
+    if (parked)
+        mainController->stop(previous);
+    return false;
+}
+
+void SearchManager::parkTask(quint64 winId, const QString &taskId)
+{
+    const QString &previous = parkedTaskMap.value(winId);
+    if (!previous.isEmpty() && previous != taskId)
+        mainController->stop(previous);
+
+    parkedTaskMap.insert(winId, taskId);
+    QTimer::singleShot(kParkedTaskTimeout, this, [this, winId, taskId]() {
+        if (parkedTaskMap.value(winId) != taskId)
+            return;
+
+        parkedTaskMap.remove(winId);
+        if (mainController)
+            mainController->stop(taskId);
+    });
+}
+
 SearchManager::SearchManager(QObject *parent)
     : QObject(parent)
 {
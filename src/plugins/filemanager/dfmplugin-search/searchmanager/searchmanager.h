@@ -11,6 +11,7 @@
 #include <QObject>
 #include <QMap>
 #include <QMultiMap>
+#include <QSet>
 
 namespace dfmplugin_search {
 
@@ -48,15 +49,22 @@ signals:
     void fileAdd(const QUrl &url);
     void fileDelete(const QUrl &url);
     void fileRename(const QUrl &oldUrl, const QUrl &newUrl);
+    // 已通知的结果不再匹配（细化关键词后），从 searchUrl 的视图中移除
+    void resultsWithdrawn(const QUrl &searchUrl, const QList<QUrl> &urls);
 
 private:
     explicit SearchManager(QObject *parent = nullptr);
     ~SearchManager();
 
+    bool refineSearch(quint64 winId, const QString &taskId, const QUrl &url, const QString &keyword);
+    void parkTask(quint64 winId, const QString &taskId);
+
     MainController *mainController = nullptr;
     QMap<quint64, QString> taskIdMap;  // 当前窗口最近一次的搜索taskId
     QMultiMap<quint64, QString> winTasksMap;  // 窗口ID对应的所有搜索任务ID
     QMap<QString, QPair<QUrl, QString>> taskInfoMap; // 保存任务ID对应的url和keyword
+    QMap<quint64, QString> parkedTaskMap;  // 窗口停止后暂留的可细化任务，等待下一次输入
+    QSet<QString> refinedTaskIds;  // 已被后续细化搜索接管的taskId
 };
 
 }
@@ -20,6 +20,7 @@
 #include <DSettingsOption>
 
 #include <QUrlQuery>
+#include <QRegularExpression>
 
 Q_DECLARE_METATYPE(QString *);
 Q_DECLARE_METATYPE(QVariant *)
@@ -72,6 +73,19 @@ QString SearchHelper::searchWinId(const QUrl &searchUrl)
     return query.queryItemValue("winId", QUrl::FullyDecoded);
 }
 
+bool SearchHelper::isRefinedKeyword(const QString &previous, const QString &current)
+{
+    if (previous.isEmpty() || current.length() <= previous.length())
+        return false;
+
+    // wildcard and multi-keyword queries are not plain substring matches
+    static const QRegularExpression kNotPlain("[*?\\s]");
+    if (previous.contains(kNotPlain) || current.contains(kNotPlain))
+        return false;
+
+    return current.contains(previous, Qt::CaseInsensitive);
+}
+
 QUrl SearchHelper::setSearchKeyword(const QUrl &searchUrl, const QString &keyword)
 {
     QUrl url(searchUrl);
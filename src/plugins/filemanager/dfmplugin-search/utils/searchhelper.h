@@ -33,6 +33,8 @@ public:
     static QUrl searchTargetUrl(const QUrl &searchUrl);
     static QString searchKeyword(const QUrl &searchUrl);
     static QString searchWinId(const QUrl &searchUrl);
+    // every name matching current also matches previous, e.g. "repo" -> "report"
+    static bool isRefinedKeyword(const QString &previous, const QString &current);
 
     static QUrl setSearchKeyword(const QUrl &searchUrl, const QString &keyword);
     static QUrl setSearchTargetUrl(const QUrl &searchUrl, const QUrl &targetUrl);
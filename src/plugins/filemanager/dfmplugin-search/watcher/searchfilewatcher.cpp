@@ -8,6 +8,7 @@
 #include "searchmanager/searchmanager.h"
 
 #include <dfm-base/base/schemefactory.h>
+#include <dfm-base/utils/universalutils.h>
 
 #include <dfm-framework/event/event.h>
 
@@ -51,6 +52,8 @@ SearchFileWatcher::SearchFileWatcher(const QUrl &url, QObject *parent)
             &SearchFileWatcher::handleFileDelete, Qt::QueuedConnection);
     connect(SearchManager::instance(), &SearchManager::fileRename, this,
             &SearchFileWatcher::handleFileRename, Qt::QueuedConnection);
+    connect(SearchManager::instance(), &SearchManager::resultsWithdrawn, this,
+            &SearchFileWatcher::handleResultsWithdrawn, Qt::QueuedConnection);
 }
 
 SearchFileWatcher::~SearchFileWatcher()
@@ -209,4 +212,13 @@ void SearchFileWatcher::handleFileRename(const QUrl &oldUrl, const QUrl &newUrl)
         return onFileAdd(newUrl);
     }
 }
+
+void SearchFileWatcher::handleResultsWithdrawn(const QUrl &searchUrl, const QList<QUrl> &urls)
+{
+    if (!UniversalUtils::urlEquals(searchUrl, url()))
+        return;
+
+    for (const QUrl &url : urls)
+        onFileDeleted(url);
+}
 }
@@ -34,6 +34,7 @@ private Q_SLOTS:
     void handleFileAdd(const QUrl &url);
     void handleFileDelete(const QUrl &url);
     void handleFileRename(const QUrl &oldUrl, const QUrl &newUrl);
+    void handleResultsWithdrawn(const QUrl &searchUrl, const QList<QUrl> &urls);
 
 private:
     SearchFileWatcherPrivate *dptr;
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "completionindex.h"
+
+#include <dfm-base/dfm_global_defines.h>
+#include <dfm-base/utils/protocolutils.h>
+
+#include <QDir>
+#include <QSet>
+
+#include <algorithm>
+#include <numeric>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+
+using namespace dfmplugin_titlebar;
+DFMBASE_USE_NAMESPACE
+
+static constexpr int kMaxCachedNames { 100000 };
+
+// the directory mtime of these is unreliable, and stat may block on them
+static const QSet<quint32> kUncachedFileSystems {
+    0x6969,   // nfs
+    0x517b,   // smb
+    0xff534d42,   // cifs
+    0xfe534d42,   // smb2
+    0x65735546,   // fuse
+};
+
+CompletionIndex *CompletionIndex::instance()
+{
+    static CompletionIndex ins;
+    return &ins;
+}
+
+CompletionIndex::CompletionIndex(QObject *parent)
+    : QObject(parent)
+{
+    entries.setMaxCost(kMaxCachedNames);
+}
+
+CompletionIndex::~CompletionIndex()
+{
+    if (prefetchJob) {
+        prefetchJob->disconnect();
+        prefetchJob->stop();
+        prefetchJob->wait();
+    }
+}
+
+bool CompletionIndex::lookup(const QUrl &dirUrl, QStringList *names)
+{
+    Entry *entry = validEntry(dirUrl);
+    if (!entry)
+        return false;
+
+    if (names)
+        *names = entry->names;
+    return true;
+}
+
+bool CompletionIndex::complete(const QUrl &dirUrl, const QString &prefix, QStringList *matches)
+{
+    Entry *entry = validEntry(dirUrl);
+    if (!entry)
+        return false;
+
+    if (!matches)
+        return true;
+
+    matches->clear();
+    if (prefix.isEmpty()) {
+        *matches = entry->names;
+        return true;
+    }
+
+    // QCompleter is case sensitive here, so plain code point order is enough
+    const QStringList &names = entry->names;
+    auto it = std::lower_bound(entry->prefixOrder.cbegin(), entry->prefixOrder.cend(), prefix,
+                               [&names](int index, const QString &value) {
+                                   return names.at(index) < value;
+                               });
+
+    QVector<int> hits;
+    for (; it != entry->prefixOrder.cend() && names.at(*it).startsWith(prefix); ++it)
+        hits.append(*it);
+
+    // keep the display order of the popup
+    std::sort(hits.begin(), hits.end());
+    matches->reserve(hits.size());
+    for (int index : hits)
+        matches->append(names.at(index));
+
+    return true;
+}
+
+void CompletionIndex::insert(const QUrl &dirUrl, const QStringList &names, qint64 modifiedTime)
+{
+    if (!isCacheable(dirUrl) || modifiedTime < 0)
+        return;
+
+    Entry *entry = new Entry;
+    entry->modifiedTime = modifiedTime;
+    entry->names = names;
+    entry->prefixOrder.resize(names.size());
+    std::iota(entry->prefixOrder.begin(), entry->prefixOrder.end(), 0);
+    std::sort(entry->prefixOrder.begin(), entry->prefixOrder.end(), [&names](int l, int r) {
+        return names.at(l) < names.at(r);
+    });
+
+    const QString &key = cacheKey(dirUrl);
+    if (validatedKey == key)
+        validatedKey.clear();
+    entries.insert(key, entry, names.size() + 1);
+}
+
+void CompletionIndex::invalidate(const QUrl &dirUrl)
+{
+    const QString &key = cacheKey(dirUrl);
+    if (validatedKey == key)
+        validatedKey.clear();
+    entries.remove(key);
+}
+
+void CompletionIndex::prefetch(const QUrl &dirUrl)
+{
+    if (!isCacheable(dirUrl) || lookup(dirUrl, nullptr))
+        return;
+
+    if (prefetchJob) {
+        if (prefetchUrl == dirUrl && prefetchJob->isRunning())
+            return;
+
+        prefetchJob->disconnect();
+        prefetchJob->stopAndDeleteLater();
+        prefetchJob->setParent(nullptr);
+    }
+
+    const qint64 mtime = modifiedTime(dirUrl);
+    if (mtime < 0)
+        return;
+
+    fmDebug() << "Prefetch completion list for:" << dirUrl;
+    TraversalDirThread *job = new TraversalDirThread(dirUrl, QStringList(),
+                                                     QDir::AllDirs | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::NoIteratorFlags);
+    job->setQueryAttributes("standard::standard::name");
+    job->setEnableSort(true);
+    job->setParent(this);
+    prefetchJob = job;
+    prefetchUrl = dirUrl;
+
+    connect(job, &TraversalDirThread::updateChildren, this, [this, job, dirUrl, mtime](QList<QUrl> children) {
+        // results of a replaced job can still be queued
+        if (job != prefetchJob)
+            return;
+
+        QStringList names;
+        names.reserve(children.size());
+        for (const auto &child : children)
+            names.append(child.fileName());
+        insert(dirUrl, names, mtime);
+    });
+    connect(job, &TraversalDirThread::finished, job, &TraversalDirThread::deleteLater);
+
+    job->start(QThread::LowPriority);
+}
+
+bool CompletionIndex::isCacheable(const QUrl &dirUrl)
+{
+    // only matches the path, gvfs mounts are excluded without touching them
+    return dirUrl.isValid() && dirUrl.scheme() == Global::Scheme::kFile && !ProtocolUtils::isRemoteFile(dirUrl);
+}
+
+qint64 CompletionIndex::modifiedTime(const QUrl &dirUrl)
+{
+    const QByteArray &path = dirUrl.toLocalFile().toLocal8Bit();
+    struct statfs fsBuf;
+    if (::statfs(path.constData(), &fsBuf) != 0 || kUncachedFileSystems.contains(static_cast<quint32>(fsBuf.f_type)))
+        return -1;
+
+    struct stat st;
+    if (::stat(path.constData(), &st) != 0 || !S_ISDIR(st.st_mode))
+        return -1;
+
+    return static_cast<qint64>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+}
+
+CompletionIndex::Entry *CompletionIndex::validEntry(const QUrl &dirUrl)
+{
+    if (!isCacheable(dirUrl))
+        return nullptr;
+
+    const QString &key = cacheKey(dirUrl);
+    // QCache::object() also moves the entry to the front of the LRU list
+    Entry *entry = entries.object(key);
+    if (!entry)
+        return nullptr;
+
+    // keys typed in the same directory reuse the last check
+    if (key == validatedKey)
+        return entry;
+
+    if (entry->modifiedTime != modifiedTime(dirUrl)) {
+        entries.remove(key);
+        return nullptr;
+    }
+
+    validatedKey = key;
+    return entry;
+}
+
+QString CompletionIndex::cacheKey(const QUrl &dirUrl)
+{
+    return QDir::cleanPath(dirUrl.toLocalFile());
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef COMPLETIONINDEX_H
+#define COMPLETIONINDEX_H
+
+#include "dfmplugin_titlebar_global.h"
+
+#include <dfm-base/utils/traversaldirthread.h>
+
+#include <QObject>
+#include <QCache>
+#include <QPointer>
+#include <QVector>
+#include <QUrl>
+
+namespace dfmplugin_titlebar {
+
+/*!
+ * \brief Per-directory cache of address bar completions
+ *
+ * Children names of local directories are kept in display order together with
+ * a code point sorted index, so a prefix lookup is a binary search instead of a
+ * linear scan. Entries are validated by the directory mtime, which changes
+ * whenever an entry is created, removed or renamed in it, and evicted in LRU
+ * order once kMaxCachedNames names are cached. The mtime is checked once when
+ * completion moves to a directory, not on every key typed in it. Network and
+ * FUSE mounts are not cached. Only used from the GUI thread.
+ */
+class CompletionIndex : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(CompletionIndex)
+
+public:
+    static CompletionIndex *instance();
+
+    bool lookup(const QUrl &dirUrl, QStringList *names);
+    bool complete(const QUrl &dirUrl, const QString &prefix, QStringList *matches);
+    void insert(const QUrl &dirUrl, const QStringList &names, qint64 modifiedTime);
+    void invalidate(const QUrl &dirUrl);
+
+    /*!
+     * \brief Enumerate dirUrl in background if it is not cached yet
+     *
+     * Used for the segment the user is most likely to type next, only one
+     * prefetch runs at a time and a new one replaces it.
+     */
+    void prefetch(const QUrl &dirUrl);
+
+    static bool isCacheable(const QUrl &dirUrl);
+    static qint64 modifiedTime(const QUrl &dirUrl);
+
+private:
+    struct Entry
+    {
+        qint64 modifiedTime { -1 };
+        QStringList names;   // display order
+        QVector<int> prefixOrder;   // indexes into names, sorted by code point
+    };
+
+    explicit CompletionIndex(QObject *parent = nullptr);
+    ~CompletionIndex() override;
+
+    Entry *validEntry(const QUrl &dirUrl);
+    static QString cacheKey(const QUrl &dirUrl);
+
+    QCache<QString, Entry> entries;
+    QString validatedKey;   // the directory completed last, already checked
+    QPointer<DFMBASE_NAMESPACE::TraversalDirThread> prefetchJob;
+    QUrl prefetchUrl;
+};
+
+}
+
+#endif   // COMPLETIONINDEX_H
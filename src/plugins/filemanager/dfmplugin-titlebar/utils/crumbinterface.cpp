@@ -4,12 +4,14 @@
 
 #include "crumbinterface.h"
 #include "utils/titlebarhelper.h"
+#include "utils/completionindex.h"
 
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/dfm_global_defines.h>
 #include <dfm-base/utils/universalutils.h>
 #include <dfm-base/utils/fileutils.h>
+#include <dfm-base/utils/filenamesorter.h>
 
 #include <dfm-framework/event/event.h>
 
@@ -92,6 +94,10 @@ QList<CrumbData> CrumbInterface::seprateUrl(const QUrl &url)
  * the transmission isn't completed, you should call cancelCompletionListTransmission.
  * When transmission completed, it will send completionListTransmissionCompleted signal.
  *
+ * Local directories are served from CompletionIndex or from the children an opened
+ * view already enumerated, both without starting a traversal, and are signaled
+ * synchronously in that case.
+ *
  * \sa completionFound, completionListTransmissionCompleted, cancelCompletionListTransmission
  */
 void CrumbInterface::requestCompletionList(const QUrl &url)
@@ -101,6 +107,14 @@ void CrumbInterface::requestCompletionList(const QUrl &url)
         folderCompleterJobPointer->stopAndDeleteLater();
         folderCompleterJobPointer->setParent(nullptr);
     }
+    completionNames.clear();
+    completionCanceled = false;
+
+    if (requestCachedCompletionList(url))
+        return;
+
+    // take the mtime before enumerating, a change made meanwhile invalidates the entry
+    const qint64 modifiedTime = CompletionIndex::isCacheable(url) ? CompletionIndex::modifiedTime(url) : -1;
     folderCompleterJobPointer = new TraversalDirThread(url, QStringList(),
                                                        QDir::AllDirs | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::NoIteratorFlags);
     folderCompleterJobPointer->setQueryAttributes("standard::standard::name");
@@ -114,7 +128,10 @@ void CrumbInterface::requestCompletionList(const QUrl &url)
 
     connect(
             folderCompleterJobPointer.data(), &TraversalDirThread::finished, this,
-            [this]() {
+            [this, url, modifiedTime]() {
+                // a canceled traversal only produced part of the children
+                if (!completionCanceled)
+                    CompletionIndex::instance()->insert(url, completionNames, modifiedTime);
                 emit completionListTransmissionCompleted();
             },
             Qt::QueuedConnection);
@@ -131,8 +148,10 @@ void CrumbInterface::requestCompletionList(const QUrl &url)
  */
 void CrumbInterface::cancelCompletionListTransmission()
 {
-    if (folderCompleterJobPointer)
+    if (folderCompleterJobPointer) {
+        completionCanceled = true;
         folderCompleterJobPointer->stop();
+    }
 }
 
 void CrumbInterface::onUpdateChildren(QList<QUrl> children)
@@ -142,5 +161,34 @@ void CrumbInterface::onUpdateChildren(QList<QUrl> children)
     for (const auto &child : children) {
         list.append(child.fileName());
     }
+    completionNames.append(list);
     emit completionFound(list);
 }
+
+bool CrumbInterface::requestCachedCompletionList(const QUrl &url)
+{
+    if (!CompletionIndex::isCacheable(url))
+        return false;
+
+    QStringList names;
+    if (CompletionIndex::instance()->lookup(url, &names)) {
+        emit completionFound(names);
+        emit completionListTransmissionCompleted();
+        return true;
+    }
+
+    // reuse the children of a directory already opened in a view
+    const qint64 modifiedTime = CompletionIndex::modifiedTime(url);
+    QList<QUrl> children = dpfSlotChannel->push("dfmplugin_workspace", "slot_Model_GetDirChildren", url).value<QList<QUrl>>();
+    if (children.isEmpty())
+        return false;
+
+    FileNameSorter::sortUrls(children);
+    for (const auto &child : children)
+        names.append(child.fileName());
+    CompletionIndex::instance()->insert(url, names, modifiedTime);
+
+    emit completionFound(names);
+    emit completionListTransmissionCompleted();
+    return true;
+}
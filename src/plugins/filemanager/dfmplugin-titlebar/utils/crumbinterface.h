@@ -48,7 +48,11 @@ private slots:
     void onUpdateChildren(QList<QUrl> children);
 
 private:
+    bool requestCachedCompletionList(const QUrl &url);
+
     QString curScheme;
+    QStringList completionNames;
+    bool completionCanceled { false };
     QPointer<DFMBASE_NAMESPACE::TraversalDirThread> folderCompleterJobPointer;
 };
 
@@ -22,6 +22,7 @@
 #include <dfm-base/utils/protocolutils.h>
 #include <dfm-base/widgets/filemanagerwindowsmanager.h>
 #include <dfm-base/base/application/application.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/base/application/settings.h>
 #include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 
@@ -419,16 +420,16 @@ QUrl TitleBarHelper::transformViewModeUrl(const QUrl &url)
 QVariant TitleBarHelper::getFileViewStateValue(const QUrl &url, const QString &key, const QVariant &defaultValue)
 {
     QUrl viewModeUrl = transformViewModeUrl(url);
-    QMap<QString, QVariant> valueMap = Application::appObtuselySetting()->value("FileViewState", viewModeUrl).toMap();
+    QMap<QString, QVariant> valueMap = Application::fileViewStateStore()->value(viewModeUrl).toMap();
     return valueMap.value(key, defaultValue);
 }
 
 void TitleBarHelper::setFileViewStateValue(const QUrl &url, const QString &key, const QVariant &value)
 {
     QUrl viewModeUrl = transformViewModeUrl(url);
-    QVariantMap map = Application::appObtuselySetting()->value("FileViewState", viewModeUrl).toMap();
+    QVariantMap map = Application::fileViewStateStore()->value(viewModeUrl).toMap();
     map[key] = value;
-    Application::appObtuselySetting()->setValue("FileViewState", viewModeUrl, map);
+    Application::fileViewStateStore()->setValue(viewModeUrl, map);
 }
 
 bool TitleBarHelper::isTreeViewGloballyEnabled()
@@ -8,6 +8,7 @@
 #include "utils/crumbinterface.h"
 #include "utils/searchhistroymanager.h"
 #include "utils/titlebarhelper.h"
+#include "utils/completionindex.h"
 
 #include <dfm-base/widgets/filemanagerwindowsmanager.h>
 #include <dfm-base/base/schemefactory.h>
@@ -230,6 +231,9 @@ void AddressBarPrivate::appendToCompleterModel(const QStringList &stringList)
 
 void AddressBarPrivate::onTravelCompletionListFinished()
 {
+    if (urlCompleter->completionCount() == 1)
+        prefetchNextSegment({ urlCompleter->currentCompletion() });
+
     if (urlCompleter->completionCount() > 0) {
         if (urlCompleter->popup()->isHidden() && q->isVisible())
             doComplete();
@@ -270,6 +274,8 @@ void AddressBarPrivate::completeIpAddress(const QString &text)
 
     // Set Base String
     this->completerBaseString = text;
+    completerBaseUrl.clear();
+    isCompleterModelNarrowed = false;
 
     completerModel.setRowCount(3);
     completerModel.setItem(0, 0, new QStandardItem("smb://" + text));
@@ -303,15 +309,30 @@ void AddressBarPrivate::completeLocalPath(const QString &text, const QUrl &url,
     }
 
     // Check if we should start a new completion transmission.
+    const QString &prefix = text.mid(slashIndex + 1);
     if (this->completerBaseString == text.left(slashIndex + 1)
         || UrlRoute::fromUserInput(completerBaseString) == UrlRoute::fromUserInput(text.left(slashIndex + 1))) {
-        urlCompleter->setCompletionPrefix(text.mid(slashIndex + 1));   // set completion prefix first
-        onCompletionModelCountChanged();   // will call complete()
-        return;
+        // narrow the model by the prefix index, so QCompleter only filters the matches
+        QStringList matches;
+        bool indexed = CompletionIndex::instance()->complete(url, prefix, &matches);
+        if (indexed) {
+            completerModel.setStringList(matches);
+            isCompleterModelNarrowed = true;
+            prefetchNextSegment(matches);
+        }
+
+        // a narrowed model misses children once the directory changed, request them again
+        if (indexed || !isCompleterModelNarrowed) {
+            urlCompleter->setCompletionPrefix(prefix);   // set completion prefix first
+            onCompletionModelCountChanged();   // will call complete()
+            return;
+        }
     }
 
     // Set Base String
     completerBaseString = text.left(slashIndex + 1);
+    completerBaseUrl = url;
+    isCompleterModelNarrowed = false;
 
     // start request
     // 由于下方urlCompleter->setCompletionPrefix会触发onCompletionModelCountChanged接口
@@ -319,12 +340,24 @@ void AddressBarPrivate::completeLocalPath(const QString &text, const QUrl &url,
     clearCompleterModel();
 
     // set completion prefix.
-    urlCompleter->setCompletionPrefix(text.mid(slashIndex + 1));
+    urlCompleter->setCompletionPrefix(prefix);
 
     // URL completion.
     requestCompleteByUrl(url);
 }
 
+/*!
+ * \brief Enumerate the only matched child in background, it is the segment the user
+ * most likely types next.
+ */
+void AddressBarPrivate::prefetchNextSegment(const QStringList &matches)
+{
+    if (matches.size() != 1 || !CompletionIndex::isCacheable(completerBaseUrl))
+        return;
+
+    CompletionIndex::instance()->prefetch(QUrl::fromLocalFile(QDir(completerBaseUrl.toLocalFile()).filePath(matches.first())));
+}
+
 void AddressBarPrivate::onTextEdited(const QString &text)
 {
     lastEditedString = text;
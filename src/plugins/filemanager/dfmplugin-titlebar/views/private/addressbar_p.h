@@ -46,6 +46,8 @@ class AddressBarPrivate : public QObject
     QString placeholderText { tr("Enter address") };
     QAction clearAction;
     QString completerBaseString;
+    QUrl completerBaseUrl;
+    bool isCompleterModelNarrowed { false };   // completerModel only holds the matches of the prefix index
     QString lastEditedString;
     int lastPressedKey { Qt::Key_D };   // just an init value
     int lastPreviousKey { Qt::Key_Control };   // 记录上前一个按钮
@@ -79,6 +81,7 @@ public:
 
     void completeIpAddress(const QString &text);
     void completeLocalPath(const QString &text, const QUrl &url, int slashIndex);
+    void prefetchNextSegment(const QStringList &matches);
 
 public Q_SLOTS:
     void onTextEdited(const QString &text);
@@ -9,7 +9,7 @@
 
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/base/application/application.h>
-#include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/base/configs/dconfig/dconfigmanager.h>
 #include <dfm-base/widgets/filemanagerwindowsmanager.h>
 
@@ -226,7 +226,7 @@ void ViewOptionsWidgetPrivate::initConnect()
     connect(iconSizeSlider, &DSlider::valueChanged, this, [this](int value) {
         fmDebug() << "iconSizeSlider value changed: " << value;
         TitleBarHelper::setFileViewStateValue(fileUrl, "iconSizeLevel", value);
-        Application::appObtuselySetting()->sync();
+        Application::fileViewStateStore()->sync();
         fmDebug() << "Icon size level saved to settings for URL:" << fileUrl.toString();
     });
     connect(iconSizeSlider, &DSlider::iconClicked, this, [this](DSlider::SliderIcons icon, bool checked) {
@@ -243,7 +243,7 @@ void ViewOptionsWidgetPrivate::initConnect()
     connect(gridDensitySlider, &DSlider::valueChanged, this, [this](int value) {
         fmDebug() << "gridDensitySlider value changed: " << value;
         TitleBarHelper::setFileViewStateValue(fileUrl, "gridDensityLevel", value);
-        Application::appObtuselySetting()->sync();
+        Application::fileViewStateStore()->sync();
         fmDebug() << "Grid density level saved to settings for URL:" << fileUrl.toString();
     });
     connect(gridDensitySlider, &DSlider::iconClicked, this, [this](DSlider::SliderIcons icon, bool checked) {
@@ -260,7 +260,7 @@ void ViewOptionsWidgetPrivate::initConnect()
     connect(listHeightSlider, &DSlider::valueChanged, this, [this](int value) {
         fmDebug() << "listHeightSlider value changed: " << value;
         TitleBarHelper::setFileViewStateValue(fileUrl, "listHeightLevel", value);
-        Application::appObtuselySetting()->sync();
+        Application::fileViewStateStore()->sync();
         fmDebug() << "List height level saved to settings for URL:" << fileUrl.toString();
     });
     connect(listHeightSlider, &DSlider::iconClicked, this, [this](DSlider::SliderIcons icon, bool checked) {
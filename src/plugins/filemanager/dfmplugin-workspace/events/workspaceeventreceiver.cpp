@@ -9,6 +9,7 @@
 #include "views/workspacewidget.h"
 #include "views/fileview.h"
 #include "models/fileviewmodel.h"
+#include "models/rootinfo.h"
 
 #include <dfm-base/base/urlroute.h>
 #include <dfm-base/dfm_event_defines.h>
@@ -145,6 +146,8 @@ void WorkspaceEventReceiver::initConnection()
                             WorkspaceEventReceiver::instance(), &WorkspaceEventReceiver::handleRegisterLoadStrategy);
     dpfSlotChannel->connect(kCurrentEventSpace, "slot_Model_GetCurrentBusy",
                             WorkspaceEventReceiver::instance(), &WorkspaceEventReceiver::handleGetCurrentModelBusy);
+    dpfSlotChannel->connect(kCurrentEventSpace, "slot_Model_GetDirChildren",
+                            WorkspaceEventReceiver::instance(), &WorkspaceEventReceiver::handleGetDirChildren);
 
     dpfSignalDispatcher->subscribe(GlobalEventType::kSwitchViewMode,
                                    WorkspaceEventReceiver::instance(), &WorkspaceEventReceiver::handleTileBarSwitchModeTriggered);
@@ -549,3 +552,13 @@ bool WorkspaceEventReceiver::handleGetCurrentModelBusy(quint64 windowId)
     fmDebug() << "WorkspaceEventReceiver: Current view busy state:" << isBusy << "for window ID:" << windowId;
     return isBusy;
 }
+
+QList<QUrl> WorkspaceEventReceiver::handleGetDirChildren(const QUrl &url)
+{
+    // only serve what an opened view already enumerated, never start a traversal here
+    RootInfo *root = FileDataManager::instance()->findRoot(url);
+    if (!root)
+        return {};
+
+    return root->directoryChildren();
+}
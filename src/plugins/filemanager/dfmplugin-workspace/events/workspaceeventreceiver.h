@@ -87,6 +87,7 @@ public slots:
     void handleRegisterFocusFileViewDisabled(const QString &scheme);
 
     bool handleGetCurrentModelBusy(quint64 windowId);
+    QList<QUrl> handleGetDirChildren(const QUrl &url);
 
 private:
     explicit WorkspaceEventReceiver(QObject *parent = nullptr);
@@ -308,6 +308,31 @@ void FileItemData::transFileInfo()
     }
 }
 
+bool FileItemData::isRealized() const
+{
+    return info && updateOnce;
+}
+
+void FileItemData::setRealizedInfo(const FileInfoPointer &realized)
+{
+    assert(qApp->thread() == QThread::currentThread());
+    if (!realized)
+        return;
+
+    if (info.isNull()) {
+        info = realized;
+        info->customData(kItemFileRefreshIcon);
+    } else if (info != realized) {
+        // 等待期间已在 GUI 线程创建
+        return;
+    }
+
+    updateOnce = true;
+    info->setExtendedAttributes(ExtInfoType::kFileNeedUpdate, false);
+    if (info->extendAttributes(ExtInfoType::kFileLocalDevice).toBool())
+        transFileInfo();
+}
+
 bool FileItemData::isDir() const
 {
     if (info)
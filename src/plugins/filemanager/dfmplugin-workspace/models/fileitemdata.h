@@ -37,6 +37,11 @@ public:
 
     void transFileInfo();
 
+    // info 已创建并完成 updateAttributes，绘制时不需要再同步处理
+    bool isRealized() const;
+    // 设置后台线程准备好的 info，只在 GUI 线程调用
+    void setRealizedInfo(const FileInfoPointer &realized);
+
 private:
     bool isDir() const;
 
@@ -43,8 +43,11 @@ FileSelectionModel::~FileSelectionModel()
 
 bool FileSelectionModel::isSelected(const QModelIndex &index) const
 {
-    if (d->currentCommand != QItemSelectionModel::SelectionFlags(Current | Rows | ClearAndSelect))
+    if (d->currentCommand != QItemSelectionModel::SelectionFlags(Current | Rows | ClearAndSelect)) {
+        if (index.isValid() && d->rowsUsable(index))
+            return d->rows.contains(index.row());
         return QItemSelectionModel::isSelected(index);
+    }
 
     auto ret = std::any_of(d->selection.begin(), d->selection.end(), [index](const QItemSelectionRange &range) {
         return range.contains(index);
@@ -61,7 +64,7 @@ bool FileSelectionModel::isSelected(const QModelIndex &index) const
 int FileSelectionModel::selectedCount() const
 {
     if (d->currentCommand != QItemSelectionModel::SelectionFlags(Current | Rows | ClearAndSelect))
-        return selectedIndexes().count();
+        return d->rowsUsable(QModelIndex()) ? d->rows.count() : selectedIndexes().count();
 
     bool selectionValid = d->firstSelectedIndex.isValid() && d->lastSelectedIndex.isValid();
     return selectionValid ? (d->lastSelectedIndex.row() - d->firstSelectedIndex.row() + 1) : 0;
@@ -71,7 +74,15 @@ QModelIndexList FileSelectionModel::selectedIndexes() const
 {
     if (d->selectedList.isEmpty()) {
         if (d->currentCommand != QItemSelectionModel::SelectionFlags(Current | Rows | ClearAndSelect)) {
-            d->selectedList = QItemSelectionModel::selectedIndexes();
+            if (d->rowsUsable(QModelIndex())) {
+                d->selectedList.reserve(d->rows.count());
+                forEachSelectedIndex([this](const QModelIndex &index) {
+                    d->selectedList << index;
+                    return true;
+                });
+            } else {
+                d->selectedList = QItemSelectionModel::selectedIndexes();
+            }
         } else {
             for (const QItemSelectionRange &range : d->selection) {
                 d->selectedList << range.indexes();
@@ -88,6 +99,26 @@ QModelIndexList FileSelectionModel::selectedIndexes() const
     return d->selectedList;
 }
 
+/*!
+ * \brief forEachSelectedIndex 依次访问选中的项（第0列），不生成整个列表，func返回false时停止
+ */
+void FileSelectionModel::forEachSelectedIndex(const std::function<bool(const QModelIndex &)> &func) const
+{
+    if (d->currentCommand == QItemSelectionModel::SelectionFlags(Current | Rows | ClearAndSelect)
+        || !d->rowsUsable(QModelIndex())) {
+        for (const QModelIndex &index : selectedIndexes()) {
+            if (!func(index))
+                return;
+        }
+        return;
+    }
+
+    const QModelIndex &parent = d->rowsParent;
+    d->rows.forEachRow([this, &func, &parent](int row) {
+        return func(model()->index(row, 0, parent));
+    });
+}
+
 void FileSelectionModel::clearSelectList()
 {
     d->selectedList.clear();
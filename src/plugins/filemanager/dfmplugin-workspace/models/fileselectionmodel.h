@@ -9,6 +9,8 @@
 
 #include <QItemSelectionModel>
 
+#include <functional>
+
 namespace dfmplugin_workspace {
 
 class FileSelectionModelPrivate;
@@ -24,6 +26,7 @@ public:
     bool isSelected(const QModelIndex &index) const;
     int selectedCount() const;
     QModelIndexList selectedIndexes() const;
+    void forEachSelectedIndex(const std::function<bool(const QModelIndex &)> &func) const;
     void clearSelectList();
 
 public slots:
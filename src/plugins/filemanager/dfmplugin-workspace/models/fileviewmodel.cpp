@@ -324,6 +324,17 @@ FileInfoPointer FileViewModel::fileInfo(const QModelIndex &index) const
     return item->fileInfo();
 }
 
+QSharedPointer<FileItemData> FileViewModel::itemData(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.row() < 0 || filterSortWorker.isNull())
+        return nullptr;
+
+    if (!index.parent().isValid())
+        return filterSortWorker->rootData();
+
+    return filterSortWorker->childData(index.row());
+}
+
 QList<QUrl> FileViewModel::getChildrenUrls() const
 {
     if (filterSortWorker)
@@ -1257,6 +1268,13 @@ void FileViewModel::connectRootAndFilterSortWork(RootInfo *root, const bool refr
     connect(root, &RootInfo::requestSort, filterSortWorker.data(), &FileSortWorker::handleSortDir, Qt::QueuedConnection);
 
     connect(root, &RootInfo::renameFileProcessStarted, this, &FileViewModel::renameFileProcessStarted);
+    // 监视事件有丢失，重新遍历当前目录
+    connect(
+            root, &RootInfo::requestRefresh, this, [this](const QUrl &url) {
+                if (UniversalUtils::urlEquals(url, dirRootUrl))
+                    refresh();
+            },
+            Qt::QueuedConnection);
 
     fmDebug() << "Root and filter sort work connected successfully for URL:" << rootUrl();
 }
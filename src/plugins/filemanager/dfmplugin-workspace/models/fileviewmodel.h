@@ -63,6 +63,7 @@ public:
     ModelState currentState() const;
     GroupingState groupingState() const;
     FileInfoPointer fileInfo(const QModelIndex &index) const;
+    QSharedPointer<FileItemData> itemData(const QModelIndex &index) const;
     QList<QUrl> getChildrenUrls() const;
     QModelIndex getIndexByUrl(const QUrl &url) const;
 
@@ -14,6 +14,10 @@ FileSelectionModelPrivate::FileSelectionModelPrivate(FileSelectionModel *qq)
 {
     timer.setSingleShot(true);
     QObject::connect(&timer, &QTimer::timeout, q, &FileSelectionModel::updateSelecteds);
+
+    connect(q, &QItemSelectionModel::selectionChanged, this, &FileSelectionModelPrivate::onSelectionChanged);
+    connect(q, &QItemSelectionModel::modelChanged, this, &FileSelectionModelPrivate::connectModel);
+    connectModel(q->model());
 }
 
 FileSelectionModelPrivate::~FileSelectionModelPrivate()
@@ -31,4 +35,100 @@ FileSelectionModelPrivate::~FileSelectionModelPrivate()
     firstSelectedIndex = QPersistentModelIndex();
     lastSelectedIndex = QPersistentModelIndex();
     selectedList.clear();
+    rows.clear();
+}
+
+void FileSelectionModelPrivate::connectModel(QAbstractItemModel *model)
+{
+    rowsDirty = true;
+    if (!model)
+        return;
+
+    connect(model, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent, int first, int last) {
+        if (rowsParentSet && parent == rowsParent)
+            rows.insertRows(first, last - first + 1);
+    });
+    connect(model, &QAbstractItemModel::rowsRemoved, this, [this](const QModelIndex &parent, int first, int last) {
+        if (rowsParentSet && parent == rowsParent)
+            rows.removeRows(first, last - first + 1);
+    });
+
+    // the rows of the selected indexes are reordered, rebuild it on next use
+    auto markDirty = [this]() { rowsDirty = true; };
+    connect(model, &QAbstractItemModel::rowsMoved, this, markDirty);
+    connect(model, &QAbstractItemModel::layoutChanged, this, markDirty);
+    connect(model, &QAbstractItemModel::modelReset, this, markDirty);
+}
+
+void FileSelectionModelPrivate::onSelectionChanged(const QItemSelection &selected, const QItemSelection &deselected)
+{
+    if (rowsDirty)
+        return;
+
+    for (const QItemSelectionRange &range : deselected)
+        applyRange(range, false);
+    for (const QItemSelectionRange &range : selected)
+        applyRange(range, true);
+}
+
+void FileSelectionModelPrivate::applyRange(const QItemSelectionRange &range, bool select) const
+{
+    if (!range.isValid() || range.left() > 0)
+        return;
+
+    if (!rowsParentSet) {
+        rowsParent = range.parent();
+        rowsParentSet = true;
+    } else if (range.parent() != rowsParent) {
+        mixedParents = true;
+        return;
+    }
+
+    if (!select) {
+        rows.remove(range.top(), range.bottom());
+        return;
+    }
+
+    // same as QItemSelectionRange::indexes(), only selectable and enabled items
+    const QAbstractItemModel *model = range.model();
+    int first = -1;
+    for (int row = range.top(); row <= range.bottom() + 1; ++row) {
+        bool selectable = false;
+        if (row <= range.bottom()) {
+            const Qt::ItemFlags flags = model->index(row, 0, range.parent()).flags();
+            selectable = (flags & Qt::ItemIsSelectable) && (flags & Qt::ItemIsEnabled);
+        }
+
+        if (selectable && first < 0) {
+            first = row;
+        } else if (!selectable && first >= 0) {
+            rows.insert(first, row - 1);
+            first = -1;
+        }
+    }
+}
+
+void FileSelectionModelPrivate::ensureRows() const
+{
+    if (!rowsDirty)
+        return;
+
+    rowsDirty = false;
+    rows.clear();
+    rowsParent = QPersistentModelIndex();
+    rowsParentSet = false;
+    mixedParents = false;
+    for (const QItemSelectionRange &range : q->QItemSelectionModel::selection())
+        applyRange(range, true);
+}
+
+bool FileSelectionModelPrivate::rowsUsable(const QModelIndex &index) const
+{
+    ensureRows();
+    if (mixedParents)
+        return false;
+    if (!index.isValid())
+        return true;
+
+    return index.column() == 0 && rowsParentSet && index.parent() == rowsParent;
 }
@@ -6,6 +6,7 @@
 #define FILESELECTIONMODEL_P_H
 
 #include "models/fileselectionmodel.h"
+#include "selectionrowset.h"
 
 #include <QTimer>
 
@@ -21,12 +22,25 @@ public:
     explicit FileSelectionModelPrivate(FileSelectionModel *qq);
     ~FileSelectionModelPrivate() override;
 
+    void connectModel(QAbstractItemModel *model);
+    void onSelectionChanged(const QItemSelection &selected, const QItemSelection &deselected);
+    void applyRange(const QItemSelectionRange &range, bool select) const;
+    void ensureRows() const;
+    bool rowsUsable(const QModelIndex &index) const;
+
     mutable QModelIndexList selectedList;
     QItemSelection selection;
     QModelIndex firstSelectedIndex;
     QModelIndex lastSelectedIndex;
     QItemSelectionModel::SelectionFlags currentCommand;
     QTimer timer;
+
+    // the selected rows of column 0, follows selectionChanged and is rebuilt after rows move
+    mutable SelectionRowSet rows;
+    mutable QPersistentModelIndex rowsParent;
+    mutable bool rowsParentSet { false };
+    mutable bool mixedParents { false };
+    mutable bool rowsDirty { false };
 };
 
 }
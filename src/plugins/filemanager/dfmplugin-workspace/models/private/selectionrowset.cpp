@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "selectionrowset.h"
+
+#include <algorithm>
+
+using namespace dfmplugin_workspace;
+
+void SelectionRowSet::insert(int first, int last)
+{
+    if (first > last)
+        return;
+
+    auto it = ranges.upper_bound(first);
+    if (it != ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second >= first - 1)
+            it = prev;
+    }
+
+    // merge the overlapping and adjacent intervals
+    while (it != ranges.end() && it->first <= last + 1) {
+        first = std::min(first, it->first);
+        last = std::max(last, it->second);
+        rowCount -= it->second - it->first + 1;
+        it = ranges.erase(it);
+    }
+
+    ranges.emplace(first, last);
+    rowCount += last - first + 1;
+}
+
+void SelectionRowSet::remove(int first, int last)
+{
+    if (first > last)
+        return;
+
+    auto it = ranges.upper_bound(first);
+    if (it != ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second >= first)
+            it = prev;
+    }
+
+    while (it != ranges.end() && it->first <= last) {
+        const int start = it->first;
+        const int end = it->second;
+        rowCount -= end - start + 1;
+        it = ranges.erase(it);
+
+        if (start < first) {
+            ranges.emplace(start, first - 1);
+            rowCount += first - start;
+        }
+        if (end > last) {
+            ranges.emplace(last + 1, end);
+            rowCount += end - last;
+            break;
+        }
+    }
+}
+
+void SelectionRowSet::insertRows(int first, int count)
+{
+    if (count <= 0)
+        return;
+
+    std::map<int, int> shifted;
+    for (const auto &range : ranges) {
+        if (range.second < first) {
+            shifted.emplace_hint(shifted.end(), range.first, range.second);
+        } else if (range.first >= first) {
+            shifted.emplace_hint(shifted.end(), range.first + count, range.second + count);
+        } else {
+            shifted.emplace_hint(shifted.end(), range.first, first - 1);
+            shifted.emplace_hint(shifted.end(), first + count, range.second + count);
+        }
+    }
+    ranges.swap(shifted);
+}
+
+void SelectionRowSet::removeRows(int first, int count)
+{
+    if (count <= 0)
+        return;
+
+    const int last = first + count - 1;
+    remove(first, last);
+
+    std::map<int, int> shifted;
+    for (const auto &range : ranges) {
+        const int offset = range.first > last ? count : 0;
+        const int start = range.first - offset;
+        const int end = range.second - offset;
+        // the intervals at both sides of the removed rows become adjacent
+        if (!shifted.empty() && std::prev(shifted.end())->second == start - 1)
+            std::prev(shifted.end())->second = end;
+        else
+            shifted.emplace_hint(shifted.end(), start, end);
+    }
+    ranges.swap(shifted);
+}
+
+bool SelectionRowSet::contains(int row) const
+{
+    auto it = ranges.upper_bound(row);
+    if (it == ranges.begin())
+        return false;
+
+    return row <= std::prev(it)->second;
+}
+
+void SelectionRowSet::clear()
+{
+    ranges.clear();
+    rowCount = 0;
+}
+
+QList<QPair<int, int>> SelectionRowSet::intervals() const
+{
+    QList<QPair<int, int>> list;
+    list.reserve(static_cast<int>(ranges.size()));
+    for (const auto &range : ranges)
+        list.append({ range.first, range.second });
+    return list;
+}
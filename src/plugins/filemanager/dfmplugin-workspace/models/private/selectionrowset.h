@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef SELECTIONROWSET_H
+#define SELECTIONROWSET_H
+
+#include "dfmplugin_workspace_global.h"
+
+#include <QList>
+#include <QPair>
+
+#include <map>
+
+namespace dfmplugin_workspace {
+
+/*!
+ * \brief Selected rows kept as sorted, coalesced intervals
+ *
+ * Membership is a lookup in the interval map and the number of rows is
+ * kept up to date, a select all of a huge directory is one interval.
+ */
+class SelectionRowSet
+{
+public:
+    void insert(int first, int last);
+    void remove(int first, int last);
+    // keep the rows of the selected items when rows are inserted or removed before them
+    void insertRows(int first, int count);
+    void removeRows(int first, int count);
+    bool contains(int row) const;
+    int count() const { return rowCount; }
+    bool isEmpty() const { return rowCount == 0; }
+    void clear();
+    QList<QPair<int, int>> intervals() const;
+
+    // stops when func returns false
+    template<typename Func>
+    void forEachRow(Func func) const
+    {
+        for (const auto &range : ranges) {
+            for (int row = range.first; row <= range.second; ++row) {
+                if (!func(row))
+                    return;
+            }
+        }
+    }
+
+private:
+    std::map<int, int> ranges;   // first row -> last row
+    int rowCount { 0 };
+};
+
+}
+
+#endif   // SELECTIONROWSET_H
@@ -126,6 +126,7 @@ void RootInfo::startWork(const QString &key)
     fmDebug() << "Starting work for key:" << key;
 
     fmInfo() << "Starting directory traversal for URL:" << url.toString();
+    traversalCompleted = false;
     {
         QWriteLocker lk(&childrenLock);
         childrenUrlList.clear();
@@ -166,6 +167,8 @@ void RootInfo::startWatcher()
             this, &RootInfo::doFileUpdated);
     connect(watcher.data(), &AbstractFileWatcher::fileRename,
             this, &RootInfo::dofileMoved);
+    connect(watcher.data(), &AbstractFileWatcher::rescanRequested,
+            this, &RootInfo::requestRefresh);
 
     watcher->restartWatcher();
     fmDebug() << "File watcher started successfully for URL:" << url.toString();
@@ -213,6 +216,7 @@ void RootInfo::reset()
 
     disconnect();
 
+    traversalCompleted = false;
     {
         QWriteLocker lk(&childrenLock);
         childrenUrlList.clear();
@@ -264,6 +268,20 @@ bool RootInfo::canDelete() const
     return true;
 }
 
+QList<QUrl> RootInfo::directoryChildren()
+{
+    if (!traversalCompleted)
+        return {};
+
+    QList<QUrl> dirs;
+    QReadLocker lk(&childrenLock);
+    for (const auto &sortInfo : sourceDataList) {
+        if (sortInfo && sortInfo->isDir())
+            dirs.append(sortInfo->fileUrl());
+    }
+    return dirs;
+}
+
 bool RootInfo::checkKeyOnly(const QString &key) const
 {
     for (auto threadKey : traversalThreads.keys()) {
@@ -513,6 +531,7 @@ void RootInfo::handleTraversalFinish(const QString &travseToken)
     bool noDataProduced = isFirstBatch.load();
     // Reset isFirstBatch
     isFirstBatch.store(false);
+    traversalCompleted = true;
 
     fmDebug() << "Emitting traversal finished signal - noDataProduced:" << noDataProduced;
     // Emit signal with additional parameter indicating if no data was produced
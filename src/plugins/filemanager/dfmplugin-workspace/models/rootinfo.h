@@ -60,6 +60,8 @@ public:
     QStringList connectTokens() const { return connectedTokens; }
 
     bool canDelete() const;
+    // children directories once the traversal finished, empty otherwise
+    QList<QUrl> directoryChildren();
 
     bool checkKeyOnly(const QString &key) const;
 
@@ -84,6 +86,7 @@ Q_SIGNALS:
     void requestTreeSortDir(const QString &key, const QUrl &parent);
     void renameFileProcessStarted();
     void requestClearRoot(const QUrl &url);
+    void requestRefresh(const QUrl &url);
 
 public Q_SLOTS:
     void doFileDeleted(const QUrl &url);
@@ -152,6 +155,7 @@ private:
     QList<QSharedPointer<QThread>> threads {};
     std::atomic_bool needStartWatcher { true };
     std::atomic_bool isRefresh { false };
+    std::atomic_bool traversalCompleted { false };
     QStringList connectedTokens;
 
     std::atomic_bool isDying { false };
@@ -36,6 +36,11 @@ RootInfo *FileDataManager::fetchRoot(const QUrl &url, const QString &key)
     return createRoot(normalizedUrl);
 }
 
+RootInfo *FileDataManager::findRoot(const QUrl &url) const
+{
+    return rootInfoMap.value(normalizeRootUrl(url), nullptr);
+}
+
 bool FileDataManager::fetchFiles(const QUrl &rootUrl, const QString &key, DFMGLOBAL_NAMESPACE::ItemRoles role, Qt::SortOrder order)
 {
     const QUrl normalizedRootUrl = normalizeRootUrl(rootUrl);
@@ -28,6 +28,8 @@ public:
 
     // NOTE: do not call this from delegate paint/sizeHint paths.
     RootInfo *fetchRoot(const QUrl &url, const QString &key = QString());
+    // lookup only, unlike fetchRoot() it neither creates the root nor registers a user
+    RootInfo *findRoot(const QUrl &url) const;
 
     bool fetchFiles(const QUrl &rootUrl,
                     const QString &key,
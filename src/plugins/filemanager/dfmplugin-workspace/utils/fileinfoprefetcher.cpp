@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "fileinfoprefetcher.h"
+#include "views/fileview.h"
+#include "models/fileviewmodel.h"
+
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/base/configs/dconfig/dconfigmanager.h>
+#include <dfm-base/utils/processprioritymanager.h>
+
+#include <QTimer>
+#include <QScrollBar>
+#include <QThreadPool>
+
+#include <climits>
+
+DFMBASE_USE_NAMESPACE
+DFMGLOBAL_USE_NAMESPACE
+DPWORKSPACE_USE_NAMESPACE
+using namespace GlobalDConfDefines::ConfigPath;
+using namespace GlobalDConfDefines::BaseConfig;
+
+namespace {
+constexpr int kWorkerCount = 2;
+constexpr int kPublishInterval = 16;   // 约一帧
+constexpr int kVelocityResetMs = 300;   // 超过此间隔视为重新开始滚动
+constexpr double kLookaheadSeconds = 0.5;
+constexpr int kMaxAheadPages = 8;
+constexpr int kPoolThreadCount = 4;   // 所有视图共用，卡在慢速挂载上的任务不影响新视图
+
+// 线程池的析构会等待任务结束，因此不销毁
+QThreadPool *prefetchPool()
+{
+    static QThreadPool *pool = [] {
+        QThreadPool *p = new QThreadPool;
+        p->setMaxThreadCount(kPoolThreadCount);
+        return p;
+    }();
+    return pool;
+}
+}   // namespace
+
+FileInfoPrefetcher::FileInfoPrefetcher(FileView *parent)
+    : QObject(parent),
+      view(parent),
+      state(new State)
+{
+    enabled = DConfigManager::instance()->value(kViewDConfName, kViewPrefetchEnable, true).toBool();
+
+    scheduleTimer = new QTimer(this);
+    scheduleTimer->setSingleShot(true);
+    scheduleTimer->setInterval(0);
+    connect(scheduleTimer, &QTimer::timeout, this, &FileInfoPrefetcher::schedule);
+
+    publishTimer = new QTimer(this);
+    publishTimer->setSingleShot(true);
+    publishTimer->setInterval(kPublishInterval);
+    connect(publishTimer, &QTimer::timeout, this, &FileInfoPrefetcher::publish);
+    state->publishTimer = publishTimer;
+
+    connect(view->verticalScrollBar(), &QScrollBar::valueChanged, this, &FileInfoPrefetcher::onScrolled);
+}
+
+FileInfoPrefetcher::~FileInfoPrefetcher()
+{
+    // 不等待执行中的任务，它们在下一步之前退出，已投递给 publishTimer 的事件随对象删除
+    QMutexLocker lk(&state->mutex);
+    state->stopped = true;
+    state->queue.clear();
+    state->finished.clear();
+    state->publishTimer = nullptr;
+}
+
+bool FileInfoPrefetcher::isEnabled() const
+{
+    return enabled;
+}
+
+bool FileInfoPrefetcher::requestRealize(const QModelIndex &index)
+{
+    if (!enabled || !index.isValid() || !index.parent().isValid() || !view->model())
+        return false;
+
+    const FileItemDataPointer &item = view->model()->itemData(index);
+    if (!item || item->isRealized())
+        return false;
+    if (failed.contains(item->data(kItemUrlRole).toUrl()))
+        return false;
+
+    if (!inProgress.contains(item.data()) && !scheduleTimer->isActive())
+        scheduleTimer->start();
+    return true;
+}
+
+void FileInfoPrefetcher::onScrolled(int value)
+{
+    const int delta = value - lastScrollValue;
+    lastScrollValue = value;
+    if (delta != 0)
+        direction = delta > 0 ? 1 : -1;
+
+    const qint64 elapsed = scrollClock.isValid() ? scrollClock.restart() : -1;
+    if (!scrollClock.isValid())
+        scrollClock.start();
+
+    if (elapsed <= 0 || elapsed > kVelocityResetMs) {
+        velocity = 0;
+    } else {
+        // 平滑瞬时速度，避免滚轮的单次跳动造成预测范围抖动
+        const double instant = qAbs(delta) * 1000.0 / elapsed;
+        velocity = velocity * 0.4 + instant * 0.6;
+    }
+
+    if (enabled && !scheduleTimer->isActive())
+        scheduleTimer->start();
+}
+
+QList<int> FileInfoPrefetcher::predictRows() const
+{
+    QRect visibleRect = view->viewport()->rect();
+    visibleRect.moveTop(view->verticalOffset());
+    const auto &ranges = view->visibleIndexes(visibleRect);
+    if (ranges.isEmpty())
+        return {};
+
+    int first = INT_MAX;
+    int last = -1;
+    for (const auto &range : ranges) {
+        first = qMin(first, range.first);
+        last = qMax(last, range.second);
+    }
+    if (last < first)
+        return {};
+
+    const int rowCount = view->model()->rowCount(view->rootIndex());
+    const int page = last - first + 1;
+    // 按当前速度估计 kLookaheadSeconds 内滚过的行数，至少预取一页
+    const double rowsPerPixel = page / qMax(1.0, static_cast<double>(visibleRect.height()));
+    const int ahead = qBound(page, static_cast<int>(velocity * rowsPerPixel * kLookaheadSeconds), page * kMaxAheadPages);
+    const int behind = page / 2;
+
+    QList<int> rows;
+    rows.reserve(page + ahead + behind);
+    // 可见行优先，按滚动方向排列
+    if (direction > 0) {
+        for (int row = first; row <= last; ++row)
+            rows.append(row);
+        for (int row = last + 1; row <= qMin(rowCount - 1, last + ahead); ++row)
+            rows.append(row);
+        for (int row = first - 1; row >= qMax(0, first - behind); --row)
+            rows.append(row);
+    } else {
+        for (int row = last; row >= first; --row)
+            rows.append(row);
+        for (int row = first - 1; row >= qMax(0, first - ahead); --row)
+            rows.append(row);
+        for (int row = last + 1; row <= qMin(rowCount - 1, last + behind); ++row)
+            rows.append(row);
+    }
+    return rows;
+}
+
+void FileInfoPrefetcher::schedule()
+{
+    FileViewModel *model = view->model();
+    if (!enabled || !model)
+        return;
+
+    const QModelIndex &root = view->rootIndex();
+    const QList<int> &rows = predictRows();
+
+    QMutexLocker lk(&state->mutex);
+    // 未开始的任务换成新的预测范围
+    for (const Task &task : std::as_const(state->queue))
+        inProgress.remove(task.item.data());
+    state->queue.clear();
+
+    for (int row : rows) {
+        const FileItemDataPointer &item = model->itemData(model->index(row, 0, root));
+        if (!item || item->isRealized() || inProgress.contains(item.data()))
+            continue;
+        const QUrl &url = item->data(kItemUrlRole).toUrl();
+        if (failed.contains(url))
+            continue;
+        state->queue.append({ item, url, item->fileInfo() });
+        inProgress.insert(item.data());
+    }
+
+    while (state->workers < kWorkerCount && state->workers < state->queue.size()) {
+        ++state->workers;
+        prefetchPool()->start([state = state] { work(state); });
+    }
+}
+
+bool FileInfoPrefetcher::isStopped(State *state)
+{
+    QMutexLocker lk(&state->mutex);
+    return state->stopped;
+}
+
+void FileInfoPrefetcher::work(const QSharedPointer<State> &state)
+{
+    // I/O 优先级按线程设置，只影响预取线程
+    thread_local bool ioPriorityLowered = false;
+    if (!ioPriorityLowered) {
+        ProcessPriorityManager::lowerIoPriority();
+        ioPriorityLowered = true;
+    }
+
+    Q_FOREVER {
+        Task task;
+        {
+            QMutexLocker lk(&state->mutex);
+            if (state->queue.isEmpty() || state->stopped) {
+                --state->workers;
+                return;
+            }
+            task = state->queue.takeFirst();
+        }
+
+        // 每一步都可能阻塞在慢速设备上，视图销毁后不再继续
+        if (!task.info)
+            task.info = InfoFactory::create<FileInfo>(task.url);
+        if (task.info && !isStopped(state.data()))
+            task.info->updateAttributes();
+        if (task.info && !isStopped(state.data())) {
+            // 图标和 MIME 类型在首次访问时解析并缓存在 info 中
+            task.info->fileIcon();
+            task.info->displayOf(DisPlayInfoType::kMimeTypeDisplayName);
+        }
+
+        QMutexLocker lk(&state->mutex);
+        if (state->stopped)
+            continue;
+        if (state->finished.isEmpty())
+            QMetaObject::invokeMethod(state->publishTimer, "start", Qt::QueuedConnection);
+        state->finished.append(task);
+    }
+}
+
+void FileInfoPrefetcher::publish()
+{
+    QList<Task> batch;
+    {
+        QMutexLocker lk(&state->mutex);
+        batch.swap(state->finished);
+    }
+
+    if (batch.isEmpty())
+        return;
+
+    for (const Task &task : std::as_const(batch)) {
+        inProgress.remove(task.item.data());
+        if (!task.info) {
+            fmWarning() << "Prefetch FileInfo failed, create it on demand - url:" << task.url;
+            failed.insert(task.url);
+            continue;
+        }
+        task.item->setRealizedInfo(task.info);
+    }
+
+    // 一批只刷新一次视口
+    view->viewport()->update();
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef FILEINFOPREFETCHER_H
+#define FILEINFOPREFETCHER_H
+
+#include "dfmplugin_workspace_global.h"
+#include "models/fileitemdata.h"
+
+#include <QObject>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QElapsedTimer>
+#include <QModelIndex>
+#include <QSet>
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+QT_END_NAMESPACE
+
+namespace dfmplugin_workspace {
+
+class FileView;
+
+/*!
+ * \brief 按视口预取文件信息
+ *
+ * 根据可见范围和滚动速度预测接下来要显示的行，在后台线程（低 I/O 优先级）创建 FileInfo
+ * 并解析图标和 MIME 类型，完成的行成批交回 GUI 线程。绘制时信息未就绪的行使用占位内容，
+ * 不在 paint 中同步创建。
+ *
+ * 任务与预取器共享状态，视图销毁时不等待执行中的任务：任务在步骤之间检查 stopped，
+ * 结果直接丢弃。
+ */
+class FileInfoPrefetcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit FileInfoPrefetcher(FileView *parent);
+    ~FileInfoPrefetcher() override;
+
+    bool isEnabled() const;
+    // 行的信息尚未就绪时安排预取并返回 true，调用方使用占位内容
+    bool requestRealize(const QModelIndex &index);
+
+private Q_SLOTS:
+    void onScrolled(int value);
+    void schedule();
+    void publish();
+
+private:
+    struct Task
+    {
+        FileItemDataPointer item;
+        QUrl url;
+        FileInfoPointer info;
+    };
+
+    // 工作线程可能比预取器活得久，共享的部分由任务一起持有
+    struct State
+    {
+        QMutex mutex;
+        QList<Task> queue;
+        QList<Task> finished;
+        int workers { 0 };
+        bool stopped { false };   // 在 mutex 下修改，置位后不再访问 publishTimer
+        QTimer *publishTimer { nullptr };
+    };
+
+    QList<int> predictRows() const;
+    static void work(const QSharedPointer<State> &state);
+    static bool isStopped(State *state);
+
+    FileView *view { nullptr };
+    bool enabled { true };
+    QTimer *scheduleTimer { nullptr };   // 合并同一轮事件中的多次请求
+    QTimer *publishTimer { nullptr };   // 完成的行成批发布
+
+    QElapsedTimer scrollClock;
+    int lastScrollValue { 0 };
+    double velocity { 0 };   // 像素/秒
+    int direction { 1 };
+
+    QSharedPointer<State> state;
+
+    // 以下只在 GUI 线程访问
+    QSet<FileItemData *> inProgress;   // 排队、执行中或未发布
+    QSet<QUrl> failed;   // 创建失败的走原来的同步路径
+};
+
+}
+
+#endif   // FILEINFOPREFETCHER_H
@@ -10,6 +10,7 @@
 #include "views/listitemeditor.h"
 #include "utils/workspacehelper.h"
 #include "utils/fileoperatorhelper.h"
+#include "utils/fileinfoprefetcher.h"
 #include "events/workspaceeventsequence.h"
 
 #include <dfm-base/base/application/application.h>
@@ -97,7 +98,8 @@ bool FileViewHelper::isTransparent(const QModelIndex &index) const
 
 const FileInfoPointer FileViewHelper::fileInfo(const QModelIndex &index) const
 {
-    if (!parent()->isVerticalScrollBarSliderDragging())
+    // 未就绪的行交给预取线程，绘制先用占位内容
+    if (!parent()->isVerticalScrollBarSliderDragging() && !prefetcher->requestRealize(index))
         index.data(kItemCreateFileInfoRole);
 
     return parent()->model()->fileInfo(index);
@@ -479,6 +481,8 @@ void FileViewHelper::init()
 {
     fmDebug() << "Initializing FileViewHelper components";
 
+    prefetcher = new FileInfoPrefetcher(parent());
+
     keyboardSearchTimer = new QTimer(this);
     keyboardSearchTimer->setSingleShot(true);
     keyboardSearchTimer->setInterval(200);
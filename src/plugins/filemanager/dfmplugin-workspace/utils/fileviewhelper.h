@@ -19,6 +19,7 @@ extern const char *const kEidtorShowSuffix;
 class BaseItemDelegate;
 class FileViewModel;
 class FileView;
+class FileInfoPrefetcher;
 
 class FileViewHelper : public QObject
 {
@@ -75,6 +76,7 @@ private:
 
     QByteArray keyboardSearchKeys;
     QTimer *keyboardSearchTimer;
+    FileInfoPrefetcher *prefetcher { nullptr };
 };
 
 }
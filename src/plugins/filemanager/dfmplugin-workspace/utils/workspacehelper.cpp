@@ -13,6 +13,7 @@
 #include <dfm-base/base/schemefactory.h>
 #include <dfm-base/utils/fileutils.h>
 #include <dfm-base/base/application/application.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/base/application/settings.h>
 #include <dfm-base/utils/universalutils.h>
 
@@ -627,14 +628,14 @@ QUrl WorkspaceHelper::transformViewModeUrl(const QUrl &url) const
 QVariant WorkspaceHelper::getFileViewStateValue(const QUrl &url, const QString &key, const QVariant &defaultValue) const
 {
     QUrl viewModeUrl = transformViewModeUrl(url);
-    QMap<QString, QVariant> valueMap = Application::appObtuselySetting()->value("FileViewState", viewModeUrl).toMap();
+    QMap<QString, QVariant> valueMap = Application::fileViewStateStore()->value(viewModeUrl).toMap();
     return valueMap.value(key, defaultValue);
 }
 
 void WorkspaceHelper::setFileViewStateValue(const QUrl &url, const QString &key, const QVariant &value)
 {
     QUrl viewModeUrl = transformViewModeUrl(url);
-    QVariantMap map = Application::appObtuselySetting()->value("FileViewState", viewModeUrl).toMap();
+    QVariantMap map = Application::fileViewStateStore()->value(viewModeUrl).toMap();
     map[key] = value;
-    Application::appObtuselySetting()->setValue("FileViewState", viewModeUrl, map);
+    Application::fileViewStateStore()->setValue(viewModeUrl, map);
 }
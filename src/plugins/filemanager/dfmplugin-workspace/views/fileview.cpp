@@ -29,7 +29,7 @@
 #include <dfm-base/dfm_event_defines.h>
 #include <dfm-base/dfm_global_defines.h>
 #include <dfm-base/base/application/application.h>
-#include <dfm-base/base/application/settings.h>
+#include <dfm-base/base/application/fileviewstatestore.h>
 #include <dfm-base/utils/windowutils.h>
 #include <dfm-base/utils/universalutils.h>
 #include <dfm-base/utils/networkutils.h>
@@ -335,11 +335,16 @@ QList<QUrl> FileView::selectedUrlList() const
     QModelIndex rootIndex = this->rootIndex();
     QList<QUrl> list;
 
-    for (const QModelIndex &index : selectedIndexes()) {
-        if (index.parent() != rootIndex)
-            continue;
-        list << model()->data(index, ItemRoles::kItemUrlRole).toUrl();
-    }
+    FileSelectionModel *fileSelectionModel = qobject_cast<FileSelectionModel *>(selectionModel());
+    if (!fileSelectionModel)
+        return list;
+
+    // the selected urls are read row by row, without a list of all the selected indexes
+    fileSelectionModel->forEachSelectedIndex([&](const QModelIndex &index) {
+        if (index.isValid() && index.parent() == rootIndex)
+            list << model()->data(index, ItemRoles::kItemUrlRole).toUrl();
+        return true;
+    });
 
     return list;
 }
@@ -2490,7 +2495,7 @@ void FileView::initializeConnect()
     connect(Application::instance(), &Application::showedFileSuffixChanged, this, &FileView::onShowFileSuffixChanged);
     connect(Application::instance(), &Application::previewAttributeChanged, this, &FileView::onWidgetUpdate);
     connect(Application::instance(), &Application::viewModeChanged, this, &FileView::onDefaultViewModeChanged);
-    connect(Application::appObtuselySetting(), &Settings::valueChanged, this, &FileView::onAppAttributeChanged);
+    connect(Application::fileViewStateStore(), &FileViewStateStore::valueChanged, this, &FileView::onAppAttributeChanged);
     connect(DGuiApplicationHelper::instance(), &DGuiApplicationHelper::sizeModeChanged, this, [this]() {
         if (d->currentViewMode == Global::ViewMode::kIconMode)
             d->adjustIconModeSpacing(model()->groupingStrategy());
@@ -37,6 +37,7 @@ class FileView final : public DListView, public DFMBASE_NAMESPACE::AbstractBaseV
     friend class FileViewPrivate;
     friend class FileViewHelper;
     friend class ViewAnimationHelper;
+    friend class FileInfoPrefetcher;
     friend class IconItemDelegate;
 
     QSharedPointer<FileViewPrivate> d;
@@ -75,6 +75,7 @@ class Workspace : public dpf::Plugin
     DPF_EVENT_REG_SLOT(slot_Model_RegisterDataCache)
     DPF_EVENT_REG_SLOT(slot_Model_RegisterLoadStrategy)
     DPF_EVENT_REG_SLOT(slot_Model_GetCurrentBusy)
+    DPF_EVENT_REG_SLOT(slot_Model_GetDirChildren)
 
     // hook events
     DPF_EVENT_REG_HOOK(hook_SendOpenWindow)
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "cryptsetup.h"
+#include "reencryptcontroller.h"
 #include "diskencrypt_global.h"
 #include "helpers/blockdevhelper.h"
 #include "helpers/filesystemhelper.h"
@@ -368,14 +369,18 @@ int crypt_setup::csResumeEncrypt(const QString &dev, const QString &activeName,
                          name.toStdString().c_str());
     }
 
+    // datashift resilience moves data by data_shift, a hotzone cannot be larger
+    const uint64_t dataShift = 32 * 1024;
+    ReencryptController controller(dev, displayName, ReencryptController::kEncrypt);
+    controller.probeThroughput();
     struct crypt_params_reencrypt encArgs
     {
         .mode = CRYPT_REENCRYPT_REENCRYPT,
         .direction = CRYPT_REENCRYPT_BACKWARD,
         .resilience = "datashift",
         .hash = "sha256",
-        .data_shift = 32 * 1024,
-        .max_hotzone_size = 0,
+        .data_shift = dataShift,
+        .max_hotzone_size = controller.hotzoneSectors(dataShift),
         .device_size = 0,
         .flags = CRYPT_REENCRYPT_RESUME_ONLY | CRYPT_REENCRYPT_MOVE_FIRST_SEGMENT
     };
@@ -395,11 +400,10 @@ int crypt_setup::csResumeEncrypt(const QString &dev, const QString &activeName,
         return -disk_encrypt::kErrorInitReencrypt;
     }
 
-    qInfo() << "[crypt_setup::csResumeEncrypt] Processing encryption, device:" << dev;
-    QPair<QString, QString> devInfo { dev, displayName };
+    qInfo() << "[crypt_setup::csResumeEncrypt] Processing encryption, device:" << dev << "hotzone sectors:" << encArgs.max_hotzone_size;
     r = crypt_reencrypt_run(cdev,
-                            crypt_setup_helper::onEncrypting,
-                            (void *)&devInfo);
+                            ReencryptController::onProgress,
+                            (void *)&controller);
     qInfo() << "[crypt_setup::csResumeEncrypt] Encryption process finished, device:" << dev << "result:" << r;
     if (r < 0) {
         qCritical() << "[crypt_setup::csResumeEncrypt] Reencrypt failed, device:" << dev << "error:" << r << " (" << strerror(-r) << ")";
@@ -408,24 +412,6 @@ int crypt_setup::csResumeEncrypt(const QString &dev, const QString &activeName,
     return disk_encrypt::kSuccess;
 }
 
-int crypt_setup_helper::onEncrypting(uint64_t size, uint64_t offset, void *usrptr)
-{
-    auto dev = reinterpret_cast<QPair<QString, QString> *>(usrptr);
-    Q_EMIT NotificationHelper::instance()->notifyEncryptProgress(dev->first,
-                                                                 dev->second,
-                                                                 double(1.0 * offset / size));
-    return 0;
-}
-
-int crypt_setup_helper::onDecrypting(uint64_t size, uint64_t offset, void *usrptr)
-{
-    auto dev = reinterpret_cast<QPair<QString, QString> *>(usrptr);
-    Q_EMIT NotificationHelper::instance()->notifyDecryptProgress(dev->first,
-                                                                 dev->second,
-                                                                 double(1.0 * offset / size));
-    return 0;
-}
-
 int crypt_setup_helper::backupDetachHeader(const QString &dev, QString *fileHeader)
 {
     qDebug() << "[crypt_setup_helper::backupDetachHeader] Backing up detach header, device:" << dev;
@@ -610,6 +596,8 @@ int crypt_setup::csDecrypt(const QString &dev, const QString &passphrase, const
 
     bool resumeOnly = flags & CRYPT_REQUIREMENT_ONLINE_REENCRYPT;
     auto shift = crypt_get_data_offset(cdev);
+    ReencryptController controller(dev, displayName, ReencryptController::kDecrypt);
+    controller.probeThroughput();
     struct crypt_params_reencrypt encArgs
     {
         .mode = CRYPT_REENCRYPT_DECRYPT,
@@ -617,7 +605,7 @@ int crypt_setup::csDecrypt(const QString &dev, const QString &passphrase, const
         .resilience = resumeOnly ? nullptr : "datashift-checksum",
         .hash = "sha256",
         .data_shift = shift,
-        .max_hotzone_size = 0,
+        .max_hotzone_size = controller.hotzoneSectors(shift),
         .device_size = 0,
         .flags = resumeOnly ? CRYPT_REENCRYPT_RESUME_ONLY : CRYPT_REENCRYPT_MOVE_FIRST_SEGMENT
     };
@@ -637,11 +625,10 @@ int crypt_setup::csDecrypt(const QString &dev, const QString &passphrase, const
         return -disk_encrypt::kErrorWrongPassphrase;   // might not pass wrong.
     }
 
-    qInfo() << "[crypt_setup::csDecrypt] Processing decryption, device:" << dev;
-    QPair<QString, QString> devInfo { dev, displayName };
+    qInfo() << "[crypt_setup::csDecrypt] Processing decryption, device:" << dev << "hotzone sectors:" << encArgs.max_hotzone_size;
     r = crypt_reencrypt_run(cdev,
-                            crypt_setup_helper::onDecrypting,
-                            (void *)&devInfo);
+                            ReencryptController::onProgress,
+                            (void *)&controller);
     qInfo() << "[crypt_setup::csDecrypt] Decryption process finished, device:" << dev << "result:" << r;
     if (r < 0) {
         qCritical() << "[crypt_setup::csDecrypt] Decrypt device failed, device:" << dev << "error:" << r << " (" << strerror(-r) << ")";
@@ -1140,6 +1127,8 @@ int crypt_setup::csDecryptMoveHead(const QString &dev, const QString &passphrase
                          name.toStdString().c_str());
     }
 
+    ReencryptController controller(dev, displayName, ReencryptController::kDecrypt);
+    controller.probeThroughput();
     struct crypt_params_reencrypt encArgs
     {
         .mode = CRYPT_REENCRYPT_DECRYPT,
@@ -1147,7 +1136,7 @@ int crypt_setup::csDecryptMoveHead(const QString &dev, const QString &passphrase
         .resilience = "checksum",
         .hash = "sha256",
         .data_shift = 0,
-        .max_hotzone_size = 0,
+        .max_hotzone_size = controller.hotzoneSectors(),
         .device_size = 0
     };
 
@@ -1165,10 +1154,9 @@ int crypt_setup::csDecryptMoveHead(const QString &dev, const QString &passphrase
         return -disk_encrypt::kErrorWrongPassphrase;   // might not pass wrong.
     }
 
-    QPair<QString, QString> devInfo { dev, displayName };
     r = crypt_reencrypt_run(cdev,
-                            crypt_setup_helper::onDecrypting,
-                            (void *)&devInfo);
+                            ReencryptController::onProgress,
+                            (void *)&controller);
     if (r < 0) {
         qCritical() << "[crypt_setup::csDecryptMoveHead] Decrypt device failed, device:" << dev << "error:" << r << " (" << strerror(-r) << ")";
         return -disk_encrypt::kErrorReencryptFailed;
@@ -48,8 +48,6 @@ int encryptStatus(const QString &dev);
 int setToken(const QString &dev, const QString &token);
 int getToken(const QString &dev, QString *token);
 int getRecoveryKeySlots(const QString &dev, QList<int> *keySlots);
-int onEncrypting(uint64_t size, uint64_t offset, void *usrptr);
-int onDecrypting(uint64_t size, uint64_t offset, void *usrptr);
 
 enum HeaderStatus {
     kInvalidHeader = -1,
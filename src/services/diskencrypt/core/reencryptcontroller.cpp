@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "reencryptcontroller.h"
+#include "helpers/notificationhelper.h"
+
+#include <dfm-base/utils/finallyutil.h>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QThread>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+FILE_ENCRYPT_USE_NS
+
+static constexpr quint64 kSectorSize { 512 };
+static constexpr quint64 kMinHotzone { 4 * 1024 * 1024 };
+static constexpr quint64 kMaxHotzone { 64 * 1024 * 1024 };
+static constexpr size_t kProbeChunk { 1024 * 1024 };
+static constexpr int kProbeChunks { 64 };
+static constexpr int kProbeTimeout { 300 };   // ms
+static constexpr double kLatencyFactor { 3.0 };
+static constexpr double kMinLatency { 20.0 };   // ms, ignore jitter of fast disks
+static constexpr int kDelayStep { 50 };   // ms
+static constexpr int kMaxDelay { 1000 };   // ms
+static constexpr int kReportInterval { 1000 };   // ms
+
+ReencryptController::ReencryptController(const QString &dev, const QString &displayName, Direction direction)
+    : dev(dev), name(displayName), dir(direction)
+{
+}
+
+quint64 ReencryptController::probeThroughput()
+{
+    probedThroughput = 0;
+
+    int fd = ::open(dev.toStdString().c_str(), O_RDONLY | O_DIRECT);
+    if (fd < 0) {
+        qWarning() << "[ReencryptController::probeThroughput] Cannot open device:" << dev << "error:" << strerror(errno);
+        return 0;
+    }
+
+    void *buf { nullptr };
+    dfmbase::FinallyUtil atFinish([&] {
+        ::close(fd);
+        if (buf) ::free(buf);
+    });
+
+    if (::posix_memalign(&buf, 4096, kProbeChunk) != 0) {
+        buf = nullptr;
+        return 0;
+    }
+
+    quint64 total = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < kProbeChunks && timer.elapsed() < kProbeTimeout; ++i) {
+        ssize_t n = ::read(fd, buf, kProbeChunk);
+        if (n <= 0)
+            break;
+        total += static_cast<quint64>(n);
+    }
+
+    qint64 elapsed = timer.nsecsElapsed();
+    if (total == 0 || elapsed <= 0)
+        return 0;
+
+    probedThroughput = total * 1000000000 / static_cast<quint64>(elapsed);
+    qInfo() << "[ReencryptController::probeThroughput] Device:" << dev << "read throughput:" << probedThroughput << "B/s";
+    return probedThroughput;
+}
+
+quint64 ReencryptController::hotzoneSectors(quint64 limitSectors) const
+{
+    return hotzoneSectorsFor(probedThroughput, limitSectors);
+}
+
+quint64 ReencryptController::hotzoneSectorsFor(quint64 bytesPerSecond, quint64 limitSectors)
+{
+    // unknown, let libcryptsetup use its default
+    if (bytesPerSecond == 0)
+        return 0;
+
+    quint64 bytes = qBound(kMinHotzone, bytesPerSecond, kMaxHotzone);
+    quint64 hotzone = kMinHotzone;
+    while (hotzone * 2 <= bytes)
+        hotzone *= 2;
+
+    quint64 sectors = hotzone / kSectorSize;
+    if (limitSectors > 0 && sectors > limitSectors)
+        sectors = limitSectors;
+    return sectors;
+}
+
+int ReencryptController::updateThrottle(double awaitMs)
+{
+    if (awaitMs <= 0)
+        return delay;
+
+    if (baselineAwait <= 0 || awaitMs < baselineAwait)
+        baselineAwait = awaitMs;
+
+    if (awaitMs > kMinLatency && awaitMs > baselineAwait * kLatencyFactor)
+        delay = qMin(delay + kDelayStep, kMaxDelay);
+    else
+        delay /= 2;
+
+    return delay;
+}
+
+qint64 ReencryptController::remainingSeconds(quint64 size, quint64 offset) const
+{
+    if (rate == 0 || offset >= size)
+        return offset >= size ? 0 : -1;
+    return static_cast<qint64>((size - offset) / rate);
+}
+
+int ReencryptController::onProgress(uint64_t size, uint64_t offset, void *usrptr)
+{
+    auto controller = reinterpret_cast<ReencryptController *>(usrptr);
+    return controller ? controller->handleProgress(size, offset) : 0;
+}
+
+int ReencryptController::handleProgress(quint64 size, quint64 offset)
+{
+    double progress = size > 0 ? double(1.0 * offset / size) : 0;
+    if (dir == kEncrypt)
+        Q_EMIT NotificationHelper::instance()->notifyEncryptProgress(dev, name, progress);
+    else
+        Q_EMIT NotificationHelper::instance()->notifyDecryptProgress(dev, name, progress);
+
+    updateRate(offset);
+    if (rate > 0 && (!reportTimer.isValid() || reportTimer.elapsed() >= kReportInterval || offset >= size)) {
+        reportTimer.start();
+        qint64 remaining = remainingSeconds(size, offset);
+        if (dir == kEncrypt)
+            Q_EMIT NotificationHelper::instance()->notifyEncryptRate(dev, name, static_cast<qint64>(rate), remaining);
+        else
+            Q_EMIT NotificationHelper::instance()->notifyDecryptRate(dev, name, static_cast<qint64>(rate), remaining);
+    }
+
+    double await = 0;
+    if (offset < size && sampleAwait(&await)) {
+        int wait = updateThrottle(await);
+        if (wait > 0)
+            QThread::msleep(static_cast<unsigned long>(wait));
+    }
+    return 0;
+}
+
+void ReencryptController::updateRate(quint64 offset)
+{
+    if (!rateTimer.isValid() || offset < lastOffset) {
+        rateTimer.start();
+        lastOffset = offset;
+        return;
+    }
+
+    qint64 elapsed = rateTimer.nsecsElapsed();
+    if (elapsed <= 0 || offset == lastOffset)
+        return;
+
+    // the delay of the throttle is included, it is part of the remaining time
+    quint64 current = (offset - lastOffset) * 1000000000 / static_cast<quint64>(elapsed);
+    rate = rate == 0 ? current : (rate * 3 + current) / 4;
+    rateTimer.start();
+    lastOffset = offset;
+}
+
+bool ReencryptController::sampleAwait(double *awaitMs)
+{
+    QFile stat(statPath());
+    if (!stat.open(QIODevice::ReadOnly))
+        return false;
+
+    // see Documentation/block/stat.rst: reads, -, -, read ticks, writes, -, -, write ticks...
+    const QList<QByteArray> fields = stat.readAll().simplified().split(' ');
+    if (fields.size() < 8)
+        return false;
+
+    quint64 ios = fields.at(0).toULongLong() + fields.at(4).toULongLong();
+    quint64 ticks = fields.at(3).toULongLong() + fields.at(7).toULongLong();
+    bool hasPrevious = statValid && ios > lastIos && ticks >= lastTicks;
+    double await = hasPrevious ? double(ticks - lastTicks) / double(ios - lastIos) : 0;
+
+    statValid = true;
+    lastIos = ios;
+    lastTicks = ticks;
+    if (!hasPrevious)
+        return false;
+
+    *awaitMs = await;
+    return true;
+}
+
+QString ReencryptController::statPath() const
+{
+    // /dev/mapper/xxx is a link to /dev/dm-N
+    QString path = QFileInfo(dev).canonicalFilePath();
+    if (path.isEmpty())
+        path = dev;
+    return QString("/sys/class/block/%1/stat").arg(QFileInfo(path).fileName());
+}
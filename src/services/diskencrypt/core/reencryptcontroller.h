@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef REENCRYPTCONTROLLER_H
+#define REENCRYPTCONTROLLER_H
+
+#include "diskencrypt_global.h"
+
+#include <QElapsedTimer>
+
+FILE_ENCRYPT_BEGIN_NS
+
+/*!
+ * \brief Tunes and paces one crypt_reencrypt_run
+ *
+ * Before the run the raw read throughput of the device is probed, the hotzone
+ * is sized to about one second of work so that progress, crash recovery window
+ * and the time the device is held exclusively stay bounded on slow disks while
+ * fast disks are not flooded with tiny hotzones.
+ *
+ * During the run the progress callback, which is invoked after each hotzone,
+ * compares the average I/O latency of the device with the lowest one seen so
+ * far. When foreground I/O makes it grow the next hotzone is delayed, additive
+ * increase, multiplicative decrease, so the system stays usable. Throughput
+ * and remaining time are reported alongside the progress.
+ */
+class ReencryptController
+{
+public:
+    enum Direction {
+        kEncrypt,
+        kDecrypt
+    };
+
+    ReencryptController(const QString &dev, const QString &displayName, Direction direction);
+
+    QString device() const { return dev; }
+    QString displayName() const { return name; }
+    Direction direction() const { return dir; }
+
+    // read the head of the device with O_DIRECT for a short while, 0 if failed
+    quint64 probeThroughput();
+    quint64 throughput() const { return probedThroughput; }
+
+    // max_hotzone_size in 512 bytes sectors, limitSectors is 0 or the data shift
+    quint64 hotzoneSectors(quint64 limitSectors = 0) const;
+    static quint64 hotzoneSectorsFor(quint64 bytesPerSecond, quint64 limitSectors);
+
+    // milliseconds to wait before the next hotzone
+    int throttleDelay() const { return delay; }
+    int updateThrottle(double awaitMs);
+
+    quint64 bytesPerSecond() const { return rate; }
+    qint64 remainingSeconds(quint64 size, quint64 offset) const;
+
+    // crypt_reencrypt_run progress callback, usrptr is the controller
+    static int onProgress(uint64_t size, uint64_t offset, void *usrptr);
+
+private:
+    int handleProgress(quint64 size, quint64 offset);
+    void updateRate(quint64 offset);
+    bool sampleAwait(double *awaitMs);
+    QString statPath() const;
+
+    QString dev;
+    QString name;
+    Direction dir { kEncrypt };
+
+    quint64 probedThroughput { 0 };
+
+    quint64 lastOffset { 0 };
+    quint64 rate { 0 };
+    QElapsedTimer rateTimer;
+    QElapsedTimer reportTimer;
+
+    bool statValid { false };
+    quint64 lastIos { 0 };
+    quint64 lastTicks { 0 };
+    double baselineAwait { 0 };
+    int delay { 0 };
+};
+
+FILE_ENCRYPT_END_NS
+
+#endif   // REENCRYPTCONTROLLER_H
@@ -51,6 +51,10 @@ DiskEncryptSetup::DiskEncryptSetup(QObject *parent)
             this, &DiskEncryptSetup::EncryptProgress);
     connect(NotificationHelper::instance(), &NotificationHelper::notifyDecryptProgress,
             this, &DiskEncryptSetup::DecryptProgress);
+    connect(NotificationHelper::instance(), &NotificationHelper::notifyEncryptRate,
+            this, &DiskEncryptSetup::EncryptRate);
+    connect(NotificationHelper::instance(), &NotificationHelper::notifyDecryptRate,
+            this, &DiskEncryptSetup::DecryptRate);
     qInfo() << "[DiskEncryptSetup] Disk encryption service initialized successfully";
 }
 
@@ -47,6 +47,8 @@ public Q_SLOTS:
 Q_SIGNALS:
     void EncryptProgress(const QString &dev, const QString &devName, double progress);
     void DecryptProgress(const QString &dev, const QString &devName, double progress);
+    void EncryptRate(const QString &dev, const QString &devName, qint64 bytesPerSecond, qint64 remainingSeconds);
+    void DecryptRate(const QString &dev, const QString &devName, qint64 bytesPerSecond, qint64 remainingSeconds);
 
     void InitEncResult(const QVariantMap &result);
     void EncryptResult(const QVariantMap &result);
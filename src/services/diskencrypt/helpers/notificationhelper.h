@@ -21,6 +21,9 @@ public:
 Q_SIGNALS:
     void notifyEncryptProgress(const QString &dev, const QString &name, double progress);
     void notifyDecryptProgress(const QString &dev, const QString &name, double progress);
+    // remainingSeconds is -1 while unknown
+    void notifyEncryptRate(const QString &dev, const QString &name, qint64 bytesPerSecond, qint64 remainingSeconds);
+    void notifyDecryptRate(const QString &dev, const QString &name, qint64 bytesPerSecond, qint64 remainingSeconds);
     void replyAuthArgs(const QVariantMap &args);
     void ignoreAuthSetup();
 };
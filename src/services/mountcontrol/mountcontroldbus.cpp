@@ -100,6 +100,27 @@ QStringList MountControlDBus::SupportedFileSystems()
     return d->supportedFS;
 }
 
+QVariantMap MountControlDBus::MountProfile(const QString &path, const QVariantMap &opts)
+{
+    using namespace MountOptionsField;
+    using namespace MountReturnField;
+
+    auto fs = opts.value(kFsType, "").toString();
+    if (fs.isEmpty())
+        return { { kResult, false },
+                 { kErrorCode, -kNoFsTypeSpecified },
+                 { kErrorMessage, "fsType field must be specified." } };
+
+    // only the owner of the mount is answered, no authentication is needed to read it
+    auto helper = d->mountHelpers.value(fs, nullptr);
+    if (helper)
+        return helper->mountProfile(path);
+    else
+        return { { kResult, false },
+                 { kErrorCode, -kUnsupportedFsTypeOrProtocol },
+                 { kErrorMessage, "current fsType is not supported" } };
+}
+
 MountControlDBusPrivate::MountControlDBusPrivate(MountControlDBus *qq)
     : q(qq), adapter(new MountControlAdaptor(qq))
 {
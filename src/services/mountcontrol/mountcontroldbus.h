@@ -27,6 +27,7 @@ public slots:
     Q_SCRIPTABLE QVariantMap Mount(const QString &path, const QVariantMap &opts);
     Q_SCRIPTABLE QVariantMap Unmount(const QString &path, const QVariantMap &opts);
     Q_SCRIPTABLE QStringList SupportedFileSystems();
+    Q_SCRIPTABLE QVariantMap MountProfile(const QString &path, const QVariantMap &opts);
 
 private:
     QScopedPointer<SERVICEMOUNTCONTROL_NAMESPACE::MountControlDBusPrivate> d;
@@ -26,6 +26,14 @@ public:
     {
         return ServiceCommon::PolicyKitHelper::instance()->checkAuthorization(kPolicyKitActionIdDefault, appName);
     }
+    virtual QVariantMap mountProfile(const QString &path)
+    {
+        Q_UNUSED(path)
+        using namespace MountReturnField;
+        return { { kResult, false },
+                 { kErrorCode, -kUnsupportedFsTypeOrProtocol },
+                 { kErrorMessage, "mount profile is not supported by current fsType" } };
+    }
 
 
 protected:
@@ -60,10 +60,12 @@ QVariantMap CifsMountHelper::mount(const QString &path, const QVariantMap &opts)
     int ret = checkMount(aPath, mpt);
     if (ret == kAlreadyMounted) {
         fmDebug() << path << "is already mounted at" << mpt;
-        return { { kMountPoint, mpt },
-                 { kResult, true },
-                 { kErrorCode, 0 },
-                 { kErrorMessage, QString("%1 is already mounted at %2").arg(path).arg(mpt) } };
+        QVariantMap result { { kMountPoint, mpt },
+                             { kResult, true },
+                             { kErrorCode, 0 },
+                             { kErrorMessage, QString("%1 is already mounted at %2").arg(path).arg(mpt) } };
+        result.insert(d->mountProfiles.value(mpt));
+        return result;
     }
 
     auto mntPath = generateMountPath(path);
@@ -109,8 +111,49 @@ QVariantMap CifsMountHelper::mount(const QString &path, const QVariantMap &opts)
         params[MountOptionsField::kPasswd] = preparePasswd(params[MountOptionsField::kPasswd]);
     }
 
-    int errNum = 0;
-    QString errMsg;
+    // the profile asked by the caller wins over the configured one
+    const QString &profile = params.contains(MountOptionsField::kProfile)
+            ? params.value(MountOptionsField::kProfile).toString()
+            : defaultProfile();
+    const bool autoProfile = (profile == MountProfileField::kAuto);
+    if (autoProfile)
+        params.insert(MountOptionsField::kProfile, MountProfileField::kBulkTransfer);   // the probe needs the large buffers
+    else if (profile == MountProfileField::kBrowseHeavy || profile == MountProfileField::kBulkTransfer)
+        params.insert(MountOptionsField::kProfile, profile);
+    else
+        params.remove(MountOptionsField::kProfile);
+
+    if (!profile.isEmpty())
+        fmInfo() << "mount: profile" << profile << "is requested for" << path;
+
+    int errNum = mountCifs(aPath, mntPath, params);
+    if (errNum == 0) {
+        QVariantMap info;
+        if (autoProfile)
+            info = applyAutoProfile(aPath, mntPath, params);
+        else if (params.contains(MountOptionsField::kProfile))
+            info = { { MountReturnField::kProfile, params.value(MountOptionsField::kProfile) } };
+
+        if (info.value(MountReturnField::kResult, true).toBool()) {
+            QVariantMap result { { kMountPoint, mntPath }, { kResult, true }, { kErrorCode, 0 } };
+            if (!info.isEmpty()) {
+                d->mountProfiles.insert(mntPath, info);
+                result.insert(info);
+            }
+            return result;
+        }
+        errNum = info.value(MountReturnField::kErrorCode).toInt();
+    }
+
+    QString errMsg = strerror(errNum);
+    fmWarning() << "mount: failed: " << path << errNum << errMsg;
+    fmInfo() << "mount: clean dir" << mntPath;
+    rmdir(mntPath);
+    return { { kMountPoint, "" }, { kResult, false }, { kErrorCode, errNum }, { kErrorMessage, errMsg } };
+}
+
+int CifsMountHelper::mountCifs(const QString &aPath, const QString &mntPath, QVariantMap &params)
+{
     while (true) {
         auto arg = convertArgs(params);
 
@@ -122,37 +165,79 @@ QVariantMap CifsMountHelper::mount(const QString &path, const QVariantMap &opts)
         // Improve security
         // MS_NOSUID: Disables the SUID and SGID bits on this file system.
         // MS_NODEV: Disallows access to device files (character devices or block devices) on this file system.
-        ret = ::mount(aPath.toStdString().c_str(), mntPath.toStdString().c_str(), "cifs", MS_NOSUID | MS_NODEV,
-                      arg.c_str());
+        int ret = ::mount(aPath.toStdString().c_str(), mntPath.toStdString().c_str(), "cifs", MS_NOSUID | MS_NODEV,
+                          arg.c_str());
 
         if (ret == 0) {
             fmInfo() << "mount: mount cifs success, params are: " << args;
-            return { { kMountPoint, mntPath }, { kResult, true }, { kErrorCode, 0 } };
-        } else {
-            // if params contains 'timeout', first try mount with `handletimeout` param,
-            // if failed, try with `wait_reconnect_timeout` again,
-            // if failed, try without any timeout param.
-            if (params.contains(MountOptionsField::kTimeout)) {
-                if (params.contains(MountOptionsField::kTryWaitReconn)) {
-                    fmInfo() << "mount: try with handletimeout";
-                    params.remove(MountOptionsField::kTryWaitReconn);
-                } else {
-                    fmInfo() << "mount: try without timeout param";
-                    params.remove(MountOptionsField::kTimeout);
-                }
-                continue;
+            return 0;
+        }
+
+        const int errNum = errno;
+        // old kernels or servers may refuse the tuned options, e.g. multichannel
+        if ((errNum == EINVAL || errNum == EOPNOTSUPP) && params.contains(MountOptionsField::kProfile)) {
+            fmInfo() << "mount: try without profile" << params.value(MountOptionsField::kProfile);
+            params.remove(MountOptionsField::kProfile);
+            continue;
+        }
+
+        // if params contains 'timeout', first try mount with `handletimeout` param,
+        // if failed, try with `wait_reconnect_timeout` again,
+        // if failed, try without any timeout param.
+        if (params.contains(MountOptionsField::kTimeout)) {
+            if (params.contains(MountOptionsField::kTryWaitReconn)) {
+                fmInfo() << "mount: try with handletimeout";
+                params.remove(MountOptionsField::kTryWaitReconn);
             } else {
-                errNum = errno;
-                errMsg = strerror(errNum);
-                fmWarning() << "mount: failed: " << path << errNum << errMsg;
-                fmInfo() << "mount: clean dir" << mntPath;
-                rmdir(mntPath);
-                break;
+                fmInfo() << "mount: try without timeout param";
+                params.remove(MountOptionsField::kTimeout);
             }
+            continue;
         }
+
+        return errNum;
     }
+}
 
-    return { { kMountPoint, "" }, { kResult, false }, { kErrorCode, errNum }, { kErrorMessage, errMsg } };
+QVariantMap CifsMountHelper::applyAutoProfile(const QString &aPath, const QString &mntPath, QVariantMap &params)
+{
+    using namespace MountReturnField;
+
+    // the tuned options may have been dropped by the fallback, nothing to choose then
+    if (!params.contains(MountOptionsField::kProfile))
+        return {};
+
+    qint64 readBps = -1;
+    qint64 writeBps = -1;
+    if (!CifsMountHelperPrivate::probeThroughput(mntPath, &readBps, &writeBps)) {
+        fmInfo() << "mount: cannot probe" << mntPath << ", keep profile" << params.value(MountOptionsField::kProfile);
+        return { { kProfile, params.value(MountOptionsField::kProfile) } };
+    }
+
+    const QString &chosen = CifsMountHelperPrivate::chooseProfile(readBps, writeBps);
+    fmInfo() << "mount: probed" << aPath << "read" << readBps << "write" << writeBps << "B/s, choose profile" << chosen;
+    QVariantMap info { { kProfile, chosen }, { kReadThroughput, readBps }, { kWriteThroughput, writeBps } };
+    if (chosen == params.value(MountOptionsField::kProfile).toString())
+        return info;
+
+    // rsize, cache and actimeo cannot be changed by a remount
+    if (::umount(mntPath.toStdString().c_str()) != 0) {
+        fmWarning() << "mount: cannot unmount to apply profile" << chosen << strerror(errno);
+        info.insert(kProfile, params.value(MountOptionsField::kProfile));
+        return info;
+    }
+
+    const QString lastProfile = params.value(MountOptionsField::kProfile).toString();
+    params.insert(MountOptionsField::kProfile, chosen);
+    if (mountCifs(aPath, mntPath, params) == 0)
+        return info;
+
+    params.insert(MountOptionsField::kProfile, lastProfile);
+    const int errNum = mountCifs(aPath, mntPath, params);
+    if (errNum != 0)
+        return { { kResult, false }, { kErrorCode, errNum } };
+    info.insert(kProfile, lastProfile);
+    return info;
 }
 
 QVariantMap CifsMountHelper::unmount(const QString &path, const QVariantMap &opts)
@@ -181,10 +266,12 @@ QVariantMap CifsMountHelper::unmount(const QString &path, const QVariantMap &opt
     ret = ::umount(mpt.toStdString().c_str());
     int err = errno;
     QString errMsg = strerror(errno);
-    if (ret != 0)
+    if (ret != 0) {
         fmWarning() << "unmount failed: " << path << err << errMsg;
-    else
+    } else {
+        d->mountProfiles.remove(mpt);
         rmdir(mpt);
+    }
 
     return { { kResult, ret == 0 }, { kErrorCode, err }, { kErrorMessage, errMsg } };
 }
@@ -194,6 +281,31 @@ bool CifsMountHelper::checkAuthentication(const QString &appName)
     return ServiceCommon::PolicyKitHelper::instance()->checkAuthorization(kPolicyKitActionIdCIFS, appName);
 }
 
+QVariantMap CifsMountHelper::mountProfile(const QString &path)
+{
+    using namespace MountReturnField;
+
+    QUrl smbUrl(path);
+    QString aPath = QString("//%1%2").arg(smbUrl.host()).arg(smbUrl.path());
+
+    QString mpt;
+    int ret = checkMount(aPath, mpt);
+    if (ret == kNotExist)
+        return { { kResult, false },
+                 { kErrorCode, -kMountNotExist },
+                 { kErrorMessage, path + " is not mounted" } };
+    if (ret != kOkay)
+        return { { kResult, false },
+                 { kErrorCode, -kNotOwnerOfMount },
+                 { kErrorMessage, "invoker is not the owner of mount" } };
+
+    QVariantMap info = d->mountProfiles.value(mpt);
+    info.insert(kMountPoint, mpt);
+    info.insert(kResult, true);
+    info.insert(kErrorCode, 0);
+    return info;
+}
+
 CifsMountHelper::MountStatus CifsMountHelper::checkMount(const QString &path, QString &mpt)
 {
     class Helper
@@ -460,12 +572,28 @@ std::string CifsMountHelper::convertArgs(const QVariantMap &opts)
             params.append(option("handletimeout", overrides, QString::number(opts.value(kTimeout).toInt() * 1000)));   // handletimeout = ?? ms
     }
 
-    params.append(option("iocharset", overrides, "utf8"));
-    params.append(option("actimeo", overrides, "5"));   // bug 211337
-
     QString version = opts.value(MountOptionsField::kVersion, "default").toString();
+    auto profile = CifsMountHelperPrivate::profileOptions(opts.value(kProfile).toString(), version);
+    auto takeProfile = [&profile](const QString &key, const QString &def) {
+        for (int i = 0; i < profile.size(); ++i) {
+            if (profile.at(i).first == key)
+                return profile.takeAt(i).second;
+        }
+        return def;
+    };
+
+    params.append(option("iocharset", overrides, "utf8"));
+    params.append(option("actimeo", overrides, takeProfile("actimeo", "5")));   // bug 211337
     params.append(option("vers", overrides, version));
 
+    for (const auto &opt : profile) {
+        // flags such as multichannel have no value
+        if (opt.second.isEmpty() && !overrides.contains(opt.first))
+            params.append(opt.first);
+        else
+            params.append(option(opt.first, overrides, opt.second));
+    }
+
     return params.join(",").toStdString();
 }
 
@@ -481,6 +609,17 @@ QVariantMap CifsMountHelper::overrideOptions()
     return overrides;
 }
 
+QString CifsMountHelper::defaultProfile()
+{
+    auto config = Dtk::Core::DConfig::create("org.deepin.dde.file-manager",
+                                             "org.deepin.dde.file-manager.mount");
+    if (!config)
+        return {};
+    auto profile = config->value("cifsMountProfile", "").toString();
+    config->deleteLater();
+    return profile;
+}
+
 QString CifsMountHelper::option(const QString &key, const QVariantMap &override, const QString &def)
 {
     QString val = def;
@@ -645,6 +784,105 @@ QString CifsMountHelperPrivate::probeVersion(const QString &host, ushort port)
     return SmbcAPI::versionMapper().value(verName, "default");
 }
 
+QList<QPair<QString, QString>> CifsMountHelperPrivate::profileOptions(const QString &profile, const QString &version)
+{
+    using namespace MountProfileField;
+
+    // directory listings are served from the attribute cache for longer
+    if (profile == kBrowseHeavy)
+        return { { "cache", "strict" }, { "actimeo", "30" } };
+
+    if (profile == kBulkTransfer) {
+        QList<QPair<QString, QString>> opts { { "cache", "strict" },
+                                              { "rsize", "4194304" },
+                                              { "wsize", "4194304" } };
+        // multichannel requires SMB 3
+        if (version.startsWith("3"))
+            opts << qMakePair(QString("multichannel"), QString()) << qMakePair(QString("max_channels"), QString("4"));
+        return opts;
+    }
+
+    return {};
+}
+
+bool CifsMountHelperPrivate::probeThroughput(const QString &mntPath, qint64 *readBps, qint64 *writeBps)
+{
+    static constexpr qint64 kFirstChunkSize { 64 * 1024 };
+    static constexpr qint64 kMaxChunkSize { 1 << 20 };
+    static constexpr qint64 kMaxProbeSize { 8 << 20 };
+    static constexpr qint64 kPhaseTimeoutMs { 2000 };
+
+    const QByteArray &probeFile = QString("%1/.dfm-cifs-probe-%2").arg(mntPath).arg(getpid()).toLocal8Bit();
+    int fd = ::open(probeFile.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        fmInfo() << "probe: share is not writable:" << mntPath << strerror(errno);
+        return false;
+    }
+
+    QByteArray chunk(kMaxChunkSize, 'd');
+    QElapsedTimer timer;
+    timer.start();
+    qint64 written = 0;
+    qint64 chunkSize = kFirstChunkSize;
+    bool ok = true;
+    // every chunk is flushed before the next one, a write only fills the page cache
+    // and an unbounded fsync at the end would hold the mount call on a slow link.
+    // Chunks grow only while the measured rate says the next one fits in the time left
+    while (written < kMaxProbeSize) {
+        ssize_t ret = ::write(fd, chunk.constData(), static_cast<size_t>(chunkSize));
+        if (ret <= 0 || ::fdatasync(fd) != 0) {
+            ok = false;
+            break;
+        }
+        written += ret;
+
+        const qint64 elapsed = qMax<qint64>(timer.elapsed(), 1);
+        const qint64 remainingMs = kPhaseTimeoutMs - elapsed;
+        const qint64 bytesPerMs = written / elapsed;
+        chunkSize = qMin(chunkSize * 2, kMaxChunkSize);
+        if (remainingMs <= 0 || chunkSize > bytesPerMs * remainingMs)
+            break;
+    }
+    ok = ok && written > 0;
+    const qint64 writeMs = qMax<qint64>(timer.elapsed(), 1);
+    // the content must come from the server when read back
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+
+    qint64 readBytes = 0;
+    qint64 readMs = 1;
+    if (ok) {
+        fd = ::open(probeFile.constData(), O_RDONLY | O_CLOEXEC);
+        ok = fd >= 0;
+        if (ok) {
+            timer.restart();
+            ssize_t ret = 0;
+            while (timer.elapsed() < kPhaseTimeoutMs
+                   && (ret = ::read(fd, chunk.data(), static_cast<size_t>(chunkSize))) > 0)
+                readBytes += ret;
+            readMs = qMax<qint64>(timer.elapsed(), 1);
+            ::close(fd);
+            ok = readBytes > 0;
+        }
+    }
+    ::unlink(probeFile.constData());
+
+    if (!ok)
+        return false;
+    *writeBps = written * 1000 / writeMs;
+    *readBps = readBytes * 1000 / readMs;
+    return true;
+}
+
+QString CifsMountHelperPrivate::chooseProfile(qint64 readBps, qint64 writeBps)
+{
+    // below that the link is the bottleneck, large buffers do not help but
+    // every metadata round trip saved by the attribute cache does
+    static constexpr qint64 kBulkThreshold { 16 * 1024 * 1024 };
+    return qMax(readBps, writeBps) >= kBulkThreshold ? MountProfileField::kBulkTransfer
+                                                     : MountProfileField::kBrowseHeavy;
+}
+
 QString CifsMountHelperPrivate::parseIP(const QString &host, uint16_t port)
 {
     if (!smbcAPI.isInitialized() || !smbcAPI.getSmbcResolveHost())
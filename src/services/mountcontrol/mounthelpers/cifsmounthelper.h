@@ -26,17 +26,21 @@ public:
     virtual QVariantMap mount(const QString &path, const QVariantMap &opts) override;
     virtual QVariantMap unmount(const QString &path, const QVariantMap &opts) override;
     virtual bool checkAuthentication(const QString &appName) override;
+    virtual QVariantMap mountProfile(const QString &path) override;
 
     void cleanMountPoint();
 
 private:
     MountStatus checkMount(const QString &path, QString &mpt);
+    int mountCifs(const QString &aPath, const QString &mntPath, QVariantMap &params);
+    QVariantMap applyAutoProfile(const QString &aPath, const QString &mntPath, QVariantMap &params);
     QString generateMountPath(const QString &address);
     QString mountRoot();
     QString preparePasswd(const QVariant &passwdVar);
     uint invokerUid();
     std::string convertArgs(const QVariantMap &opts);
     QVariantMap overrideOptions();
+    QString defaultProfile();
     QString option(const QString &key, const QVariantMap &override, const QString &def = QString());
     bool mkdir(const QString &path);
     bool rmdir(const QString &path);
@@ -8,6 +8,9 @@
 #include "service_mountcontrol_global.h"
 
 #include <QLibrary>
+#include <QHash>
+#include <QPair>
+#include <QVariantMap>
 
 SERVICEMOUNTCONTROL_BEGIN_NAMESPACE
 
@@ -56,10 +59,17 @@ class CifsMountHelperPrivate
     friend class CifsMountHelper;
     SmbcAPI smbcAPI;
 
+    // the profile and measured throughput of the mounts, by mount point
+    QHash<QString, QVariantMap> mountProfiles;
+
 public:
     QString probeVersion(const QString &host, ushort port);
     QString parseIP(const QString &host, uint16_t port);
     QString parseIP_old(const QString &host);
+
+    static QList<QPair<QString, QString>> profileOptions(const QString &profile, const QString &version);
+    static bool probeThroughput(const QString &mntPath, qint64 *readBps, qint64 *writeBps);
+    static QString chooseProfile(qint64 readBps, qint64 writeBps);
 };
 
 SERVICEMOUNTCONTROL_END_NAMESPACE
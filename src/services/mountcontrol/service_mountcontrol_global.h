@@ -27,6 +27,7 @@ inline constexpr char kMountName[] { "mntName" };
 inline constexpr char kTimeout[] { "timeout" };
 inline constexpr char kTryWaitReconn[] { "waitReconn" };
 inline constexpr char kUnmountAllStacked[] { "unmountAllStacked" };
+inline constexpr char kProfile[] { "profile" };
 }
 
 namespace MountReturnField {
@@ -34,6 +35,15 @@ inline constexpr char kResult[] { "result" };
 inline constexpr char kMountPoint[] { "mountPoint" };
 inline constexpr char kErrorCode[] { "errno" };
 inline constexpr char kErrorMessage[] { "errMsg" };
+inline constexpr char kProfile[] { "profile" };
+inline constexpr char kReadThroughput[] { "readThroughput" };   // bytes per second, measured by the auto profile
+inline constexpr char kWriteThroughput[] { "writeThroughput" };
+}
+
+namespace MountProfileField {
+inline constexpr char kBrowseHeavy[] { "browse-heavy" };
+inline constexpr char kBulkTransfer[] { "bulk-transfer" };
+inline constexpr char kAuto[] { "auto" };
 }
 
 namespace MountFstypeSupportedField {
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmarkrunner.h"
+
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QDateTime>
+#include <QSysInfo>
+#include <QFile>
+#include <QHash>
+#include <QDebug>
+
+#include <algorithm>
+#include <numeric>
+#include <cstdio>
+
+namespace {
+constexpr int kFormatVersion = 1;
+}
+
+QJsonObject BenchmarkRunner::Result::toJson() const
+{
+    QJsonObject obj;
+    obj["name"] = name;
+    obj["items"] = items;
+    obj["iterations"] = iterations;
+    obj["minMs"] = minMs;
+    obj["medianMs"] = medianMs;
+    obj["meanMs"] = meanMs;
+    obj["itemsPerSec"] = itemsPerSec;
+    return obj;
+}
+
+BenchmarkRunner::Result BenchmarkRunner::Result::fromJson(const QJsonObject &obj)
+{
+    Result result;
+    result.name = obj["name"].toString();
+    result.items = obj["items"].toVariant().toLongLong();
+    result.iterations = obj["iterations"].toInt();
+    result.minMs = obj["minMs"].toDouble();
+    result.medianMs = obj["medianMs"].toDouble();
+    result.meanMs = obj["meanMs"].toDouble();
+    result.itemsPerSec = obj["itemsPerSec"].toDouble();
+    return result;
+}
+
+BenchmarkRunner::BenchmarkRunner(int iterations)
+    : iterations(qMax(1, iterations))
+{
+}
+
+void BenchmarkRunner::setFilter(const QStringList &patterns)
+{
+    filters = patterns;
+}
+
+void BenchmarkRunner::setScale(const QString &scale)
+{
+    this->scale = scale;
+}
+
+void BenchmarkRunner::addCase(const Case &benchCase)
+{
+    cases.append(benchCase);
+}
+
+bool BenchmarkRunner::accepted(const QString &name) const
+{
+    if (filters.isEmpty())
+        return true;
+    return std::any_of(filters.cbegin(), filters.cend(), [&name](const QString &pattern) {
+        return name.contains(pattern, Qt::CaseInsensitive);
+    });
+}
+
+void BenchmarkRunner::run()
+{
+    resultList.clear();
+    for (const Case &benchCase : cases) {
+        if (!accepted(benchCase.name))
+            continue;
+
+        const Result &result = measure(benchCase);
+        std::printf("%-44s %10lld items  median %10.2f ms  min %10.2f ms  %12.0f items/s\n",
+                    qPrintable(result.name), static_cast<long long>(result.items),
+                    result.medianMs, result.minMs, result.itemsPerSec);
+        std::fflush(stdout);
+        resultList.append(result);
+    }
+}
+
+BenchmarkRunner::Result BenchmarkRunner::measure(const Case &benchCase) const
+{
+    Result result;
+    result.name = benchCase.name;
+    result.iterations = iterations;
+
+    QList<double> samples;
+    samples.reserve(iterations);
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+        if (benchCase.setup)
+            benchCase.setup();
+        timer.start();
+        result.items = benchCase.run();
+        samples.append(timer.nsecsElapsed() / 1e6);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const int mid = samples.size() / 2;
+    result.minMs = samples.first();
+    result.medianMs = samples.size() % 2 ? samples.at(mid) : (samples.at(mid - 1) + samples.at(mid)) / 2;
+    result.meanMs = std::accumulate(samples.cbegin(), samples.cend(), 0.0) / samples.size();
+    result.itemsPerSec = result.medianMs > 0 ? result.items * 1000.0 / result.medianMs : 0;
+    return result;
+}
+
+bool BenchmarkRunner::writeJson(const QString &filePath) const
+{
+    QJsonArray array;
+    for (const Result &result : resultList)
+        array.append(result.toJson());
+
+    QJsonObject root;
+    root["version"] = kFormatVersion;
+    root["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    root["host"] = QSysInfo::machineHostName();
+    root["cpu"] = QSysInfo::currentCpuArchitecture();
+    root["kernel"] = QSysInfo::kernelVersion();
+    root["scale"] = scale;
+    root["results"] = array;
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "can't write the result to" << filePath << file.errorString();
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return true;
+}
+
+int BenchmarkRunner::compare(const QString &baselinePath, double threshold) const
+{
+    QFile file(baselinePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "can't read the baseline" << baselinePath << file.errorString();
+        return -1;
+    }
+
+    const QJsonObject &root = QJsonDocument::fromJson(file.readAll()).object();
+    if (root["version"].toInt() != kFormatVersion) {
+        qWarning() << "unsupported baseline version" << root["version"].toInt();
+        return -1;
+    }
+    if (root["scale"].toString() != scale)
+        qWarning() << "the baseline was measured at scale" << root["scale"].toString() << "not" << scale;
+
+    QHash<QString, Result> baseline;
+    for (const QJsonValue &value : root["results"].toArray()) {
+        const Result &result = Result::fromJson(value.toObject());
+        baseline.insert(result.name, result);
+    }
+
+    int regressions = 0;
+    std::printf("\n%-44s %12s %12s %9s\n", "case", "base ms", "current ms", "change");
+    for (const Result &result : resultList) {
+        auto it = baseline.constFind(result.name);
+        if (it == baseline.cend() || it->medianMs <= 0) {
+            std::printf("%-44s %12s %12.2f %9s\n", qPrintable(result.name), "-", result.medianMs, "new");
+            continue;
+        }
+
+        // items differ when the tree was regenerated with another size, the rate is still comparable
+        const bool sameItems = it->items == result.items;
+        const double change = sameItems ? result.medianMs / it->medianMs - 1
+                                        : (it->itemsPerSec > 0 ? it->itemsPerSec / qMax(result.itemsPerSec, 1.0) - 1 : 0);
+        const bool regressed = change > threshold;
+        regressions += regressed ? 1 : 0;
+        std::printf("%-44s %12.2f %12.2f %+8.1f%%%s\n", qPrintable(result.name), it->medianMs, result.medianMs,
+                    change * 100, regressed ? "  REGRESSION" : "");
+    }
+    std::fflush(stdout);
+    return regressions;
+}
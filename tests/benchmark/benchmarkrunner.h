@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QString>
+#include <QList>
+#include <QJsonObject>
+
+#include <functional>
+
+/*!
+ * \brief Runs the benchmark cases and reports the timings
+ *
+ * The results are written as json, a previous result can be passed in as
+ * the baseline, a case whose median is slower than the baseline by more
+ * than the threshold is reported as a regression.
+ */
+class BenchmarkRunner
+{
+public:
+    struct Case
+    {
+        QString name;
+        std::function<void()> setup;   // not timed, runs before every iteration
+        std::function<qint64()> run;   // returns the number of processed items
+    };
+
+    struct Result
+    {
+        QString name;
+        qint64 items { 0 };
+        int iterations { 0 };
+        double minMs { 0 };
+        double medianMs { 0 };
+        double meanMs { 0 };
+        double itemsPerSec { 0 };
+
+        QJsonObject toJson() const;
+        static Result fromJson(const QJsonObject &obj);
+    };
+
+    explicit BenchmarkRunner(int iterations);
+
+    void setFilter(const QStringList &patterns);
+    void setScale(const QString &scale);
+    void addCase(const Case &benchCase);
+    void run();
+
+    QList<Result> results() const { return resultList; }
+    bool writeJson(const QString &filePath) const;
+    // returns the number of regressions, -1 if the baseline can't be read
+    int compare(const QString &baselinePath, double threshold) const;
+
+private:
+    bool accepted(const QString &name) const;
+    Result measure(const Case &benchCase) const;
+
+    int iterations { 1 };
+    QString scale;
+    QStringList filters;
+    QList<Case> cases;
+    QList<Result> resultList;
+};
+
+#endif   // BENCHMARKRUNNER_H
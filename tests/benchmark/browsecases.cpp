@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "browsecases.h"
+
+#include "models/fileitemdata.h"
+#include "utils/fileviewsorter.h"
+#include "utils/filesortworker.h"
+#include "groups/groupingengine.h"
+#include "groups/typegroupstrategy.h"
+
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/file/local/localdiriterator.h>
+#include <dfm-base/utils/traversaldirthread.h>
+#include <dfm-base/utils/filescanner.h>
+#include <dfm-base/dfm_global_defines.h>
+
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QHash>
+
+#include <memory>
+
+DFMBASE_USE_NAMESPACE
+DPWORKSPACE_USE_NAMESPACE
+
+namespace {
+constexpr char kWorkerKey[] = "benchmark";
+constexpr QDir::Filters kListFilters = QDir::AllEntries | QDir::NoDotAndDotDot | QDir::System | QDir::Hidden;
+constexpr QDir::Filters kNoHiddenFilters = QDir::AllEntries | QDir::NoDotAndDotDot | QDir::System;
+constexpr int kBurstDivisor = 10;   // watcher bursts touch a tenth of the directory
+
+SortInfoPointer makeSortInfo(const QFileInfo &info)
+{
+    SortInfoPointer sortInfo(new SortFileInfo);
+    sortInfo->setUrl(QUrl::fromLocalFile(info.absoluteFilePath()));
+    sortInfo->setSize(info.size());
+    sortInfo->setFile(info.isFile());
+    sortInfo->setDir(info.isDir());
+    sortInfo->setSymlink(info.isSymLink());
+    sortInfo->setHide(info.isHidden());
+    sortInfo->setReadable(info.isReadable());
+    sortInfo->setWriteable(info.isWritable());
+    sortInfo->setExecutable(info.isExecutable());
+    sortInfo->setLastModifiedTime(info.lastModified().toSecsSinceEpoch());
+    sortInfo->setLastReadTime(info.lastRead().toSecsSinceEpoch());
+    sortInfo->setInfoCompleted(true);
+    return sortInfo;
+}
+
+QSharedPointer<FileSortWorker> createWorker(const QUrl &rootUrl, const QList<SortInfoPointer> &children)
+{
+    QSharedPointer<FileSortWorker> worker(new FileSortWorker(rootUrl, kWorkerKey, nullptr, {}, kListFilters));
+    worker->setSortArguments(Qt::AscendingOrder, Global::ItemRoles::kItemFileDisplayNameRole, false);
+    worker->setRootData(FileItemDataPointer(new FileItemData(rootUrl, InfoFactory::create<FileInfo>(rootUrl))));
+    worker->handleIteratorLocalChildren(kWorkerKey, children,
+                                        DFMIO::DEnumerator::SortRoleCompareFlag::kSortRoleCompareFileName,
+                                        Qt::AscendingOrder, false, true);
+    worker->handleTraversalFinish(kWorkerKey);
+    return worker;
+}
+}   // namespace
+
+BrowseCases::BrowseCases(const TreeGenerator::Tree &tree)
+    : tree(tree),
+      rootUrl(QUrl::fromLocalFile(tree.path))
+{
+}
+
+QString BrowseCases::caseName(const QString &name) const
+{
+    return QString("%1/%2").arg(tree.name, name);
+}
+
+void BrowseCases::collectInputs()
+{
+    if (!urls.isEmpty())
+        return;
+
+    QDirIterator it(tree.path, kListFilters);
+    while (it.hasNext()) {
+        it.next();
+        const QFileInfo &info = it.fileInfo();
+        urls.append(QUrl::fromLocalFile(info.absoluteFilePath()));
+        sortInfos.append(makeSortInfo(info));
+    }
+}
+
+void BrowseCases::registerCases(BenchmarkRunner *runner)
+{
+    collectInputs();
+
+    addEnumerationCases(runner);
+    addSorterCases(runner);
+    addSortWorkerCases(runner);
+    addGroupingCases(runner);
+    addInfoCacheCases(runner);
+    addScannerCases(runner);
+}
+
+void BrowseCases::addEnumerationCases(BenchmarkRunner *runner)
+{
+    const QUrl url = rootUrl;
+    runner->addCase({ caseName("enumerate/LocalDirIterator"), nullptr, [url] {
+                         LocalDirIterator it(url, {}, kListFilters);
+                         qint64 count = 0;
+                         while (it.hasNext()) {
+                             if (it.next().isValid())
+                                 ++count;
+                         }
+                         return count;
+                     } });
+
+    runner->addCase({ caseName("enumerate/TraversalDirThread"), nullptr, [url] {
+                         TraversalDirThread thread(url, {}, kListFilters);
+                         thread.setEnableSort(true);
+                         qint64 count = 0;
+                         QObject::connect(&thread, &TraversalDirThread::updateChildren, &thread,
+                                          [&count](QList<QUrl> children) { count += children.size(); },
+                                          Qt::DirectConnection);
+                         thread.start();
+                         thread.wait();
+                         return count;
+                     } });
+}
+
+void BrowseCases::addSorterCases(BenchmarkRunner *runner)
+{
+    auto items = std::make_shared<QHash<QUrl, FileItemDataPointer>>();
+    for (const SortInfoPointer &sortInfo : std::as_const(sortInfos))
+        items->insert(sortInfo->fileUrl(), FileItemDataPointer(new FileItemData(sortInfo)));
+
+    auto sorter = std::make_shared<FileViewSorter>();
+    FileViewSorter::SortContext context;
+    context.rootUrl = rootUrl;
+    context.getDataCallback = [items](const QUrl &url) { return items->value(url); };
+    sorter->setContext(context);
+
+    const QList<QUrl> all = urls;
+    runner->addCase({ caseName("sorter/sort"), nullptr, [sorter, all] {
+                         return static_cast<qint64>(sorter->sort(all).size());
+                     } });
+
+    // the watcher inserts every tenth file into the sorted rest
+    QList<QUrl> inserted;
+    QList<QUrl> rest;
+    for (int i = 0; i < urls.size(); ++i)
+        (i % kBurstDivisor == 0 ? inserted : rest).append(urls.at(i));
+    const QList<QUrl> sortedRest = sorter->sort(rest);
+    runner->addCase({ caseName("sorter/findInsertPosition"), nullptr, [sorter, inserted, sortedRest] {
+                         qint64 checksum = 0;
+                         for (const QUrl &url : inserted)
+                             checksum += sorter->findInsertPosition(url, sortedRest);
+                         Q_UNUSED(checksum)
+                         return static_cast<qint64>(inserted.size());
+                     } });
+}
+
+void BrowseCases::addSortWorkerCases(BenchmarkRunner *runner)
+{
+    const QUrl url = rootUrl;
+    QList<SortInfoPointer> initial;
+    QList<SortInfoPointer> burst;
+    for (int i = 0; i < sortInfos.size(); ++i)
+        (i % kBurstDivisor == 0 ? burst : initial).append(sortInfos.at(i));
+
+    auto worker = std::make_shared<QSharedPointer<FileSortWorker>>();
+    const QList<SortInfoPointer> all = sortInfos;
+
+    runner->addCase({ caseName("sortworker/load"), nullptr, [url, all] {
+                         auto loaded = createWorker(url, all);
+                         return static_cast<qint64>(loaded->childrenCount());
+                     } });
+
+    runner->addCase({ caseName("sortworker/filter"), [worker, url, all] { *worker = createWorker(url, all); },
+                      [worker, all] {
+                          (*worker)->handleFilters(kNoHiddenFilters);
+                          (*worker)->handleFilters(kListFilters);
+                          return static_cast<qint64>(all.size() * 2);
+                      } });
+
+    runner->addCase({ caseName("sortworker/insertBurst"), [worker, url, initial] { *worker = createWorker(url, initial); },
+                      [worker, burst] {
+                          (*worker)->handleWatcherAddChildren(burst);
+                          return static_cast<qint64>(burst.size());
+                      } });
+
+    runner->addCase({ caseName("sortworker/removeBurst"), [worker, url, all] { *worker = createWorker(url, all); },
+                      [worker, burst] {
+                          (*worker)->handleWatcherRemoveChildren(burst);
+                          return static_cast<qint64>(burst.size());
+                      } });
+}
+
+void BrowseCases::addGroupingCases(BenchmarkRunner *runner)
+{
+    const QUrl url = rootUrl;
+    const QList<QUrl> all = urls;
+    auto files = std::make_shared<QList<FileItemDataPointer>>();
+
+    runner->addCase({ caseName("grouping/type"),
+                      [files, all] {
+                          if (!files->isEmpty())
+                              return;
+                          for (const QUrl &child : all)
+                              files->append(FileItemDataPointer(new FileItemData(child, InfoFactory::create<FileInfo>(child))));
+                      },
+                      [files, url] {
+                          GroupingEngine engine(url);
+                          TypeGroupStrategy strategy;
+                          const auto &result = engine.groupFiles(*files, &strategy);
+                          engine.generateModelData(result, {});
+                          return static_cast<qint64>(files->size());
+                      } });
+}
+
+void BrowseCases::addInfoCacheCases(BenchmarkRunner *runner)
+{
+    const QList<QUrl> all = urls;
+    // the first pass fills the cache, the timed pass only hits it
+    runner->addCase({ caseName("infocache/hit"),
+                      [all] {
+                          for (const QUrl &url : all)
+                              InfoFactory::create<FileInfo>(url);
+                      },
+                      [all] {
+                          qint64 hits = 0;
+                          for (const QUrl &url : all)
+                              hits += InfoFactory::create<FileInfo>(url) ? 1 : 0;
+                          return hits;
+                      } });
+}
+
+void BrowseCases::addScannerCases(BenchmarkRunner *runner)
+{
+    const QUrl url = rootUrl;
+    runner->addCase({ caseName("filescanner/size"), nullptr, [url] {
+                         const auto &result = FileScanner::scanSync({ url });
+                         return static_cast<qint64>(result.fileCount + result.directoryCount);
+                     } });
+
+    runner->addCase({ caseName("filescanner/countOnly"), nullptr, [url] {
+                         const auto &result = FileScanner::scanSync({ url }, FileScanner::ScanOption::CountOnly);
+                         return static_cast<qint64>(result.fileCount + result.directoryCount);
+                     } });
+}
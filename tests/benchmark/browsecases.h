@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef BROWSECASES_H
+#define BROWSECASES_H
+
+#include "benchmarkrunner.h"
+#include "treegenerator.h"
+
+#include <dfm-base/interfaces/sortfileinfo.h>
+
+#include <QUrl>
+#include <QList>
+
+/*!
+ * \brief The cases of the browse pipeline for one generated tree
+ *
+ * Enumeration, sorting, the sort worker bursts, grouping, the info cache
+ * and the statistics scan are registered for the tree, the inputs are
+ * collected once and are not part of the timings.
+ */
+class BrowseCases
+{
+public:
+    explicit BrowseCases(const TreeGenerator::Tree &tree);
+
+    void registerCases(BenchmarkRunner *runner);
+
+private:
+    QString caseName(const QString &name) const;
+    void collectInputs();
+
+    void addEnumerationCases(BenchmarkRunner *runner);
+    void addSorterCases(BenchmarkRunner *runner);
+    void addSortWorkerCases(BenchmarkRunner *runner);
+    void addGroupingCases(BenchmarkRunner *runner);
+    void addInfoCacheCases(BenchmarkRunner *runner);
+    void addScannerCases(BenchmarkRunner *runner);
+
+    TreeGenerator::Tree tree;
+    QUrl rootUrl;
+    QList<QUrl> urls;   // the children of the top directory
+    QList<SortInfoPointer> sortInfos;
+};
+
+#endif   // BROWSECASES_H
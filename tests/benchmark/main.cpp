@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "benchmarkrunner.h"
+#include "browsecases.h"
+#include "memorycases.h"
+#include "treegenerator.h"
+
+#include <dfm-base/base/urlroute.h>
+#include <dfm-base/base/schemefactory.h>
+#include <dfm-base/file/local/syncfileinfo.h>
+#include <dfm-base/file/local/asyncfileinfo.h>
+#include <dfm-base/file/local/localdiriterator.h>
+#include <dfm-base/dfm_global_defines.h>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QStandardPaths>
+#include <QDir>
+
+#include <cstdio>
+
+DFMBASE_USE_NAMESPACE
+
+namespace {
+struct Scale
+{
+    int flat;
+    int deep;
+    int cjk;
+    int mixed;
+};
+
+// full is the size the pipeline is expected to handle, quick is for a smoke run
+const Scale kFullScale { 1000000, 100000, 100000, 100000 };
+const Scale kQuickScale { 10000, 10000, 5000, 5000 };
+
+void registerLocalScheme()
+{
+    UrlRoute::regScheme(Global::Scheme::kFile, "/");
+    UrlRoute::regScheme(Global::Scheme::kAsyncFile, "/");
+    InfoFactory::regClass<SyncFileInfo>(Global::Scheme::kFile);
+    InfoFactory::regClass<AsyncFileInfo>(Global::Scheme::kAsyncFile);
+    DirIteratorFactory::regClass<LocalDirIterator>(Global::Scheme::kFile);
+}
+}   // namespace
+
+int main(int argc, char *argv[])
+{
+    // the sort worker and file infos need a gui application, but nothing is shown
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    app.setApplicationName("dfm-browse-benchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless benchmark of the browse pipeline");
+    parser.addHelpOption();
+    QCommandLineOption rootOpt("root", "Directory of the generated trees, they are reused between runs.", "dir",
+                               QDir(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)).filePath("dfm-benchmark"));
+    QCommandLineOption quickOpt("quick", "Use small trees for a smoke run.");
+    QCommandLineOption iterOpt("iterations", "Iterations of every case.", "count", "5");
+    QCommandLineOption casesOpt("cases", "Only run the cases whose name contains one of the comma separated patterns.", "patterns");
+    QCommandLineOption outputOpt("output", "Write the results as json.", "file");
+    QCommandLineOption baselineOpt("baseline", "Compare the results with a previous json output.", "file");
+    QCommandLineOption thresholdOpt("threshold", "Slowdown of the median reported as a regression, in percent.", "percent", "10");
+    parser.addOptions({ rootOpt, quickOpt, iterOpt, casesOpt, outputOpt, baselineOpt, thresholdOpt });
+    parser.process(app);
+
+    registerLocalScheme();
+
+    const bool quick = parser.isSet(quickOpt);
+    const Scale &scale = quick ? kQuickScale : kFullScale;
+    TreeGenerator generator(parser.value(rootOpt));
+    const QList<TreeGenerator::Tree> trees {
+        generator.generate(TreeGenerator::Shape::kFlat, scale.flat),
+        generator.generate(TreeGenerator::Shape::kDeep, scale.deep),
+        generator.generate(TreeGenerator::Shape::kCjk, scale.cjk),
+        generator.generate(TreeGenerator::Shape::kMixed, scale.mixed)
+    };
+
+    const QStringList &filters = parser.value(casesOpt).split(',', Qt::SkipEmptyParts);
+    BenchmarkRunner runner(parser.value(iterOpt).toInt());
+    runner.setScale(quick ? "quick" : "full");
+    runner.setFilter(filters);
+
+    QList<BrowseCases *> caseSets;
+    for (const TreeGenerator::Tree &tree : trees) {
+        auto cases = new BrowseCases(tree);
+        cases->registerCases(&runner);
+        caseSets.append(cases);
+    }
+    runner.run();
+    qDeleteAll(caseSets);
+
+    // not timed, they don't take part in the json output and the baseline
+    MemoryCases::run(filters);
+
+    if (parser.isSet(outputOpt) && !runner.writeJson(parser.value(outputOpt)))
+        return 1;
+
+    if (parser.isSet(baselineOpt)) {
+        const int regressions = runner.compare(parser.value(baselineOpt), parser.value(thresholdOpt).toDouble() / 100);
+        if (regressions < 0)
+            return 1;
+        if (regressions > 0) {
+            std::printf("%d case(s) regressed\n", regressions);
+            return 2;
+        }
+    }
+
+    return 0;
+}
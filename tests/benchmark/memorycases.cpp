@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "memorycases.h"
+
+#include <dfm-base/file/local/private/fileattributestore.h>
+
+#include <QMap>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#    include <malloc.h>
+#    define HAS_MALLINFO2
+#endif
+
+DFMBASE_USE_NAMESPACE
+
+using ID = FileInfo::FileInfoAttributeID;
+
+namespace {
+// a million infos is the size the pipeline is expected to handle
+constexpr qint64 kEntries { 1000000 };
+
+// the attributes every cached info has after cacheAllAttributes, without the names and paths
+template<typename Store>
+void fillStatAttributes(Store &store, qint64 index)
+{
+    store.insert(ID::kStandardSize, QVariant::fromValue<quint64>(4096 + index));
+    store.insert(ID::kTimeModified, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeModifiedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeAccess, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeAccessUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeChanged, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeChangedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kTimeCreated, QVariant::fromValue<quint64>(1700000000 + index));
+    store.insert(ID::kTimeCreatedUsec, QVariant::fromValue<quint32>(index % 1000000));
+    store.insert(ID::kUnixInode, QVariant::fromValue<quint64>(100000 + index));
+    store.insert(ID::kUnixUID, QVariant::fromValue<quint32>(1000));
+    store.insert(ID::kUnixGID, QVariant::fromValue<quint32>(1000));
+    store.insert(ID::kStandardIsFile, true);
+    store.insert(ID::kStandardIsDir, false);
+    store.insert(ID::kStandardIsSymlink, false);
+    store.insert(ID::kStandardIsHidden, false);
+    store.insert(ID::kStandardFileExists, true);
+    store.insert(ID::kAccessCanRead, true);
+    store.insert(ID::kAccessCanWrite, true);
+    store.insert(ID::kAccessCanExecute, false);
+    store.insert(ID::kAccessCanDelete, true);
+    store.insert(ID::kAccessCanTrash, true);
+    store.insert(ID::kAccessCanRename, true);
+    store.insert(ID::kStandardFileType, QVariant::fromValue(FileInfo::FileType::kDocuments));
+    store.insert(ID::kStandardContentType, QString("text/plain"));
+    store.insert(ID::kStandardFastContentType, QString("text/plain"));
+    store.insert(ID::kStandardIcon, QStringList { "text-plain", "text-x-generic" });
+    store.insert(ID::kOwnerUser, QString("uos"));
+    store.insert(ID::kOwnerGroup, QString("uos"));
+}
+
+#ifdef HAS_MALLINFO2
+size_t heapInUse()
+{
+    return mallinfo2().uordblks;
+}
+#endif
+
+bool accepted(const QStringList &filters, const QString &name)
+{
+    if (filters.isEmpty())
+        return true;
+    return std::any_of(filters.cbegin(), filters.cend(), [&name](const QString &pattern) {
+        return name.contains(pattern, Qt::CaseInsensitive);
+    });
+}
+}   // namespace
+
+void MemoryCases::run(const QStringList &filters)
+{
+    if (accepted(filters, "memory/FileAttributeStore"))
+        attributeStore(kEntries);
+}
+
+void MemoryCases::attributeStore(qint64 entries)
+{
+#ifdef HAS_MALLINFO2
+    // the map is sampled, a million of them would need gigabytes
+    const qint64 mapEntries = std::min<qint64>(entries, 20000);
+
+    size_t before = heapInUse();
+    std::unique_ptr<FileAttributeStore[]> stores(new FileAttributeStore[entries]);
+    for (qint64 i = 0; i < entries; ++i)
+        fillStatAttributes(stores[i], i);
+    const double storeBytes = double(heapInUse() - before) / entries;
+
+    before = heapInUse();
+    std::unique_ptr<QMap<ID, QVariant>[]> maps(new QMap<ID, QVariant>[mapEntries]);
+    for (qint64 i = 0; i < mapEntries; ++i)
+        fillStatAttributes(maps[i], i);
+    const double mapBytes = double(heapInUse() - before) / mapEntries;
+
+    // e.g. under a sanitizer the glibc heap is not used
+    if (mapBytes <= 0) {
+        std::printf("%-44s skipped, the heap usage is not reported\n", "memory/FileAttributeStore");
+        return;
+    }
+    std::printf("%-44s %10lld items  %8.0f bytes/entry  QMap %8.0f bytes/entry\n",
+                "memory/FileAttributeStore", static_cast<long long>(entries), storeBytes, mapBytes);
+#else
+    Q_UNUSED(entries)
+    std::printf("%-44s skipped, mallinfo2 is not available\n", "memory/FileAttributeStore");
+#endif
+}
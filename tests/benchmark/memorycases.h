@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef MEMORYCASES_H
+#define MEMORYCASES_H
+
+#include <QStringList>
+
+/*!
+ * \brief The memory cases, they report bytes per entry instead of timings
+ *
+ * The heap in use is read from mallinfo2 before and after the entries are
+ * filled, the cases are skipped where it is not available.
+ */
+class MemoryCases
+{
+public:
+    // runs the cases whose name contains one of the patterns, all if empty
+    static void run(const QStringList &filters);
+
+private:
+    static void attributeStore(qint64 entries);
+};
+
+#endif   // MEMORYCASES_H
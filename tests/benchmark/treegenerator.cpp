@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "treegenerator.h"
+
+#include <QDir>
+#include <QFile>
+#include <QDebug>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kStampFile[] = ".dfm-benchmark-stamp";
+constexpr int kDeepChains = 100;
+constexpr int kDeepDepth = 10;
+
+const QStringList &extensions()
+{
+    static const QStringList exts { "txt", "jpg", "png", "mp3", "mp4", "pdf", "docx", "xlsx",
+                                    "tar.gz", "deb", "cpp", "h", "desktop", "svg", "", "json" };
+    return exts;
+}
+
+QString fileName(const QString &stem, int index)
+{
+    const QString &ext = extensions().at(index % extensions().size());
+    return ext.isEmpty() ? stem : stem + '.' + ext;
+}
+}   // namespace
+
+TreeGenerator::TreeGenerator(const QString &root)
+    : rootPath(root)
+{
+    QDir().mkpath(rootPath);
+}
+
+QString TreeGenerator::shapeName(Shape shape)
+{
+    switch (shape) {
+    case Shape::kFlat:
+        return "flat";
+    case Shape::kDeep:
+        return "deep";
+    case Shape::kCjk:
+        return "cjk";
+    case Shape::kMixed:
+        return "mixed";
+    }
+    return QString();
+}
+
+TreeGenerator::Tree TreeGenerator::generate(Shape shape, int fileCount)
+{
+    Tree tree;
+    tree.shape = shape;
+    tree.fileCount = fileCount;
+    tree.name = shapeName(shape);
+    tree.path = rootPath + '/' + QString("%1-%2").arg(tree.name).arg(fileCount);
+
+    if (isGenerated(tree.path, fileCount))
+        return tree;
+
+    QDir(tree.path).removeRecursively();
+    QDir().mkpath(tree.path);
+    qInfo() << "generating" << tree.name << "tree of" << fileCount << "files at" << tree.path;
+
+    switch (shape) {
+    case Shape::kFlat:
+        generateFlat(tree.path, fileCount);
+        break;
+    case Shape::kDeep:
+        generateDeep(tree.path, fileCount);
+        break;
+    case Shape::kCjk:
+        generateCjk(tree.path, fileCount);
+        break;
+    case Shape::kMixed:
+        generateMixed(tree.path, fileCount);
+        break;
+    }
+
+    markGenerated(tree.path, fileCount);
+    return tree;
+}
+
+bool TreeGenerator::isGenerated(const QString &path, int fileCount) const
+{
+    QFile stamp(path + '/' + kStampFile);
+    if (!stamp.open(QIODevice::ReadOnly))
+        return false;
+    return stamp.readAll().trimmed().toInt() == fileCount;
+}
+
+void TreeGenerator::markGenerated(const QString &path, int fileCount) const
+{
+    QFile stamp(path + '/' + kStampFile);
+    if (stamp.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        stamp.write(QByteArray::number(fileCount));
+}
+
+bool TreeGenerator::createFile(const QString &path, qint64 size)
+{
+    const int fd = ::open(QFile::encodeName(path).constData(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return false;
+    // sparse files, the sizes differ without writing the data
+    const bool ok = size <= 0 || ::ftruncate(fd, size) == 0;
+    ::close(fd);
+    return ok;
+}
+
+void TreeGenerator::generateFlat(const QString &path, int fileCount)
+{
+    for (int i = 0; i < fileCount; ++i)
+        createFile(path + '/' + fileName(QString("file_%1").arg(i, 7, 10, QChar('0')), i), i % 4096);
+}
+
+void TreeGenerator::generateDeep(const QString &path, int fileCount)
+{
+    const int perDir = qMax(1, fileCount / (kDeepChains * kDeepDepth));
+    for (int chain = 0; chain < kDeepChains; ++chain) {
+        QString dir = path + QString("/chain_%1").arg(chain);
+        for (int level = 0; level < kDeepDepth; ++level) {
+            QDir().mkpath(dir);
+            for (int i = 0; i < perDir; ++i)
+                createFile(dir + '/' + fileName(QString("l%1_%2").arg(level).arg(i), i), i * 512);
+            dir += QString("/level_%1").arg(level + 1);
+        }
+    }
+}
+
+void TreeGenerator::generateCjk(const QString &path, int fileCount)
+{
+    static const QStringList stems { "文件", "报告", "照片", "会议纪要", "ファイル", "写真", "파일", "문서",
+                                     "数据2024", "Résumé", "项目-Alpha", "测试 文档" };
+    for (int i = 0; i < fileCount; ++i) {
+        const QString &stem = QString("%1_%2").arg(stems.at(i % stems.size())).arg(i);
+        createFile(path + '/' + fileName(stem, i / stems.size()), i % 8192);
+    }
+}
+
+void TreeGenerator::generateMixed(const QString &path, int fileCount)
+{
+    for (int i = 0; i < fileCount; ++i) {
+        const QString &stem = QString("%1item_%2").arg(i % 10 == 0 ? "." : "").arg(i);
+        if (i % 20 == 0) {
+            QDir().mkpath(path + '/' + stem);
+            continue;
+        }
+        if (i % 50 == 1) {
+            QFile::link(fileName(QString("item_%1").arg(i + 1), i + 1), path + '/' + stem + ".lnk");
+            continue;
+        }
+        createFile(path + '/' + fileName(stem, i), qint64(i % 97) * 1024 * 1024);
+    }
+}
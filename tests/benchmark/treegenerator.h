@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#ifndef TREEGENERATOR_H
+#define TREEGENERATOR_H
+
+#include <QString>
+#include <QStringList>
+
+/*!
+ * \brief Synthetic directory trees for the benchmarks
+ *
+ * A generated tree is marked with a stamp file, an existing tree of the
+ * same shape is reused, creating a million files takes a while.
+ */
+class TreeGenerator
+{
+public:
+    enum class Shape {
+        kFlat,   // every file in one directory
+        kDeep,   // chains of nested directories
+        kCjk,   // CJK and mixed script names
+        kMixed   // folders, hidden files, links and many types
+    };
+
+    struct Tree
+    {
+        QString name;
+        QString path;
+        Shape shape { Shape::kFlat };
+        int fileCount { 0 };   // the files in the top directory, or in all levels for kDeep
+    };
+
+    explicit TreeGenerator(const QString &root);
+
+    Tree generate(Shape shape, int fileCount);
+    static QString shapeName(Shape shape);
+
+private:
+    bool isGenerated(const QString &path, int fileCount) const;
+    void markGenerated(const QString &path, int fileCount) const;
+    static bool createFile(const QString &path, qint64 size);
+
+    void generateFlat(const QString &path, int fileCount);
+    void generateDeep(const QString &path, int fileCount);
+    void generateCjk(const QString &path, int fileCount);
+    void generateMixed(const QString &path, int fileCount);
+
+    QString rootPath;
+};
+
+#endif   // TREEGENERATOR_H